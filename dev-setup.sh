@@ -86,6 +86,7 @@ rm 1.1.5.tar.gz && rm -r plog-1.1.5
 sudo apt-get install -y \
     libsodium-dev \
     sqlite3 libsqlite3-dev \
+    zlib1g-dev \
     libboost-stacktrace-dev \
     fuse3
 
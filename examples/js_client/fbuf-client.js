@@ -0,0 +1,352 @@
+// Reference client for the HotPocket flatbuffer user protocol.
+// Message layouts are defined in hpcore src/msg/fbuf/usrmsg.fbs. This client uses the low-level flatbuffers
+// builder/reader API directly so it has no generated code dependency.
+// Usage: node fbuf-client.js [host] [port]
+// Type a line to submit it as an input, or 'upload <file path>' to upload a file as a chunked input.
+
+const fs = require('fs');
+const readline = require('readline');
+const WebSocket = require('ws');
+const sodium = require('libsodium-wrappers');
+const { flatbuffers } = require('flatbuffers');
+const blake3 = require('blake3');
+
+// UserMsgContent union types (must match the order in usrmsg.fbs).
+const MsgType = {
+    NONE: 0,
+    StatRequest: 1,
+    LclRequest: 2,
+    ContractReadRequest: 3,
+    ContractInput: 4,
+    SubscriptionRequest: 5,
+    LedgerQuery: 6,
+    StatResponse: 7,
+    LclResponse: 8,
+    ContractReadResponse: 9,
+    ContractInputStatus: 10,
+    ContractOutput: 11,
+    UnlChange: 12,
+    LedgerCreatedEvent: 13,
+    VoteStatusEvent: 14,
+    ProposalHealthEvent: 15,
+    ConnectivityHealthEvent: 16,
+    LedgerQueryResult: 17,
+    ContractInputBegin: 18,
+    ContractInputChunk: 19,
+    ContractInputEnd: 20
+};
+
+// No. of ledgers an input remains valid for.
+const INPUT_LEDGER_TTL = 10;
+
+// Chunk size used for chunked input uploads. Must be within the node's per-message limit.
+const UPLOAD_CHUNK_SIZE = 64 * 1024;
+
+//---Message writing---//
+
+function createBytes(builder, bytes) {
+    builder.startVector(1, bytes.length, 1);
+    for (let i = bytes.length - 1; i >= 0; i--)
+        builder.addInt8(bytes[i]);
+    return builder.endVector();
+}
+
+function createLong(builder, num) {
+    return builder.createLong(num % 0x100000000, Math.floor(num / 0x100000000));
+}
+
+// Wraps the content table in the root UserMsg and returns the serialized bytes.
+function finishUserMsg(builder, type, content) {
+    builder.startObject(2);
+    builder.addFieldInt8(0, type, 0);
+    builder.addFieldOffset(1, content, 0);
+    builder.finish(builder.endObject());
+    return builder.asUint8Array();
+}
+
+function createEmptyMsg(type) {
+    const builder = new flatbuffers.Builder(64);
+    builder.startObject(0);
+    return finishUserMsg(builder, type, builder.endObject());
+}
+
+function createReadRequest(id, content) {
+    const builder = new flatbuffers.Builder(content.length + 64);
+    const idOffset = builder.createString(id);
+    const contentOffset = createBytes(builder, content);
+    builder.startObject(2);
+    builder.addFieldOffset(0, idOffset, 0);
+    builder.addFieldOffset(1, contentOffset, 0);
+    return finishUserMsg(builder, MsgType.ContractReadRequest, builder.endObject());
+}
+
+// Returns the serialized InputContainer root. This is the exact byte sequence the user signs.
+function createInputContainer(input, nonce, maxLedgerSeqNo) {
+    const builder = new flatbuffers.Builder(input.length + 64);
+    const inputOffset = createBytes(builder, input);
+    builder.startObject(3);
+    builder.addFieldOffset(0, inputOffset, 0);
+    builder.addFieldInt64(1, createLong(builder, nonce), builder.createLong(0, 0));
+    builder.addFieldInt64(2, createLong(builder, maxLedgerSeqNo), builder.createLong(0, 0));
+    builder.finish(builder.endObject());
+    return builder.asUint8Array();
+}
+
+function createContractInput(container, sig) {
+    const builder = new flatbuffers.Builder(container.length + 128);
+    const containerOffset = createBytes(builder, container);
+    const sigOffset = createBytes(builder, sig);
+    builder.startObject(2);
+    builder.addFieldOffset(0, containerOffset, 0);
+    builder.addFieldOffset(1, sigOffset, 0);
+    return finishUserMsg(builder, MsgType.ContractInput, builder.endObject());
+}
+
+function createInputBegin(id, size) {
+    const builder = new flatbuffers.Builder(64);
+    const idOffset = builder.createString(id);
+    builder.startObject(2);
+    builder.addFieldOffset(0, idOffset, 0);
+    builder.addFieldInt64(1, createLong(builder, size), builder.createLong(0, 0));
+    return finishUserMsg(builder, MsgType.ContractInputBegin, builder.endObject());
+}
+
+function createInputChunk(id, data) {
+    const builder = new flatbuffers.Builder(data.length + 64);
+    const idOffset = builder.createString(id);
+    const dataOffset = createBytes(builder, data);
+    builder.startObject(2);
+    builder.addFieldOffset(0, idOffset, 0);
+    builder.addFieldOffset(1, dataOffset, 0);
+    return finishUserMsg(builder, MsgType.ContractInputChunk, builder.endObject());
+}
+
+function createInputEnd(id, container, sig) {
+    const builder = new flatbuffers.Builder(container.length + 128);
+    const idOffset = builder.createString(id);
+    const containerOffset = createBytes(builder, container);
+    const sigOffset = createBytes(builder, sig);
+    builder.startObject(3);
+    builder.addFieldOffset(0, idOffset, 0);
+    builder.addFieldOffset(1, containerOffset, 0);
+    builder.addFieldOffset(2, sigOffset, 0);
+    return finishUserMsg(builder, MsgType.ContractInputEnd, builder.endObject());
+}
+
+//---Message reading---//
+
+// Minimal table reader over a flatbuffers ByteBuffer.
+class Table {
+    constructor(bb, pos) {
+        this.bb = bb;
+        this.pos = pos;
+    }
+
+    offset(slot) {
+        return this.bb.__offset(this.pos, 4 + slot * 2);
+    }
+
+    uint8(slot) {
+        const o = this.offset(slot);
+        return o ? this.bb.readUint8(this.pos + o) : 0;
+    }
+
+    bool(slot) {
+        return this.uint8(slot) != 0;
+    }
+
+    uint64(slot) {
+        const o = this.offset(slot);
+        return o ? this.bb.readUint64(this.pos + o).toFloat64() : 0;
+    }
+
+    string(slot) {
+        const o = this.offset(slot);
+        return o ? this.bb.__string(this.pos + o) : null;
+    }
+
+    bytes(slot) {
+        const o = this.offset(slot);
+        if (!o)
+            return null;
+        const start = this.bb.__vector(this.pos + o);
+        return Buffer.from(this.bb.bytes().subarray(start, start + this.bb.__vector_len(this.pos + o)));
+    }
+
+    table(slot) {
+        const o = this.offset(slot);
+        return o ? new Table(this.bb, this.bb.__indirect(this.pos + o)) : null;
+    }
+
+    tables(slot) {
+        const o = this.offset(slot);
+        if (!o)
+            return null;
+        const start = this.bb.__vector(this.pos + o);
+        const list = [];
+        for (let i = 0; i < this.bb.__vector_len(this.pos + o); i++)
+            list.push(new Table(this.bb, this.bb.__indirect(start + i * 4)));
+        return list;
+    }
+
+    strings(slot) {
+        const o = this.offset(slot);
+        if (!o)
+            return null;
+        const start = this.bb.__vector(this.pos + o);
+        const list = [];
+        for (let i = 0; i < this.bb.__vector_len(this.pos + o); i++)
+            list.push(this.bb.__string(start + i * 4));
+        return list;
+    }
+}
+
+// Returns the union type and content table of a received UserMsg.
+function readUserMsg(data) {
+    const bb = new flatbuffers.ByteBuffer(new Uint8Array(data));
+    const root = new Table(bb, bb.readInt32(bb.position()) + bb.position());
+    return { type: root.uint8(0), content: root.table(1) };
+}
+
+//---Client---//
+
+async function main() {
+    await sodium.ready;
+    const keys = sodium.crypto_sign_keypair();
+    const pubkeyHex = 'ed' + Buffer.from(keys.publicKey).toString('hex');
+    console.log('My public key is: ' + pubkeyHex);
+
+    let server = 'wss://localhost:8080';
+    if (process.argv.length == 3) server = 'wss://localhost:' + process.argv[2];
+    if (process.argv.length == 4) server = 'wss://' + process.argv[2] + ':' + process.argv[3];
+
+    // HotPocket nodes typically use self-signed certificates.
+    const ws = new WebSocket(server, { rejectUnauthorized: false });
+    let authed = false;
+    let lclSeqNo = 0;
+    let nonce = Date.now();
+    let readId = 0;
+    let uploadId = 0;
+
+    const submitInput = (text) => {
+        const container = createInputContainer(Buffer.from(text), nonce++, lclSeqNo + INPUT_LEDGER_TTL);
+        const sig = sodium.crypto_sign_detached(container, keys.privateKey);
+        ws.send(createContractInput(container, sig));
+    };
+
+    // Uploads the input in chunks. The signed container holds the blake3 hash of the whole input instead of the input.
+    const uploadInput = (input) => {
+        const id = String(uploadId++);
+        ws.send(createInputBegin(id, input.length));
+        for (let pos = 0; pos < input.length; pos += UPLOAD_CHUNK_SIZE)
+            ws.send(createInputChunk(id, input.subarray(pos, pos + UPLOAD_CHUNK_SIZE)));
+
+        const hash = blake3.createHash().update(input).digest();
+        const container = createInputContainer(hash, nonce++, lclSeqNo + INPUT_LEDGER_TTL);
+        const sig = sodium.crypto_sign_detached(container, keys.privateKey);
+        ws.send(createInputEnd(id, container, sig));
+    };
+
+    ws.on('message', (data) => {
+        if (!authed) {
+            // The challenge handshake is always json. The protocol field selects flatbuffers afterwards.
+            const challenge = JSON.parse(data.toString());
+            if (challenge.type !== 'user_challenge') {
+                console.log('Unexpected handshake message.');
+                return ws.close();
+            }
+
+            const sig = sodium.crypto_sign_detached(challenge.challenge, keys.privateKey);
+            ws.send(JSON.stringify({
+                type: 'user_challenge_response',
+                sig: Buffer.from(sig).toString('hex'),
+                pubkey: pubkeyHex,
+                protocol: 'flatbuf'
+            }));
+            authed = true;
+            console.log('Connected to contract ' + challenge.contract_id);
+
+            // Query the lcl so inputs can be given a valid max ledger seq no.
+            ws.send(createEmptyMsg(MsgType.LclRequest));
+            return;
+        }
+
+        const { type, content } = readUserMsg(data);
+        switch (type) {
+            case MsgType.LclResponse:
+                lclSeqNo = content.uint64(0);
+                console.log('Ledger seq no: ' + lclSeqNo + '. Ready to accept inputs.');
+                break;
+            case MsgType.StatResponse:
+                console.log({
+                    hpVersion: content.string(0),
+                    ledgerSeqNo: content.uint64(1),
+                    ledgerHash: content.bytes(2).toString('hex'),
+                    voteStatus: content.string(3),
+                    roundTime: content.uint64(4),
+                    contractExecutionEnabled: content.bool(5),
+                    readRequestsEnabled: content.bool(6),
+                    isFullHistoryNode: content.bool(7),
+                    weaklyConnected: content.bool(8),
+                    currentUnl: content.tables(9).map(t => t.bytes(0).toString('hex')),
+                    peers: content.strings(10)
+                });
+                break;
+            case MsgType.ContractInputStatus:
+                if (content.string(0) !== 'accepted')
+                    console.log('Input rejected: ' + content.string(1));
+                else
+                    lclSeqNo = Math.max(lclSeqNo, content.uint64(3));
+                break;
+            case MsgType.ContractReadResponse:
+                console.log('Read reply (' + content.string(0) + ')>> ' + content.bytes(1).toString());
+                break;
+            case MsgType.ContractOutput:
+                lclSeqNo = Math.max(lclSeqNo, content.uint64(0));
+                content.tables(2).forEach(o => {
+                    const output = o.bytes(0);
+                    const outputLog = output.length <= 512 ? output.toString() : `[Big output (${output.length / 1024} KB)]`;
+                    console.log(`Output (ledger:${lclSeqNo})>> ${outputLog}`);
+                });
+                break;
+            default:
+                console.log('Received message type ' + type);
+                break;
+        }
+    });
+
+    ws.on('close', () => {
+        console.log('Disconnected');
+        process.exit();
+    });
+
+    ws.on('error', (e) => console.log(e.message));
+
+    const rl = readline.createInterface({
+        input: process.stdin,
+        output: process.stdout
+    });
+
+    rl.on('SIGINT', () => {
+        rl.close();
+        ws.close();
+    });
+
+    rl.on('line', (inp) => {
+        if (!authed || inp.length == 0)
+            return;
+
+        if (inp.startsWith('read '))
+            ws.send(createReadRequest(String(readId++), Buffer.from(inp.substr(5))));
+        else if (inp === 'stat')
+            ws.send(createEmptyMsg(MsgType.StatRequest));
+        else if (inp === 'lcl')
+            ws.send(createEmptyMsg(MsgType.LclRequest));
+        else if (inp.startsWith('upload '))
+            uploadInput(fs.readFileSync(inp.substr(7)));
+        else
+            submitInput(inp);
+    });
+}
+
+main();
@@ -6,6 +6,7 @@
 #include "../util/util.hpp"
 #include "../corebill/corebill.hpp"
 #include "../corebill/tracker.hpp"
+#include "../thread_placement.hpp"
 #include "hpws.hpp"
 #include "comm_session.hpp"
 
@@ -47,6 +48,7 @@ namespace comm
     private:
         const std::string name;
         const uint16_t listen_port;
+        std::string thread_name_prefix;       // Server thread name prefix (eg. "hp-peer").
         std::optional<hpws::server> hpws_server;
         std::thread watchdog_thread;          // Connection watcher thread.
         std::thread message_processor_thread; // Message processor thread.
@@ -54,6 +56,7 @@ namespace comm
         void connection_watchdog()
         {
             util::mask_signal();
+            thread_placement::apply(thread_placement::THREAD_CLASS::NETWORK, thread_name_prefix + "-watchdog");
 
             while (!is_shutting_down)
             {
@@ -203,6 +206,7 @@ namespace comm
         void message_processor_loop()
         {
             util::mask_signal();
+            thread_placement::apply(thread_placement::THREAD_CLASS::NETWORK, thread_name_prefix + "-proc");
 
             while (!is_shutting_down)
             {
@@ -297,6 +301,8 @@ namespace comm
               name(name),
               listen_port(port)
         {
+            thread_name_prefix = "hp-" + this->name;
+            std::transform(thread_name_prefix.begin(), thread_name_prefix.end(), thread_name_prefix.begin(), ::tolower);
         }
 
         int start()
@@ -5,6 +5,7 @@
 #include "../corebill/tracker.hpp"
 #include "hpws.hpp"
 #include "comm_session.hpp"
+#include "../thread_placement.hpp"
 
 namespace comm
 {
@@ -59,6 +60,7 @@ namespace comm
     void comm_session::reader_loop()
     {
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::NETWORK, "hp-sess-read");
 
         while (state != SESSION_STATE::CLOSED && hpws_client)
         {
@@ -82,30 +84,32 @@ namespace comm
                 // Enqueue the message for processing.
                 std::string_view data = std::get<std::string_view>(read_result);
 
-                // Detect message priority before adding to the message queue.
-                const int priority = get_message_priority(data);
-                if (priority == 0) // priority 0 means a bad message.
+                // Validate and classify the message before adding to the message queue. The message is copied out of
+                // the hpws buffer only if it needs processing.
+                inbound_message msg;
+                const MSG_CLASS msg_class = classify_message(data, msg);
+                if (msg_class == MSG_CLASS::MSG_BAD)
                 {
                     if (challenge_status == comm::CHALLENGE_STATUS::CHALLENGE_VERIFIED)
                         increment_metric(comm::SESSION_THRESHOLDS::MAX_BADMSGS_PER_MINUTE, 1);
                     else
                         should_disconnect = true; // Disconnect if we receive a bad message before challenge verification.
                 }
-                else if (priority == 1 || priority == 2)
+                else if (msg_class == MSG_CLASS::MSG_HIGH_PRIORITY || msg_class == MSG_CLASS::MSG_LOW_PRIORITY)
                 {
-                    std::vector<char> msg(data.size());
-                    memcpy(msg.data(), data.data(), data.size());
+                    // The classifier may have already populated the message bytes (eg. decompressed messages).
+                    if (msg.data.empty())
+                        msg.data = data;
 
-                    bool enqueued = false;
-
-                    if (priority == 1)
-                        enqueued = in_msg_queue1.try_enqueue(std::move(msg));
-                    else if (priority == 2)
-                        enqueued = in_msg_queue2.try_enqueue(std::move(msg));
+                    const bool enqueued = (msg_class == MSG_CLASS::MSG_HIGH_PRIORITY)
+                                              ? in_msg_queue1.try_enqueue(std::move(msg))
+                                              : in_msg_queue2.try_enqueue(std::move(msg));
 
+                    // A failed enqueue does not move the message. So it is still available here.
                     if (!enqueued)
                     {
                         LOG_WARNING << "Failed to enqueue comm msg.";
+                        handle_enqueue_failure(msg);
                     }
                 }
 
@@ -145,17 +149,15 @@ namespace comm
 
         int res = 0;
 
-        moodycamel::ReaderWriterQueue<std::vector<char>> &queue = (priority == 1 ? in_msg_queue1 : in_msg_queue2);
+        moodycamel::ReaderWriterQueue<inbound_message> &queue = (priority == 1 ? in_msg_queue1 : in_msg_queue2);
 
         // Process queue top.
-        std::vector<char> msg;
+        inbound_message msg;
         if (queue.try_dequeue(msg))
         {
-            std::string_view sv(msg.data(), msg.size());
-
             // If session handler returns -1 then that means the session must be closed.
             // Otherwise it's considered message processing is successful.
-            if (handle_message(sv) == -1)
+            if (handle_message(msg) == -1)
                 return -1;
             else
                 res = 1;
@@ -168,25 +170,35 @@ namespace comm
      * Adds the given message to the outbound message queue.
      * @param message Message to be added to the outbound queue.
      * @param priority If 1 adds to high priority queue. Else adds to low priority queue.
-     * @return 0 on successful addition and -1 if the session is already closed.
+     * @return 0 on successful addition and -1 if the session is already closed or over its outbound budget.
      */
     int comm_session::send(const std::vector<uint8_t> &message, const uint16_t priority)
     {
         std::string_view sv(reinterpret_cast<const char *>(message.data()), message.size());
-        return send(sv);
+        return send(sv, priority);
     }
 
     /**
      * Adds the given message to the outbound message queue.
      * @param message Message to be added to the outbound queue.
      * @param priority If 1 adds to high priority queue. Else adds to low priority queue.
-     * @return 0 on successful addition and -1 if the session is already closed.
+     * @return 0 on successful addition and -1 if the session is already closed or over its outbound budget.
      */
     int comm_session::send(std::string_view message, const uint16_t priority)
     {
         if (state == SESSION_STATE::CLOSED)
             return -1;
 
+        // Messages in these queues cannot be dropped. So if there's no room even after dropping the queued
+        // notifications, the remote party is not keeping up and the session gets closed.
+        if (!reserve_outbound(message.size()))
+        {
+            LOG_WARNING << "Closing slow consumer session " << display_name() << ". Outbound budget exceeded (queued:"
+                        << outbound->queued_bytes << " bytes).";
+            mark_for_closure();
+            return -1;
+        }
+
         // Updating last activity timestamp since this session is sending a message.
         last_activity_timestamp = util::get_epoch_milliseconds();
 
@@ -199,6 +211,155 @@ namespace comm
         return 0;
     }
 
+    /**
+     * Adds the given notification to the outbound notification queue. Unlike other messages, notifications may be
+     * dropped or coalesced according to the outbound policy when the session exceeds its outbound budget.
+     * @param message Notification message to be added to the outbound queue.
+     * @param kind Kind of the notification. Queued notifications of the same kind are coalesced.
+     * @return 0 if the notification was queued, coalesced or dropped. -1 if the session is closed or got closed
+     *         due to the budget.
+     */
+    int comm_session::send_notification(const std::vector<uint8_t> &message, const int kind)
+    {
+        std::string_view sv(reinterpret_cast<const char *>(message.data()), message.size());
+        return send_notification(sv, kind);
+    }
+
+    /**
+     * Adds the given notification to the outbound notification queue. Unlike other messages, notifications may be
+     * dropped or coalesced according to the outbound policy when the session exceeds its outbound budget.
+     * @param message Notification message to be added to the outbound queue.
+     * @param kind Kind of the notification. Queued notifications of the same kind are coalesced.
+     * @return 0 if the notification was queued, coalesced or dropped. -1 if the session is closed or got closed
+     *         due to the budget.
+     */
+    int comm_session::send_notification(std::string_view message, const int kind)
+    {
+        if (state == SESSION_STATE::CLOSED)
+            return -1;
+
+        std::scoped_lock<std::mutex> lock(outbound->notifications_mutex);
+
+        if (!try_add_outbound(message.size()))
+        {
+            if (outbound_policy == OUTBOUND_POLICY::DISCONNECT)
+            {
+                LOG_WARNING << "Closing slow consumer session " << display_name() << ". Outbound budget exceeded (queued:"
+                            << outbound->queued_bytes << " bytes).";
+                mark_for_closure();
+                return -1;
+            }
+
+            if (outbound_policy == OUTBOUND_POLICY::COALESCE)
+            {
+                // Replace the latest queued notification of the same kind since it's superseded by this one.
+                const auto itr = std::find_if(outbound->notifications.rbegin(), outbound->notifications.rend(),
+                                              [&](const std::pair<int, std::string> &n)
+                                              { return n.first == kind; });
+                if (itr != outbound->notifications.rend())
+                {
+                    outbound->queued_bytes -= itr->second.size();
+                    outbound->queued_bytes += message.size();
+                    itr->second = message;
+                    outbound->coalesced_msgs++;
+                    return 0;
+                }
+            }
+
+            // Drop the oldest notifications until the new one fits. Drop the new notification as well if the
+            // non-droppable messages alone exceed the budget.
+            if (!drop_notifications_until_fits(message.size()))
+            {
+                outbound->dropped_msgs++;
+                return 0;
+            }
+
+            LOG_DEBUG << "Dropped notifications for slow consumer session " << display_name() << " (total dropped:" << outbound->dropped_msgs << ").";
+        }
+
+        outbound->notifications.emplace_back(kind, message);
+        return 0;
+    }
+
+    /**
+     * Atomically accounts the given no. of bytes into the outbound queue usage if they fit within the budget.
+     * An empty queue accepts any message so messages larger than the budget can still be sent.
+     * @param size No. of bytes to be queued.
+     * @return True if the bytes were accounted. False if they don't fit within the budget.
+     */
+    bool comm_session::try_add_outbound(const size_t size)
+    {
+        size_t queued = outbound->queued_bytes.load();
+        do
+        {
+            if (max_outbound_bytes > 0 && queued > 0 && queued + size > max_outbound_bytes)
+                return false;
+        } while (!outbound->queued_bytes.compare_exchange_weak(queued, queued + size));
+
+        outbound->queued_msgs++;
+        return true;
+    }
+
+    /**
+     * Drops the oldest queued notifications until the given no. of bytes fit within the budget and accounts them.
+     * Must be called while holding the notifications mutex.
+     * @return True if the bytes were accounted. False if they don't fit even after dropping all notifications.
+     */
+    bool comm_session::drop_notifications_until_fits(const size_t size)
+    {
+        while (!outbound->notifications.empty())
+        {
+            release_outbound(outbound->notifications.front().second.size());
+            outbound->notifications.pop_front();
+            outbound->dropped_msgs++;
+
+            if (try_add_outbound(size))
+                return true;
+        }
+
+        return try_add_outbound(size);
+    }
+
+    /**
+     * Accounts the given no. of bytes into the outbound queue usage. Queued notifications are dropped to make room
+     * if needed (unless the policy is to disconnect).
+     * @param size No. of bytes to be queued.
+     * @return True if the bytes fit within the outbound budget. False otherwise.
+     */
+    bool comm_session::reserve_outbound(const size_t size)
+    {
+        if (try_add_outbound(size))
+            return true;
+
+        if (outbound_policy == OUTBOUND_POLICY::DISCONNECT)
+            return false;
+
+        std::scoped_lock<std::mutex> lock(outbound->notifications_mutex);
+        return drop_notifications_until_fits(size);
+    }
+
+    void comm_session::release_outbound(const size_t size)
+    {
+        outbound->queued_bytes -= size;
+        outbound->queued_msgs--;
+    }
+
+    /**
+     * Sets the outbound queue byte budget of the session. Must be called before the session is initialized.
+     * @param max_bytes Max no. of bytes allowed in the outbound queues. 0 means unlimited.
+     * @param policy Policy to apply when the budget is exceeded.
+     */
+    void comm_session::set_outbound_budget(const size_t max_bytes, const OUTBOUND_POLICY policy)
+    {
+        max_outbound_bytes = max_bytes;
+        outbound_policy = policy;
+    }
+
+    const outbound_stats comm_session::get_outbound_stats() const
+    {
+        return outbound_stats{outbound->queued_bytes, outbound->queued_msgs, outbound->dropped_msgs, outbound->coalesced_msgs};
+    }
+
     /**
      * This function constructs and sends the message to the target from the given message.
      * @param message Message to be sent via the pipe.
@@ -225,6 +386,7 @@ namespace comm
     {
         // Appling a signal mask to prevent receiving control signals from linux kernel.
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::NETWORK, "hp-sess-write");
 
         // Keep checking until the session is terminated.
         while (state != SESSION_STATE::CLOSED)
@@ -236,6 +398,7 @@ namespace comm
             while (out_msg_queue1.try_dequeue(msg_to_send))
             {
                 process_outbound_message(msg_to_send);
+                release_outbound(msg_to_send.size());
                 msg_to_send.clear();
                 messages_sent = true;
             }
@@ -244,9 +407,26 @@ namespace comm
             if (out_msg_queue2.try_dequeue(msg_to_send))
             {
                 process_outbound_message(msg_to_send);
+                release_outbound(msg_to_send.size());
+                msg_to_send.clear();
                 messages_sent = true;
             }
 
+            // Send top notification.
+            {
+                std::unique_lock<std::mutex> lock(outbound->notifications_mutex);
+                if (!outbound->notifications.empty())
+                {
+                    msg_to_send.swap(outbound->notifications.front().second);
+                    outbound->notifications.pop_front();
+                    lock.unlock();
+
+                    process_outbound_message(msg_to_send);
+                    release_outbound(msg_to_send.size());
+                    messages_sent = true;
+                }
+            }
+
             // Wait for small delay if there were no outbound messages.
             if (!messages_sent)
                 util::sleep(10);
@@ -292,6 +472,9 @@ namespace comm
         if (reader_thread.joinable())
             reader_thread.join();
 
+        if (outbound->dropped_msgs > 0 || outbound->coalesced_msgs > 0)
+            LOG_INFO << "Session " << display_name() << " dropped " << outbound->dropped_msgs << " and coalesced " << outbound->coalesced_msgs << " outbound notifications.";
+
         LOG_DEBUG << "Session closed: " << display_name();
     }
 
@@ -391,16 +574,30 @@ namespace comm
         return 0;
     }
 
-    int comm_session::get_message_priority(std::string_view msg)
+    /**
+     * Validates and classifies a message on the reader thread.
+     * @param data Message bytes. Only valid during this call.
+     * @param msg Inbound message whose metadata should be populated. Message bytes are filled by the caller unless
+     *            populated here.
+     */
+    MSG_CLASS comm_session::classify_message(std::string_view data, inbound_message &msg)
     {
-        return 2; // Default is low priority.
+        return MSG_CLASS::MSG_LOW_PRIORITY; // Default is low priority.
     }
 
-    int comm_session::handle_message(std::string_view msg)
+    int comm_session::handle_message(inbound_message &msg)
     {
         return 0;
     }
 
+    /**
+     * Called on the reader thread when a classified message could not be queued for processing. Lets the session
+     * undo any state recorded for the message while classifying it.
+     */
+    void comm_session::handle_enqueue_failure(const inbound_message &msg)
+    {
+    }
+
     void comm_session::handle_close()
     {
     }
@@ -34,6 +34,42 @@ namespace comm
         VIOLATION_IRRELEVANT_KNOWN_PEER = 5
     };
 
+    // Results of classifying an inbound message on the session reader thread.
+    enum MSG_CLASS
+    {
+        MSG_BAD = 0,           // Malformed message. Counted against the session.
+        MSG_HIGH_PRIORITY = 1, // Queued for processing with high priority.
+        MSG_LOW_PRIORITY = 2,  // Queued for processing with low priority.
+        MSG_DROP = 3           // Valid but not worth processing (eg. duplicate or stale). Dropped silently.
+    };
+
+    /**
+     * A message read from the session along with the metadata derived while classifying it on the reader thread.
+     * The message processor receives it already validated and owns the message bytes.
+     */
+    struct inbound_message
+    {
+        std::string data;           // Message bytes.
+        int type = 0;               // Session specific message type (eg. p2p message content type).
+        uint64_t originated_on = 0; // Creation timestamp reported by the sender (if any).
+    };
+
+    // Policy applied when a session's queued outbound bytes exceed its budget.
+    enum OUTBOUND_POLICY
+    {
+        DROP_OLDEST, // Drop the oldest queued notifications to make room.
+        COALESCE,    // Replace the queued notification of the same kind with the newer one.
+        DISCONNECT   // Close the session.
+    };
+
+    struct outbound_stats
+    {
+        size_t queued_bytes = 0;    // Bytes waiting in the outbound queues.
+        size_t queued_msgs = 0;     // Messages waiting in the outbound queues.
+        uint64_t dropped_msgs = 0;  // Notifications dropped due to the budget.
+        uint64_t coalesced_msgs = 0; // Notifications replaced by a newer one of the same kind.
+    };
+
     /**
      * Represents an active WebSocket connection
      */
@@ -47,17 +83,37 @@ namespace comm
 
         std::thread reader_thread;                                      // The thread responsible for reading messages from the read fd.
         std::thread writer_thread;                                      // The thread responsible for writing messages to the write fd.
-        moodycamel::ReaderWriterQueue<std::vector<char>> in_msg_queue1; // Holds high priority incoming messages waiting to be processed.
-        moodycamel::ReaderWriterQueue<std::vector<char>> in_msg_queue2; // Holds low priority incoming messages waiting to be processed.
+        moodycamel::ReaderWriterQueue<inbound_message> in_msg_queue1; // Holds high priority incoming messages waiting to be processed.
+        moodycamel::ReaderWriterQueue<inbound_message> in_msg_queue2; // Holds low priority incoming messages waiting to be processed.
         moodycamel::ConcurrentQueue<std::string> out_msg_queue1;        // Holds high priority outgoing messages waiting to be processed.
         moodycamel::ConcurrentQueue<std::string> out_msg_queue2;        // Holds low priority outgoing messages waiting to be processed.
 
+        // Outbound notification queue and budget accounting. Kept on the heap so the session remains movable.
+        struct outbound_queue
+        {
+            std::list<std::pair<int, std::string>> notifications; // Holds droppable outgoing notifications along with their kinds.
+            std::mutex notifications_mutex;                        // Guards notifications.
+            std::atomic<size_t> queued_bytes = 0;
+            std::atomic<size_t> queued_msgs = 0;
+            std::atomic<uint64_t> dropped_msgs = 0;
+            std::atomic<uint64_t> coalesced_msgs = 0;
+        };
+        std::unique_ptr<outbound_queue> outbound = std::make_unique<outbound_queue>();
+
+        size_t max_outbound_bytes = 0; // Outbound queue byte budget. 0 means unlimited.
+        OUTBOUND_POLICY outbound_policy = OUTBOUND_POLICY::DROP_OLDEST;
+
         void reader_loop();
+        bool try_add_outbound(const size_t size);
+        bool drop_notifications_until_fits(const size_t size);
+        bool reserve_outbound(const size_t size);
+        void release_outbound(const size_t size);
 
     protected:
         virtual int handle_connect();
-        virtual int get_message_priority(std::string_view msg);
-        virtual int handle_message(std::string_view msg);
+        virtual MSG_CLASS classify_message(std::string_view data, inbound_message &msg);
+        virtual int handle_message(inbound_message &msg);
+        virtual void handle_enqueue_failure(const inbound_message &msg);
         virtual void handle_close();
         virtual void handle_on_verified();
 
@@ -78,6 +134,10 @@ namespace comm
         int process_next_inbound_message(const uint16_t priority);
         int send(const std::vector<uint8_t> &message, const uint16_t priority = 2);
         int send(std::string_view message, const uint16_t priority = 2);
+        int send_notification(const std::vector<uint8_t> &message, const int kind);
+        int send_notification(std::string_view message, const int kind);
+        void set_outbound_budget(const size_t max_bytes, const OUTBOUND_POLICY policy);
+        const outbound_stats get_outbound_stats() const;
         int process_outbound_message(std::string_view message);
         void process_outbound_msg_queue();
         void check_last_activity_rules();
@@ -31,8 +31,27 @@ namespace conf
     constexpr const char *MODE_PUBLIC = "public";
     constexpr const char *MODE_PRIVATE = "private";
 
+    // Defaults of the fields added after MIN_CONFIG_VERSION. Used for new configs and when the field is missing.
+    constexpr uint32_t DEFAULT_MESH_COMPRESSION_THRESHOLD = 16 * 1024;
+    constexpr uint32_t DEFAULT_USER_MAX_MSGS_PER_SEC = 0;
+    constexpr uint64_t DEFAULT_USER_MAX_ROUND_INPUT_BYTES = 0;
+    constexpr uint64_t DEFAULT_USER_MAX_OUTBOUND_BYTES = 8 * 1024 * 1024;
+    constexpr const char *DEFAULT_USER_SLOW_CONSUMER_POLICY = "drop_oldest";
+    constexpr uint32_t DEFAULT_USER_INPUT_RELAY_WINDOW = 20;
+    constexpr uint32_t DEFAULT_LOG_METRICS_INTERVAL = 10;
+
     bool init_success = false;
 
+    /**
+     * Reads a config field which may be missing in configs created by older versions.
+     * @return The field value if present. Otherwise the given default value.
+     */
+    template <typename T>
+    T get_field_or_default(const jsoncons::ojson &parent, const char *name, const T default_value)
+    {
+        return parent.contains(name) ? parent[name].as<T>() : default_value;
+    }
+
     /**
      * Loads and initializes the config for execution. Must be called once during application startup.
      * @return 0 for success. -1 for failure.
@@ -182,9 +201,15 @@ namespace conf
             cfg.mesh.idle_timeout = 120000;
             cfg.mesh.peer_discovery.enabled = true;
             cfg.mesh.peer_discovery.interval = 30000;
+            cfg.mesh.compression_threshold = DEFAULT_MESH_COMPRESSION_THRESHOLD;
 
             cfg.user.port = 8080;
             cfg.user.idle_timeout = 0;
+            cfg.user.max_msgs_per_sec = DEFAULT_USER_MAX_MSGS_PER_SEC;
+            cfg.user.max_round_input_bytes = DEFAULT_USER_MAX_ROUND_INPUT_BYTES;
+            cfg.user.max_outbound_bytes = DEFAULT_USER_MAX_OUTBOUND_BYTES;
+            cfg.user.slow_consumer_policy = DEFAULT_USER_SLOW_CONSUMER_POLICY;
+            cfg.user.input_relay_window = DEFAULT_USER_INPUT_RELAY_WINDOW;
 
             cfg.hpfs.log.log_level = "wrn";
 
@@ -193,6 +218,13 @@ namespace conf
             cfg.log.log_level = "inf";
             cfg.log.loggers.emplace("console");
             cfg.log.loggers.emplace("file");
+            cfg.log.metrics_interval = DEFAULT_LOG_METRICS_INTERVAL;
+
+            cfg.threads.consensus_cpus = "";
+            cfg.threads.network_cpus = "";
+            cfg.threads.sync_cpus = "";
+            cfg.threads.contract_cpus = "";
+            cfg.threads.general_cpus = "";
 
             // Save the default settings into the config file.
             if (write_config(cfg) != 0)
@@ -433,6 +465,7 @@ namespace conf
                 cfg.mesh.max_bad_msgs_per_min = mesh["max_bad_msgs_per_min"].as<uint64_t>();
                 cfg.mesh.max_bad_msgsigs_per_min = mesh["max_bad_msgsigs_per_min"].as<uint64_t>();
                 cfg.mesh.max_dup_msgs_per_min = mesh["max_dup_msgs_per_min"].as<uint64_t>();
+                cfg.mesh.compression_threshold = get_field_or_default(mesh, "compression_threshold", DEFAULT_MESH_COMPRESSION_THRESHOLD);
 
                 jpath = "mesh.peer_discovery";
                 cfg.mesh.peer_discovery.interval = mesh["peer_discovery"]["interval"].as<uint16_t>();
@@ -455,12 +488,17 @@ namespace conf
                 cfg.user.port = user["port"].as<uint16_t>();
                 cfg.user.listen = user["listen"].as<bool>();
                 cfg.user.idle_timeout = user["idle_timeout"].as<uint32_t>();
-                cfg.user.max_connections = user["max_connections"].as<uint64_t>();
+                cfg.user.max_connections = user["max_connections"].as<uint32_t>();
                 cfg.user.max_in_connections_per_host = user["max_in_connections_per_host"].as<uint64_t>();
                 cfg.user.max_bytes_per_msg = user["max_bytes_per_msg"].as<uint64_t>();
                 cfg.user.max_bytes_per_min = user["max_bytes_per_min"].as<uint64_t>();
                 cfg.user.max_bad_msgs_per_min = user["max_bad_msgs_per_min"].as<uint64_t>();
                 cfg.user.concurrent_read_requests = user["concurrent_read_requests"].as<uint64_t>();
+                cfg.user.max_msgs_per_sec = get_field_or_default(user, "max_msgs_per_sec", DEFAULT_USER_MAX_MSGS_PER_SEC);
+                cfg.user.max_round_input_bytes = get_field_or_default(user, "max_round_input_bytes", DEFAULT_USER_MAX_ROUND_INPUT_BYTES);
+                cfg.user.max_outbound_bytes = get_field_or_default(user, "max_outbound_bytes", DEFAULT_USER_MAX_OUTBOUND_BYTES);
+                cfg.user.slow_consumer_policy = get_field_or_default(user, "slow_consumer_policy", std::string(DEFAULT_USER_SLOW_CONSUMER_POLICY));
+                cfg.user.input_relay_window = get_field_or_default(user, "input_relay_window", DEFAULT_USER_INPUT_RELAY_WINDOW);
             }
             catch (const std::exception &e)
             {
@@ -503,6 +541,31 @@ namespace conf
                 cfg.log.loggers.clear();
                 for (auto &v : log["loggers"].array_range())
                     cfg.log.loggers.emplace(v.as<std::string>());
+                cfg.log.metrics_interval = get_field_or_default(log, "metrics_interval", DEFAULT_LOG_METRICS_INTERVAL);
+            }
+            catch (const std::exception &e)
+            {
+                print_missing_field_error(jpath, e);
+                return -1;
+            }
+        }
+
+        // threads
+        {
+            jpath = "threads";
+
+            try
+            {
+                // Threads are not pinned if the section is missing (configs from older versions).
+                if (d.contains("threads"))
+                {
+                    const jsoncons::ojson &threads = d["threads"];
+                    cfg.threads.consensus_cpus = get_field_or_default(threads, "consensus_cpus", std::string());
+                    cfg.threads.network_cpus = get_field_or_default(threads, "network_cpus", std::string());
+                    cfg.threads.sync_cpus = get_field_or_default(threads, "sync_cpus", std::string());
+                    cfg.threads.contract_cpus = get_field_or_default(threads, "contract_cpus", std::string());
+                    cfg.threads.general_cpus = get_field_or_default(threads, "general_cpus", std::string());
+                }
             }
             catch (const std::exception &e)
             {
@@ -571,6 +634,7 @@ namespace conf
             mesh_config.insert_or_assign("max_bad_msgs_per_min", cfg.mesh.max_bad_msgs_per_min);
             mesh_config.insert_or_assign("max_bad_msgsigs_per_min", cfg.mesh.max_bad_msgsigs_per_min);
             mesh_config.insert_or_assign("max_dup_msgs_per_min", cfg.mesh.max_dup_msgs_per_min);
+            mesh_config.insert_or_assign("compression_threshold", cfg.mesh.compression_threshold);
 
             jsoncons::ojson peer_discovery_config;
             peer_discovery_config.insert_or_assign("enabled", cfg.mesh.peer_discovery.enabled);
@@ -592,6 +656,11 @@ namespace conf
             user_config.insert_or_assign("max_connections", cfg.user.max_connections);
             user_config.insert_or_assign("max_in_connections_per_host", cfg.user.max_in_connections_per_host);
             user_config.insert_or_assign("concurrent_read_requests", cfg.user.concurrent_read_requests);
+            user_config.insert_or_assign("max_msgs_per_sec", cfg.user.max_msgs_per_sec);
+            user_config.insert_or_assign("max_round_input_bytes", cfg.user.max_round_input_bytes);
+            user_config.insert_or_assign("max_outbound_bytes", cfg.user.max_outbound_bytes);
+            user_config.insert_or_assign("slow_consumer_policy", cfg.user.slow_consumer_policy);
+            user_config.insert_or_assign("input_relay_window", cfg.user.input_relay_window);
             d.insert_or_assign("user", user_config);
         }
 
@@ -620,9 +689,21 @@ namespace conf
                 loggers.push_back(logger);
             }
             log_config.insert_or_assign("loggers", loggers);
+            log_config.insert_or_assign("metrics_interval", cfg.log.metrics_interval);
             d.insert_or_assign("log", log_config);
         }
 
+        // Thread placement configs.
+        {
+            jsoncons::ojson threads_config;
+            threads_config.insert_or_assign("consensus_cpus", cfg.threads.consensus_cpus);
+            threads_config.insert_or_assign("network_cpus", cfg.threads.network_cpus);
+            threads_config.insert_or_assign("sync_cpus", cfg.threads.sync_cpus);
+            threads_config.insert_or_assign("contract_cpus", cfg.threads.contract_cpus);
+            threads_config.insert_or_assign("general_cpus", cfg.threads.general_cpus);
+            d.insert_or_assign("threads", threads_config);
+        }
+
         return write_json_file(ctx.config_file, d);
     }
 
@@ -667,6 +748,13 @@ namespace conf
             return -1;
         }
 
+        const std::unordered_set<std::string> valid_slow_consumer_policies({"drop_oldest", "coalesce", "disconnect"});
+        if (valid_slow_consumer_policies.count(cfg.user.slow_consumer_policy) != 1)
+        {
+            std::cerr << "Invalid user slow_consumer_policy configured. Valid values: drop_oldest|coalesce|disconnect\n";
+            return -1;
+        }
+
         // Log settings
         const std::unordered_set<std::string> valid_loglevels({"dbg", "inf", "wrn", "err"});
         if (valid_loglevels.count(cfg.log.log_level) != 1)
@@ -690,6 +778,18 @@ namespace conf
             }
         }
 
+        // Thread placement settings
+        for (const std::string *cpu_list : {&cfg.threads.consensus_cpus, &cfg.threads.network_cpus, &cfg.threads.sync_cpus,
+                                            &cfg.threads.contract_cpus, &cfg.threads.general_cpus})
+        {
+            std::set<uint32_t> cpus;
+            if (util::parse_cpu_list(cpus, *cpu_list) == -1)
+            {
+                std::cerr << "Invalid threads cpu list '" << *cpu_list << "'. Expected format: 0-3,8\n";
+                return -1;
+            }
+        }
+
         // Sign and verify a sample message to ensure we have a matching signing key pair.
         const std::string msg = "hotpocket";
         const std::string sig = crypto::sign(msg, cfg.node.private_key);
@@ -216,9 +216,14 @@ namespace conf
         uint64_t max_bytes_per_msg = 0;           // User message max size in bytes
         uint64_t max_bytes_per_min = 0;           // User message rate (characters(bytes) per minute)
         uint64_t max_bad_msgs_per_min = 0;        // User bad messages per minute
-        uint16_t max_connections = 0;             // Max inbound user connections
+        uint32_t max_connections = 0;             // Max authenticated user connections (0 means unlimited).
         uint16_t max_in_connections_per_host = 0; // Max inbound user connections per remote host (IP).
         uint64_t concurrent_read_requests = 4;    // Supported concurrent read requests count.
+        uint32_t max_msgs_per_sec = 0;            // Max messages accepted per second from a single user (0 means unlimited).
+        uint64_t max_round_input_bytes = 0;       // Max total user input bytes relayed by this node per round (0 means unlimited).
+        uint64_t max_outbound_bytes = 0;          // Max bytes queued to be sent to a single user (0 means unlimited).
+        std::string slow_consumer_policy;         // Policy when a user exceeds max_outbound_bytes (drop_oldest | coalesce | disconnect).
+        uint32_t input_relay_window = 0;          // Micro-batch window ms for relaying user inputs to peers as they arrive (0 means relay only at stages 0 and 2).
     };
 
     struct peer_discovery_config
@@ -242,6 +247,7 @@ namespace conf
         uint64_t max_bad_msgs_per_min = 0;        // Peer bad messages per minute.
         uint64_t max_bad_msgsigs_per_min = 0;     // Peer bad signatures per minute.
         uint64_t max_dup_msgs_per_min = 0;        // Peer max duplicate messages per minute.
+        uint32_t compression_threshold = 0;       // Min size in bytes of bulk peer messages to be compressed. 0 disables outbound compression.
         peer_discovery_config peer_discovery;     // Peer discovery configs.
     };
 
@@ -298,6 +304,17 @@ namespace conf
         std::unordered_set<std::string> loggers; // List of enabled loggers (console, file)
         size_t max_mbytes_per_file = 0;          // Max MB size of a single log file.
         size_t max_file_count = 0;               // Max no. of log files to keep.
+        uint32_t metrics_interval = 0;           // Interval in seconds to export metrics into the log directory. 0 disables metrics export.
+    };
+
+    // Cpu lists (eg. "0-3,8") which each class of HotPocket threads are pinned to. Empty means unpinned.
+    struct threads_config
+    {
+        std::string consensus_cpus; // Consensus thread.
+        std::string network_cpus;   // Peer/user comm servers and session threads.
+        std::string sync_cpus;      // Hpfs sync, serve and log sync threads.
+        std::string contract_cpus;  // Contract processes and their monitor threads.
+        std::string general_cpus;   // Everything else (log writer, read requests, metrics, hashing).
     };
 
     struct health_config
@@ -315,6 +332,7 @@ namespace conf
         user_config user;
         hpfs_config hpfs;
         log_config log;
+        threads_config threads;
         health_config health; // For debugging only. Not included in the config file.
     };
 
@@ -3,6 +3,7 @@
 #include "util/rollover_hashset.hpp"
 #include "usr/usr.hpp"
 #include "usr/user_input.hpp"
+#include "usr/user_dispatcher.hpp"
 #include "p2p/p2p.hpp"
 #include "msg/fbuf/p2pmsg_conversion.hpp"
 #include "msg/usrmsg_parser.hpp"
@@ -18,7 +19,9 @@
 #include "consensus.hpp"
 #include "sc/hpfs_log_sync.hpp"
 #include "status.hpp"
+#include "metrics.hpp"
 #include "killswitch/killswitch.h"
+#include "thread_placement.hpp"
 
 namespace p2pmsg = msg::fbuf::p2pmsg;
 
@@ -38,9 +41,15 @@ namespace consensus
     {
         refresh_time_config(false);
 
+        metrics::register_gauge_callback("hp_consensus_arena_allocs", "Stage working set allocations served by the stage arena.", []() { return (int64_t)ctx.stage_arena.get_allocations(); });
+        metrics::register_gauge_callback("hp_consensus_arena_heap_allocs", "Heap allocations made by the stage arena after exhausting its buffer.", []() { return (int64_t)ctx.stage_arena.get_upstream_allocations(); });
+
         // Starting consensus processing thread.
         ctx.consensus_thread = std::thread(run_consensus);
 
+        if (conf::cfg.user.input_relay_window > 0)
+            ctx.input_relay_thread = std::thread(input_relay_loop);
+
         init_success = true;
         return 0;
     }
@@ -65,6 +74,9 @@ namespace consensus
             // Joining consensus processing thread.
             if (ctx.consensus_thread.joinable())
                 ctx.consensus_thread.join();
+
+            if (ctx.input_relay_thread.joinable())
+                ctx.input_relay_thread.join();
         }
     }
 
@@ -79,6 +91,7 @@ namespace consensus
     void run_consensus()
     {
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::CONSENSUS, "hp-consensus");
 
         LOG_INFO << "Consensus processor started.";
 
@@ -115,6 +128,14 @@ namespace consensus
 
         LOG_DEBUG << "Started stage " << std::to_string(ctx.stage);
 
+        static metrics::histogram &stage_duration = metrics::get_histogram("hp_consensus_stage_duration_ms", "Processing time of a consensus stage.");
+        static metrics::counter &unreliable_stages = metrics::get_counter("hp_consensus_unreliable_stages_total", "Consensus stages with unreliable votes.");
+        static metrics::counter &desync_stages = metrics::get_counter("hp_consensus_desync_stages_total", "Consensus stages where the node was out of sync.");
+        const metrics::scoped_timer stage_timer(stage_duration);
+
+        // Nothing allocated from the arena outlives a stage.
+        ctx.stage_arena.reset();
+
         const bool was_in_sync = (status::get_vote_status() == status::VOTE_STATUS::SYNCED);
 
         // Throughout consensus, we continously update and prune the candidate proposals for newly
@@ -132,12 +153,13 @@ namespace consensus
         const util::sequence_hash last_primary_shard_id = ledger::ctx.get_last_primary_shard_id();
         const util::sequence_hash last_raw_shard_id = ledger::ctx.get_last_raw_shard_id();
 
-        if (ctx.stage == 0 || ctx.stage == 2)
+        if (ctx.stage == 0 || (ctx.stage == 2 && conf::cfg.user.input_relay_window == 0))
         {
             // Broadcast non-unl proposal (NUP) containing inputs from locally connected users.
             // This is performed at stage 0 so we can to make sure this happens regardless of whether we are in-sync or not.
-            // This is also performed at stage 2, so the next round receives the inputs before it starts.
-            broadcast_nonunl_proposal();
+            // Without the input relay, this is also performed at stage 2, so the next round receives the inputs before it starts.
+            // With the input relay, inputs have already been streamed to peers and stage 0 only seals the round's input set.
+            broadcast_nonunl_proposal(true);
         }
 
         if (ctx.stage == 0)
@@ -147,8 +169,7 @@ namespace consensus
             if (verify_and_populate_candidate_user_inputs(lcl_id.seq_no) == -1)
                 return -1;
 
-            const p2p::proposal p = create_stage0_proposal(state_hash, patch_hash, last_primary_shard_id, last_raw_shard_id);
-            broadcast_proposal(p);
+            broadcast_proposal(create_stage0_proposal(state_hash, patch_hash, last_primary_shard_id, last_raw_shard_id));
 
             ctx.stage = 1; // Transition to next stage.
         }
@@ -157,7 +178,7 @@ namespace consensus
             // Stages 1,2,3
 
             const size_t unl_count = unl::count();
-            vote_counter votes;
+            vote_counter votes(ctx.stage_arena.get());
 
             // Check whether we are in sync with other nodes using the proposals we received.
             status::VOTE_STATUS new_vote_status = status::VOTE_STATUS::UNKNOWN;
@@ -194,6 +215,11 @@ namespace consensus
 
                 LOG_DEBUG << "Vote status: " << new_vote_status;
                 status::set_vote_status(new_vote_status);
+
+                if (new_vote_status == status::VOTE_STATUS::UNRELIABLE)
+                    unreliable_stages.inc();
+                else if (new_vote_status == status::VOTE_STATUS::DESYNC)
+                    desync_stages.inc();
             }
 
             if (new_vote_status == status::VOTE_STATUS::UNRELIABLE)
@@ -216,8 +242,7 @@ namespace consensus
                 if (new_vote_status == status::VOTE_STATUS::SYNCED)
                 {
                     // If we are in sync, vote and broadcast the winning votes to next stage.
-                    const p2p::proposal p = create_stage123_proposal(votes, unl_count, state_hash, patch_hash, last_primary_shard_id, last_raw_shard_id);
-                    broadcast_proposal(p);
+                    broadcast_proposal(create_stage123_proposal(votes, unl_count, state_hash, patch_hash, last_primary_shard_id, last_raw_shard_id));
 
                     // This marks the moment we finish a sync cycle. We are in stage 1 and we just detected that our votes are in sync.
                     if (ctx.stage == 1 && ctx.sync_ongoing)
@@ -242,7 +267,8 @@ namespace consensus
      */
     void attempt_ledger_close()
     {
-        std::map<util::h32, std::vector<p2p::proposal>> proposal_groups; // Stores sets of proposals against grouped by their root hashes.
+        // Stores sets of proposals against grouped by their root hashes.
+        std::pmr::map<util::h32, std::pmr::vector<const p2p::proposal *>> proposal_groups(ctx.stage_arena.get());
         uint32_t stage3_prop_count = 0;                                  // Keep track of the number of stage 3 proposals received.
 
         // Count votes of all stage 3 proposal hashes.
@@ -251,7 +277,7 @@ namespace consensus
             if (cp.stage == 3)
             {
                 stage3_prop_count++;
-                proposal_groups[cp.root_hash].push_back(cp);
+                proposal_groups[cp.root_hash].push_back(&cp);
             }
         }
 
@@ -267,7 +293,7 @@ namespace consensus
         // Find the winning hash and no. of votes for it.
         uint32_t winning_votes = 0;
         util::h32 winning_hash = util::h32_empty;
-        for (const auto [hash, proposals] : proposal_groups)
+        for (const auto &[hash, proposals] : proposal_groups)
         {
             if (proposals.size() > winning_votes)
             {
@@ -283,9 +309,9 @@ namespace consensus
         }
 
         // Consensus reached. This is the winning set of proposals.
-        std::vector<p2p::proposal> &winning_group = proposal_groups[winning_hash];
+        const std::pmr::vector<const p2p::proposal *> &winning_group = proposal_groups[winning_hash];
 
-        p2p::proposal &winning_prop = winning_group.front();
+        const p2p::proposal &winning_prop = *winning_group.front();
         LOG_DEBUG << "Closing ledger with proposal:" << winning_prop.root_hash;
 
         // Upon successful ledger close condition, update the ledger and execute the contract using the consensus proposal.
@@ -306,7 +332,7 @@ namespace consensus
      * @param cons_prop The proposal which reached consensus.
      * @param consensed_users Set of consensed users and their consensed inputs and outputs.
      */
-    int commit_consensus_results(const p2p::proposal &cons_prop, const consensus::consensed_user_map &consensed_users)
+    int commit_consensus_results(const p2p::proposal &cons_prop, consensus::consensed_user_map &consensed_users)
     {
         // Creating a ledger while sync ongoing happens when we discover that our ledger votes are in sync at stage 2 or 3. At this point,
         // we can create the ledger with majority votes. However we dont't have the raw contract outputs we should have had in the previous ledger
@@ -316,9 +342,16 @@ namespace consensus
         // Sync cycle is considered trully complete after the raw ledger is synced again and we discover in next round Stage 1 that our ledger votes
         // are in sync.
 
+        static metrics::histogram &ledger_write_duration = metrics::get_histogram("hp_ledger_write_ms", "Time taken to persist a new ledger.");
+        static metrics::counter &ledgers_created = metrics::get_counter("hp_ledgers_created_total", "No. of ledgers created.");
+
         // Persist the new ledger with the consensus results.
-        if (ledger::update_ledger(cons_prop, consensed_users, ctx.sync_ongoing) == -1)
-            return -1;
+        {
+            const metrics::scoped_timer timer(ledger_write_duration);
+            if (ledger::update_ledger(cons_prop, consensed_users, ctx.sync_ongoing) == -1)
+                return -1;
+        }
+        ledgers_created.inc();
 
         util::sequence_hash lcl_id = ledger::ctx.get_lcl_id();
 
@@ -524,14 +557,14 @@ namespace consensus
                               << " p:" << cp.patch_hash
                               << " ps:" << cp.last_primary_shard_id
                               << " rs:" << cp.last_raw_shard_id
-                              << " [frm:" << (cp.from_self ? "self" : util::to_hex(cp.pubkey).substr(2, 8))
+                              << " [frm:" << (cp.from_self ? "self" : util::to_hex(std::string_view(cp.pubkey).substr(1, 4)))
                               << "<" << (cp.recv_timestamp > cp.sent_timestamp ? (cp.recv_timestamp - cp.sent_timestamp) : 0) << "ms]";
                 }
                 else
                 {
                     LOG_DEBUG << "Erased [s" << std::to_string(cp.stage)
                               << "-" << cp.root_hash
-                              << "] [frm:" << (cp.from_self ? "self" : util::to_hex(cp.pubkey).substr(2, 8)) << "]";
+                              << "] [frm:" << (cp.from_self ? "self" : util::to_hex(std::string_view(cp.pubkey).substr(1, 4))) << "]";
                 }
 
                 if (keep_candidate)
@@ -553,12 +586,12 @@ namespace consensus
         int ret = 0;
 
         // Populate the users map with all consensed users regardless of whether they have inputs or not.
-        for (const std::string &pubkey : cons_prop.users)
-            consensed_users.try_emplace(pubkey, consensed_user{});
+        for (const util::pk33 &pubkey : cons_prop.users)
+            consensed_users.try_emplace(std::string(pubkey.to_string_view()), consensed_user{});
 
         // Prepare consensed user input set by joining consensus proposal input ordered hashes and candidate user input set.
         // consensed inputs are removed from the candidate set.
-        for (const std::string &ordered_hash : cons_prop.input_ordered_hashes)
+        for (const util::h40 &ordered_hash : cons_prop.input_ordered_hashes)
         {
             // For each consensus input ordered hash, we need to find the candidate input.
             const auto itr = ctx.candidate_user_inputs.find(ordered_hash);
@@ -585,7 +618,7 @@ namespace consensus
         // However, do not perform the safety matching check if we have just completed a sync cycle as we will not possess the outputs
         // generated during the previous ledger.
         {
-            if (ctx.sync_ongoing || cons_prop.output_hash == ctx.user_outputs_hashtree.root_hash())
+            if (ctx.sync_ongoing || cons_prop.output_hash.to_string_view() == ctx.user_outputs_hashtree.root_hash())
             {
                 for (const auto &[hash, gen_output] : ctx.generated_user_outputs)
                 {
@@ -618,7 +651,7 @@ namespace consensus
         {
             if (itr->second.max_ledger_seq_no <= lcl_id.seq_no)
             {
-                const std::string input_hash = std::string(util::get_string_suffix(itr->first, BLAKE3_OUT_LEN));
+                const std::string input_hash = std::string(util::get_string_suffix(itr->first.to_string_view(), BLAKE3_OUT_LEN));
                 rejections[itr->second.user_pubkey].push_back(usr::input_status_response{input_hash, msg::usrmsg::REASON_MAX_LEDGER_EXPIRED});
 
                 // Erase the candidate input along with its data buffer in the input store.
@@ -724,53 +757,156 @@ namespace consensus
     }
 
     /**
-     * Broadcasts any inputs from locally connected users via an NUP.
+     * Relays inputs submitted by locally connected users to peers every input relay window, so the inputs
+     * reach peers shortly after they arrive rather than at the next stage 0 or 2.
      */
-    void broadcast_nonunl_proposal()
+    void input_relay_loop()
     {
-        p2p::nonunl_proposal nup;
+        util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::NETWORK, "hp-input-relay");
+
+        LOG_INFO << "Input relay started. Window: " << conf::cfg.user.input_relay_window << "ms";
 
+        while (!ctx.is_shutting_down)
         {
-            // Populate users and inputs to the NUP within user lock.
-            std::scoped_lock lock(usr::ctx.users_mutex);
+            util::sleep(conf::cfg.user.input_relay_window);
+            broadcast_nonunl_proposal(false);
+        }
 
-            if (usr::ctx.users.empty())
-                return;
+        LOG_INFO << "Input relay stopped.";
+    }
 
-            // Construct NUP.
-            for (auto &[sid, user] : usr::ctx.users)
-            {
-                std::list<usr::submitted_user_input> user_inputs;
-                user_inputs.splice(user_inputs.end(), user.submitted_inputs);
-                user.collected_input_size = 0; // Reset the collected inputs size counter.
+    /**
+     * Broadcasts any inputs from locally connected users via an NUP.
+     * @param seal Whether this NUP closes the input collection of the round. Sealing NUPs also announce connected
+     *             users without inputs and reset the per round input accounting. Without the input relay every NUP
+     *             is a sealing NUP. With the input relay, idle users already announced via relayed inputs since
+     *             the last seal are left out.
+     */
+    void broadcast_nonunl_proposal(const bool seal)
+    {
+        static metrics::counter &relayed_nups = metrics::get_counter("hp_input_relay_nups_total", "NUPs sent by the input relay between seals.");
+
+        if (usr::ctx.users.empty())
+            return;
+
+        std::scoped_lock<std::mutex> relay_lock(ctx.input_relay_mutex);
+
+        const bool is_relay_enabled = conf::cfg.user.input_relay_window > 0;
+        p2p::nonunl_proposal nup;
+        const size_t max_input_bytes = conf::cfg.user.max_round_input_bytes;
+        size_t &nup_input_bytes = ctx.relayed_input_bytes;
+        if (!is_relay_enabled)
+            nup_input_bytes = 0;
+
+        // Construct NUP. Each user's inputs are moved out under that user's own input lock.
+        // When the total input size is capped, users who stayed within their admission limits (lane 0) are served
+        // before users who got throttled (lane 1). Inputs which don't fit are kept for the next round.
+        nup.user_inputs.reserve(usr::ctx.users.size());
+        for (int lane = 0; lane < 2; lane++)
+        {
+            usr::ctx.users.for_each([&](usr::connected_user &user)
+                                    {
+                                        if (lane != (user.throttled ? 1 : 0))
+                                            return;
+
+                                        std::scoped_lock<std::mutex> lock(user.inputs_mutex);
+                                        if (!seal && user.submitted_inputs.empty())
+                                            return;
+
+                                        // When sealing we should create an entry for each user pubkey, even if the user has no inputs. This is
+                                        // because this data map will be used to track connected users as well in addition to inputs.
+                                        std::list<usr::submitted_user_input> &user_inputs = nup.user_inputs[user.pubkey];
+
+                                        if (max_input_bytes == 0)
+                                        {
+                                            user_inputs.splice(user_inputs.end(), user.submitted_inputs);
+                                        }
+                                        else
+                                        {
+                                            // Take inputs in submission order while they fit.
+                                            while (!user.submitted_inputs.empty())
+                                            {
+                                                const size_t input_size = user.submitted_inputs.front().input_size();
+                                                if (nup_input_bytes + input_size > max_input_bytes)
+                                                    break;
+
+                                                nup_input_bytes += input_size;
+                                                user_inputs.splice(user_inputs.end(), user.submitted_inputs, user.submitted_inputs.begin());
+                                            }
+                                        }
+
+                                        if (!user_inputs.empty() && !seal)
+                                            ctx.relayed_users.emplace(user.pubkey);
+
+                                        // Relayed inputs keep counting towards the user's round budget until the round is sealed.
+                                        if (seal)
+                                        {
+                                            // Deferred inputs count towards the user's budget of the next round.
+                                            user.collected_input_size = 0;
+                                            for (const usr::submitted_user_input &submitted : user.submitted_inputs)
+                                                user.collected_input_size += submitted.input_size();
+
+                                            user.throttled = false;
+                                        }
+                                    });
+        }
 
-                // We should create an entry for each user pubkey, even if the user has no inputs. This is
-                // because this data map will be used to track connected users as well in addition to inputs.
-                nup.user_inputs.try_emplace(user.pubkey, std::move(user_inputs));
+        if (seal)
+        {
+            // Idle users which got announced along with relayed inputs are already known to peers for this round.
+            for (const std::string &pubkey : ctx.relayed_users)
+            {
+                const auto itr = nup.user_inputs.find(pubkey);
+                if (itr != nup.user_inputs.end() && itr->second.empty())
+                    nup.user_inputs.erase(itr);
             }
+            ctx.relayed_users.clear();
+            nup_input_bytes = 0;
         }
+        else
+        {
+            // Drop users none of whose inputs fit within the round input cap.
+            for (auto itr = nup.user_inputs.begin(); itr != nup.user_inputs.end();)
+                itr = itr->second.empty() ? nup.user_inputs.erase(itr) : std::next(itr);
+        }
+
+        if (nup.user_inputs.empty())
+            return;
 
         flatbuffers::FlatBufferBuilder fbuf;
         p2pmsg::create_msg_from_nonunl_proposal(fbuf, nup);
-        p2p::broadcast_message(fbuf, true, false, false, 1); // Use high priority send.
+        p2p::broadcast_message(fbuf, false, false, false, 1); // Use high priority send.
+
+        if (!seal)
+            relayed_nups.inc();
 
-        LOG_DEBUG << "NUP sent."
+        LOG_DEBUG << (seal ? "NUP sent." : "NUP relayed.")
                   << " users:" << nup.user_inputs.size();
+
+        // Deliver the NUP to ourselves directly instead of via the self message queue. This way our own inputs keep
+        // their already decoded input containers and don't need to be decoded again during input verification.
+        p2p::handle_nonunl_proposal_message(std::move(nup));
     }
 
     /**
      * Broadcasts the given proposal to all connected peers if in VALIDATOR mode. Does not send in OBSERVER mode.
-     * @return 0 on success. -1 if no peers to broadcast.
+     * Our own copy of the proposal is delivered directly to the collected proposals.
      */
-    void broadcast_proposal(const p2p::proposal &p)
+    void broadcast_proposal(p2p::proposal p)
     {
         // In observer mode, we do not send out proposals.
         if (conf::cfg.node.role == conf::ROLE::OBSERVER || !conf::cfg.node.is_unl) // If we are a non-unl node, do not broadcast proposals.
             return;
 
+        // The root hash is computed once here. It's signed for the peers and used as-is for our own vote.
+        p.root_hash = p2pmsg::hash_proposal(p);
+        p.pubkey = conf::cfg.node.public_key;
+        p.from_self = true;
+
         flatbuffers::FlatBufferBuilder fbuf;
         p2pmsg::create_msg_from_proposal(fbuf, p);
-        p2p::broadcast_message(fbuf, true, false, conf::cfg.contract.consensus.mode != conf::MODE::PUBLIC, 1); // Use high priority send.
+        p2p::broadcast_message(fbuf, false, false, conf::cfg.contract.consensus.mode != conf::MODE::PUBLIC, 1); // Use high priority send.
 
         LOG_DEBUG << "Proposed-s" << std::to_string(p.stage)
                   << " u/i/t:" << p.users.size()
@@ -780,6 +916,11 @@ namespace consensus
                   << " p:" << p.patch_hash
                   << " ps:" << p.last_primary_shard_id
                   << " rs:" << p.last_raw_shard_id;
+
+        // Deliver the proposal to ourselves directly instead of via the self message queue. This avoids re-parsing,
+        // rehashing and rebuilding our own proposal, which is on the critical path of every stage.
+        p.sent_timestamp = p.recv_timestamp = util::get_epoch_milliseconds();
+        p2p::handle_proposal_message(std::move(p));
     }
 
     /**
@@ -819,6 +960,9 @@ namespace consensus
      */
     int verify_and_populate_candidate_user_inputs(const uint64_t lcl_seq_no)
     {
+        static metrics::counter &accepted_inputs = metrics::get_counter("hp_candidate_inputs_accepted_total", "User inputs accepted as consensus candidates.");
+        static metrics::counter &rejected_inputs = metrics::get_counter("hp_candidate_inputs_rejected_total", "User inputs rejected before consensus.");
+
         // Maintains users and any input-rejected responses we should send to them.
         // Key: user pubkey. Value: List of responses for that user.
         std::unordered_map<std::string, std::vector<usr::input_status_response>> rejections;
@@ -827,15 +971,18 @@ namespace consensus
         // Key: user pubkey, Value: List of inputs from the user.
         std::unordered_map<std::string, std::list<usr::submitted_user_input>> input_groups;
 
+        // Inputs accepted in this round are packed together so their storage can be reclaimed together.
+        usr::input_store.new_generation();
+
         // Move over NUPs collected from the network input groups (grouped by user).
         {
-            std::list<p2p::nonunl_proposal> collected_nups;
+            std::unordered_map<std::string, p2p::nonunl_proposal> collected_nups;
             {
                 std::scoped_lock lock(p2p::ctx.collected_msgs.nonunl_proposals_mutex);
-                collected_nups.splice(collected_nups.end(), p2p::ctx.collected_msgs.nonunl_proposals);
+                collected_nups.swap(p2p::ctx.collected_msgs.nonunl_proposals);
             }
 
-            for (p2p::nonunl_proposal &p : collected_nups)
+            for (auto &[sender, p] : collected_nups)
             {
                 for (auto &[pubkey, sbmitted_inputs] : p.user_inputs)
                 {
@@ -846,22 +993,40 @@ namespace consensus
             }
         }
 
+        // Users are collected in map order and sorted into the candidate users once at the end.
+        std::vector<util::pk33> users;
+        users.reserve(input_groups.size());
+
         for (auto &[pubkey, submitted_inputs] : input_groups)
         {
+            // Ignore malformed pubkeys which can't be a valid user.
+            if (pubkey.size() != sizeof(util::pk33))
+                continue;
+
             // Populate user list with this user's pubkey.
-            ctx.candidate_users.emplace(pubkey);
+            util::pk33 &user_pubkey = users.emplace_back();
+            user_pubkey = pubkey;
 
             std::list<usr::extracted_user_input> extracted_inputs;
 
-            for (const usr::submitted_user_input &submitted_input : submitted_inputs)
+            for (usr::submitted_user_input &submitted_input : submitted_inputs)
             {
                 usr::extracted_user_input extracted = {};
                 const char *reject_reason = usr::extract_submitted_input(pubkey, submitted_input, extracted);
 
                 if (reject_reason == NULL)
+                {
                     extracted_inputs.push_back(std::move(extracted));
+                }
                 else
+                {
+                    // Release chunk uploaded input bytes which were already placed in the input store.
+                    if (!submitted_input.stored_input.is_null())
+                        usr::input_store.purge(submitted_input.stored_input);
+
                     rejections[pubkey].push_back(usr::input_status_response{crypto::get_hash(submitted_input.sig), reject_reason});
+                    rejected_inputs.inc();
+                }
             }
 
             // This will sort the inputs in nonce order so the validation will follow the same order on all nodes.
@@ -874,7 +1039,7 @@ namespace consensus
             for (const usr::extracted_user_input &extracted_input : extracted_inputs)
             {
                 util::buffer_view stored_input; // Contains pointer to the input data stored in memfd accessed by the contract.
-                std::string ordered_hash;
+                util::h40 ordered_hash;
 
                 // Validate the input against all submission criteria.
                 const char *reject_reason = usr::validate_user_input_submission(pubkey, extracted_input, lcl_seq_no, total_input_size, ordered_hash, stored_input);
@@ -882,22 +1047,34 @@ namespace consensus
                 if (reject_reason == NULL && !stored_input.is_null())
                 {
                     // No reject reason means we should go ahead and subject the input to consensus.
-                    ctx.candidate_user_inputs.try_emplace(
+                    const auto [itr, inserted] = ctx.candidate_user_inputs.try_emplace(
                         ordered_hash,
                         candidate_user_input(pubkey, stored_input, extracted_input.max_ledger_seq_no));
+
+                    // Release the stored copy if the same input is already a candidate.
+                    if (!inserted)
+                        usr::input_store.purge(stored_input);
+                    else
+                        accepted_inputs.inc();
+                }
+                else if (reject_reason != NULL && !extracted_input.stored_input.is_null())
+                {
+                    usr::input_store.purge(extracted_input.stored_input);
                 }
 
                 // If the input was rejected we need to inform the user.
                 if (reject_reason != NULL)
                 {
                     // We need to consider the last 32 bytes of each ordered hash to get input hash without the nonce prefix.
-                    const std::string input_hash = std::string(util::get_string_suffix(ordered_hash, BLAKE3_OUT_LEN));
+                    const std::string input_hash = std::string(util::get_string_suffix(ordered_hash.to_string_view(), BLAKE3_OUT_LEN));
                     rejections[pubkey].push_back(usr::input_status_response{std::move(input_hash), reject_reason});
+                    rejected_inputs.inc();
                 }
             }
         }
 
         input_groups.clear();
+        ctx.candidate_users.insert_unordered(users);
 
         usr::send_input_status_responses(rejections);
 
@@ -953,13 +1130,12 @@ namespace consensus
         p.last_primary_shard_id = last_primary_shard_id;
         p.last_raw_shard_id = last_raw_shard_id;
         p.time_config = CURRENT_TIME_CONFIG;
-        p.output_hash.resize(BLAKE3_OUT_LEN); // Default empty hash.
         p.node_nonce = ctx.round_nonce;
 
         const uint64_t time_now = util::get_epoch_milliseconds();
 
         // Collect ordered nonces from all proposals in order to calculate the group nonce.
-        std::set<std::string> node_nonces;
+        std::pmr::set<std::string_view> node_nonces(ctx.stage_arena.get());
 
         // Vote for rest of the proposal fields by looking at candidate proposals.
         for (const auto &[pubkey, cp] : ctx.candidate_proposals)
@@ -970,11 +1146,11 @@ namespace consensus
                 increment(votes.time, cp.time);
 
             // Vote for user pubkeys.
-            for (const std::string &pubkey : cp.users)
+            for (const util::pk33 &pubkey : cp.users)
                 increment(votes.users, pubkey);
 
             // Vote for user inputs (hashes). Only vote for the inputs that are in our candidate_inputs set.
-            for (const std::string &ordered_hash : cp.input_ordered_hashes)
+            for (const util::h40 &ordered_hash : cp.input_ordered_hashes)
                 if (ctx.candidate_user_inputs.count(ordered_hash) > 0)
                     increment(votes.inputs, ordered_hash);
 
@@ -1027,7 +1203,7 @@ namespace consensus
         {
             // If the elected hash is our output hash, then place our output signature in the proposal.
             // We only do this if we are at stage 1 or 2.
-            if (p.output_hash == ctx.user_outputs_hashtree.root_hash())
+            if (p.output_hash.to_string_view() == ctx.user_outputs_hashtree.root_hash())
                 p.output_sig = ctx.user_outputs_our_sig;
         }
         else
@@ -1217,7 +1393,12 @@ namespace consensus
         // Populate contract user bufs.
         feed_user_inputs_to_contract_bufmap(args.userbufs, consensed_users);
 
-        if (sc::execute_contract(ctx.contract_ctx.value()) == -1)
+        static metrics::histogram &execution_duration = metrics::get_histogram("hp_contract_execution_ms", "Consensus contract execution time.");
+        const uint64_t execution_start = util::get_epoch_milliseconds();
+        const int execution_result = sc::execute_contract(ctx.contract_ctx.value());
+        execution_duration.record(util::get_epoch_milliseconds() - execution_start);
+
+        if (execution_result == -1)
         {
             LOG_ERROR << "Consensus contract execution failed.";
             return -1;
@@ -1274,7 +1455,7 @@ namespace consensus
             for (const consensed_user_input &ci : user.consensed_inputs)
             {
                 // We need to consider the last 32 bytes of each ordered hash to get input hash without the nonce prefix.
-                const std::string input_hash = std::string(util::get_string_suffix(ci.ordered_hash, BLAKE3_OUT_LEN));
+                const std::string input_hash = std::string(util::get_string_suffix(ci.ordered_hash.to_string_view(), BLAKE3_OUT_LEN));
                 itr->second.push_back(usr::input_status_response{input_hash, NULL});
             }
         }
@@ -1283,38 +1464,33 @@ namespace consensus
     }
 
     /**
-     * Dispatch any consensus-reached outputs to matching users if they are connected to us locally.
+     * Hands over any consensus-reached outputs of users connected to us locally to the user message dispatcher.
+     * The outputs are moved out of the consensed users map since they are no longer needed after the ledger is updated.
      * @param consensed_users The map of consensed users containing their outputs.
      * @param lcl_id The ledger the outputs got included in.
      */
-    void dispatch_consensed_user_outputs(const consensed_user_map &consensed_users, const util::sequence_hash &lcl_id)
+    void dispatch_consensed_user_outputs(consensed_user_map &consensed_users, const util::sequence_hash &lcl_id)
     {
-        if (!consensed_users.empty())
-        {
-            std::scoped_lock<std::mutex> lock(usr::ctx.users_mutex);
+        usr::contract_output_batch batch;
 
-            for (const auto &[pubkey, cu] : consensed_users)
-            {
-                if (cu.consensed_outputs.outputs.empty())
-                    continue;
-
-                // Find user to send by pubkey.
-                const auto user_itr = usr::ctx.users.find(pubkey);
-                if (user_itr != usr::ctx.users.end()) // match found
-                {
-                    const usr::connected_user &user = user_itr->second;
-                    msg::usrmsg::usrmsg_parser parser(user.protocol);
+        for (auto &[pubkey, cu] : consensed_users)
+        {
+            // Skip users who don't have outputs or aren't connected to us.
+            if (cu.consensed_outputs.outputs.empty() || usr::ctx.users.find(pubkey) == NULL)
+                continue;
 
-                    // Get the collapsed hash tree with this user's output hash remaining independently.
-                    util::merkle_hash_node collapsed_hash_root = ctx.user_outputs_hashtree.collapse(cu.consensed_outputs.hash);
+            // Get the collapsed hash tree with this user's output hash remaining independently.
+            util::merkle_hash_node collapsed_hash_root = ctx.user_outputs_hashtree.collapse(cu.consensed_outputs.hash);
+            batch.users.push_back(usr::user_output_set{pubkey, std::move(cu.consensed_outputs.hash),
+                                                       std::move(cu.consensed_outputs.outputs), std::move(collapsed_hash_root)});
+        }
 
-                    // Send the outputs and signatures to the user.
-                    std::vector<uint8_t> msg;
-                    parser.create_contract_output_container(msg, cu.consensed_outputs.hash, cu.consensed_outputs.outputs, collapsed_hash_root, ctx.user_outputs_unl_sig,
-                                                            lcl_id.seq_no, lcl_id.hash.to_string_view());
-                    user.session.send(msg);
-                }
-            }
+        if (!batch.users.empty())
+        {
+            batch.lcl_seq_no = lcl_id.seq_no;
+            batch.lcl_hash = lcl_id.hash;
+            batch.unl_sig = std::move(ctx.user_outputs_unl_sig);
+            usr::enqueue_contract_outputs(std::move(batch));
         }
 
         cleanup_output_collections();
@@ -1331,7 +1507,7 @@ namespace consensus
         auto itr = ctx.candidate_user_inputs.begin();
         while (itr != ctx.candidate_user_inputs.end())
         {
-            std::string_view ordered_hash = itr->first;
+            std::string_view ordered_hash = itr->first.to_string_view();
             const std::string input_hash = std::string(util::get_string_suffix(ordered_hash, BLAKE3_OUT_LEN));
             std::optional<ledger::ledger_user_input> input;
             std::optional<ledger::ledger_record> ledger;
@@ -1380,22 +1556,33 @@ namespace consensus
      */
     void extract_user_outputs_from_contract_bufmap(sc::contract_bufmap_t &bufmap)
     {
-        for (const auto &[pubkey, bufs] : bufmap)
+        // For each user calculate the total hash of their outputs.
+        // Final hash for user = hash(pubkey + outputs...)
+        // All users' hashes are calculated as a single batch so large outputs get hashed in parallel.
+        std::vector<crypto::hash_job> jobs;
+        for (auto &[pubkey, bufs] : bufmap)
         {
-            // For each user calculate the total hash of their outputs.
-            // Final hash for user = hash(pubkey + outputs...)
-
             if (!bufs.outputs.empty())
             {
                 // Generate hash of all sorted outputs combined with user pubkey.
-                std::vector<std::string_view> to_hash;
-                to_hash.push_back(pubkey);
+                crypto::hash_job &job = jobs.emplace_back();
+                job.parts.push_back(pubkey);
                 for (const sc::contract_output &con_out : bufs.outputs)
-                    to_hash.push_back(con_out.message);
+                    job.parts.push_back(con_out.message);
+            }
+        }
 
+        crypto::get_hashes(jobs);
+
+        auto job_itr = jobs.begin();
+        for (auto &[pubkey, bufs] : bufmap)
+        {
+            if (!bufs.outputs.empty())
+            {
                 ctx.generated_user_outputs.try_emplace(
-                    crypto::get_list_hash(to_hash),
+                    std::move(job_itr->hash),
                     generated_user_output(pubkey, std::move(bufs.outputs)));
+                job_itr++;
             }
         }
         bufmap.clear();
@@ -1407,7 +1594,7 @@ namespace consensus
      * @param candidate The candidate whose vote should be increased by 1.
      */
     template <typename T>
-    void increment(std::map<T, uint32_t> &counter, const T &candidate)
+    void increment(std::pmr::map<T, uint32_t> &counter, const T &candidate)
     {
         if (counter.count(candidate))
             counter[candidate]++;
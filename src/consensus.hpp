@@ -5,6 +5,7 @@
 #include "util/util.hpp"
 #include "util/buffer_store.hpp"
 #include "util/merkle_hash_tree.hpp"
+#include "util/arena.hpp"
 #include "./sc/sc.hpp"
 #include "p2p/p2p.hpp"
 #include "usr/user_input.hpp"
@@ -13,6 +14,9 @@
 
 namespace consensus
 {
+    // Initial size of the arena used for per-stage working sets. Stages exceeding this fall back to the heap.
+    constexpr size_t STAGE_ARENA_SIZE = 1 * 1024 * 1024;
+
     /**
      * Represents a contract input that takes part in consensus.
      * This is used in a map keyed by input ordered hash.
@@ -34,10 +38,10 @@ namespace consensus
      */
     struct consensed_user_input
     {
-        const std::string ordered_hash; // [nonce] + [input signature hash]
-        const util::buffer_view input;  // The input data buffer pointer.
+        const util::h40 ordered_hash;  // [nonce] + [input signature hash]
+        const util::buffer_view input; // The input data buffer pointer.
 
-        consensed_user_input(const std::string &ordered_hash, const util::buffer_view input)
+        consensed_user_input(const util::h40 &ordered_hash, const util::buffer_view input)
             : ordered_hash(ordered_hash), input(input)
         {
         }
@@ -90,12 +94,12 @@ namespace consensus
         std::unordered_map<std::string, const p2p::proposal> candidate_proposals;
 
         // Set of user pubkeys that is said to be connected to the cluster. This will be cleared in each round.
-        std::set<std::string> candidate_users;
+        util::flat_set<util::pk33> candidate_users;
 
         // Map of candidate user inputs with ordered hash as map key. Inputs will stay here until they
         // achieve consensus or expire (due to max_ledger_seq_no). Ordered hash is globally unique among inputs
         // from all users. We will use this map to feed inputs into the contract once consensus is achieved.
-        std::map<std::string, candidate_user_input> candidate_user_inputs;
+        std::map<util::h40, candidate_user_input> candidate_user_inputs;
 
         // Map of outputs generated by the contract with output hash as the map key. Outputs will stay
         // here until the end of the current consensus round. Output hash is globally unique among outputs for
@@ -123,23 +127,41 @@ namespace consensus
         bool is_shutting_down = false;
 
         std::thread consensus_thread;
+        std::thread input_relay_thread; // Relays user inputs to peers as they arrive. Only used if input_relay_window is set.
+
+        // Input relay state since the last seal. Guarded by input_relay_mutex, which also keeps NUPs in input order.
+        std::unordered_set<std::string> relayed_users; // Users whose inputs were relayed since the last seal.
+        size_t relayed_input_bytes = 0;                // Input bytes relayed since the last seal.
+        std::mutex input_relay_mutex;
 
-        consensus_context() : user_outputs_hashtree(16)
+        // Arena for the temporary vote tallies and groupings of a stage. Reset at the start of each stage.
+        util::arena stage_arena;
+
+        consensus_context() : user_outputs_hashtree(16), stage_arena(STAGE_ARENA_SIZE)
         {
         }
     };
 
+    /**
+     * Vote tallies of a stage. Allocated from the stage arena.
+     */
     struct vote_counter
     {
-        std::map<uint64_t, uint32_t> time;
-        std::map<std::string, uint32_t> lcl;
-        std::map<std::string, uint32_t> users;
-        std::map<std::string, uint32_t> inputs;
-        std::map<std::string, uint32_t> output_hash;
-        std::map<util::h32, uint32_t> state_hash;
-        std::map<util::h32, uint32_t> patch_hash;
-        std::map<util::sequence_hash, uint32_t> last_ledger_primary_shard;
-        std::map<util::sequence_hash, uint32_t> last_ledger_raw_shard;
+        std::pmr::map<uint64_t, uint32_t> time;
+        std::pmr::map<std::string, uint32_t> lcl;
+        std::pmr::map<util::pk33, uint32_t> users;
+        std::pmr::map<util::h40, uint32_t> inputs;
+        std::pmr::map<util::h32, uint32_t> output_hash;
+        std::pmr::map<util::h32, uint32_t> state_hash;
+        std::pmr::map<util::h32, uint32_t> patch_hash;
+        std::pmr::map<util::sequence_hash, uint32_t> last_ledger_primary_shard;
+        std::pmr::map<util::sequence_hash, uint32_t> last_ledger_raw_shard;
+
+        vote_counter(std::pmr::memory_resource *mr)
+            : time(mr), lcl(mr), users(mr), inputs(mr), output_hash(mr), state_hash(mr), patch_hash(mr),
+              last_ledger_primary_shard(mr), last_ledger_raw_shard(mr)
+        {
+        }
 
         void reset()
         {
@@ -169,7 +191,7 @@ namespace consensus
 
     void attempt_ledger_close();
 
-    int commit_consensus_results(const p2p::proposal &cons_prop, const consensus::consensed_user_map &consensed_users);
+    int commit_consensus_results(const p2p::proposal &cons_prop, consensus::consensed_user_map &consensed_users);
 
     status::VOTE_STATUS check_vote_status(const size_t unl_count, vote_counter &votes, const util::sequence_hash &lcl_id);
 
@@ -185,7 +207,9 @@ namespace consensus
 
     bool wait_and_proceed_stage();
 
-    void broadcast_nonunl_proposal();
+    void input_relay_loop();
+
+    void broadcast_nonunl_proposal(const bool seal);
 
     bool push_npl_message(const p2p::npl_message &npl_message);
 
@@ -197,7 +221,7 @@ namespace consensus
     p2p::proposal create_stage123_proposal(vote_counter &votes, const size_t unl_count, const util::h32 &state_hash, const util::h32 &patch_hash,
                                            const util::sequence_hash &last_primary_shard_id, const util::sequence_hash &last_raw_shard_id);
 
-    void broadcast_proposal(const p2p::proposal &p);
+    void broadcast_proposal(p2p::proposal p);
 
     bool check_last_primary_shard_hash_votes(bool &is_desync, util::sequence_hash &majority_primary_shard_id, vote_counter &votes, const size_t unl_count);
 
@@ -217,7 +241,7 @@ namespace consensus
 
     void dispatch_consensed_user_input_responses(const consensed_user_map &consensed_users, const util::sequence_hash &lcl_id);
 
-    void dispatch_consensed_user_outputs(const consensed_user_map &consensed_users, const util::sequence_hash &lcl_id);
+    void dispatch_consensed_user_outputs(consensed_user_map &consensed_users, const util::sequence_hash &lcl_id);
 
     void dispatch_synced_ledger_input_statuses(const util::sequence_hash &lcl_id);
 
@@ -226,7 +250,7 @@ namespace consensus
     void extract_user_outputs_from_contract_bufmap(sc::contract_bufmap_t &bufmap);
 
     template <typename T>
-    void increment(std::map<T, uint32_t> &counter, const T &candidate);
+    void increment(std::pmr::map<T, uint32_t> &counter, const T &candidate);
 
     int get_initial_state_hash(util::h32 &hash);
 
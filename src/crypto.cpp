@@ -1,9 +1,41 @@
 #include "pchheader.hpp"
 #include "crypto.hpp"
 #include "util/util.hpp"
+#include "util/h32.hpp"
+#include "util/work_pool.hpp"
+#include "thread_placement.hpp"
+#include "metrics.hpp"
 
 namespace crypto
 {
+    /**
+     * Bounded set of (pubkey, signature, message) combinations which are known to have passed verification.
+     * Split into lock-striped shards keyed by the entry digest. Each shard evicts in first-in-first-out order.
+     */
+    struct verify_cache_shard
+    {
+        std::unordered_set<util::h32, util::h32_std_key_hasher> entries;
+        std::list<util::h32> order;
+        std::mutex mutex;
+    };
+
+    std::array<verify_cache_shard, VERIFY_CACHE_SHARD_COUNT> verify_cache;
+
+    struct verify_cache_metrics
+    {
+        metrics::counter &hits = metrics::get_counter("hp_verify_cache_hits_total", "Signature verifications served from the cache.");
+        metrics::counter &misses = metrics::get_counter("hp_verify_cache_misses_total", "Signature verifications not found in the cache.");
+        metrics::counter &evictions = metrics::get_counter("hp_verify_cache_evictions_total", "Entries evicted from the signature verification cache.");
+    };
+
+    verify_cache_metrics &get_verify_cache_metrics()
+    {
+        static verify_cache_metrics m;
+        return m;
+    }
+
+    // Worker threads shared by all large hashing batches.
+    util::work_pool hash_pool;
 
     /**
      * Initializes the crypto subsystem. Must be called once during application startup.
@@ -17,6 +49,13 @@ namespace crypto
             return -1;
         }
 
+        // The calling thread also participates in hashing. So we only need the remaining threads as workers.
+        const size_t hash_threads = std::min<size_t>(std::thread::hardware_concurrency(), MAX_HASH_THREADS);
+        hash_pool.init(hash_threads > 1 ? (hash_threads - 1) : 0, []()
+                       { thread_placement::apply(thread_placement::THREAD_CLASS::GENERAL, "hp-hash"); });
+
+        get_verify_cache_metrics();
+
         return 0;
     }
 
@@ -79,6 +118,89 @@ namespace crypto
             reinterpret_cast<const unsigned char *>(pubkey.data() + 1)); // +1 to skip prefix byte.
     }
 
+    /**
+     * Verifies the given signature bytes for the message while remembering successful verifications. The same signed
+     * artifacts (user inputs, proposals, npl messages) are received and checked repeatedly, so repeated verifications
+     * are answered from the cache using a blake3 digest of the pubkey, signature and message hash.
+     * Failed verifications are not cached.
+     * @param msg Message bytes.
+     * @param sig Signature bytes.
+     * @param pubkey Public key bytes.
+     * @return 0 for successful verification. -1 for failure.
+     */
+    int verify_cached(std::string_view msg, std::string_view sig, std::string_view pubkey)
+    {
+        util::h32 key;
+        {
+            std::string digest;
+            digest.resize(BLAKE3_OUT_LEN);
+
+            blake3_hasher hasher;
+            blake3_hasher_init(&hasher);
+            blake3_hasher_update(&hasher, reinterpret_cast<const unsigned char *>(pubkey.data()), pubkey.length());
+            blake3_hasher_update(&hasher, reinterpret_cast<const unsigned char *>(sig.data()), sig.length());
+            const std::string msg_hash = get_hash(msg);
+            blake3_hasher_update(&hasher, reinterpret_cast<const unsigned char *>(msg_hash.data()), msg_hash.length());
+            blake3_hasher_finalize(&hasher, reinterpret_cast<unsigned char *>(digest.data()), digest.length());
+
+            key = digest;
+        }
+
+        verify_cache_metrics &m = get_verify_cache_metrics();
+        verify_cache_shard &shard = verify_cache[key.data[0] % VERIFY_CACHE_SHARD_COUNT];
+
+        {
+            std::scoped_lock<std::mutex> lock(shard.mutex);
+            if (shard.entries.count(key) == 1)
+            {
+                m.hits.inc();
+                return 0;
+            }
+        }
+
+        m.misses.inc();
+
+        // Perform the actual verification without holding the shard lock.
+        if (verify(msg, sig, pubkey) != 0)
+            return -1;
+
+        std::scoped_lock<std::mutex> lock(shard.mutex);
+        if (shard.entries.emplace(key).second)
+        {
+            shard.order.push_back(key);
+
+            // Remove the oldest entry if exceeding the shard's share of the cache size.
+            if (shard.order.size() > (VERIFY_CACHE_SIZE / VERIFY_CACHE_SHARD_COUNT))
+            {
+                shard.entries.erase(shard.order.front());
+                shard.order.pop_front();
+                m.evictions.inc();
+            }
+        }
+
+        return 0;
+    }
+
+    /**
+     * Returns the hit/miss counters and current size of the signature verification cache.
+     */
+    const verify_cache_stats get_verify_cache_stats()
+    {
+        verify_cache_stats stats;
+        const verify_cache_metrics &m = get_verify_cache_metrics();
+        stats.hits = m.hits.get();
+        stats.misses = m.misses.get();
+        stats.evictions = m.evictions.get();
+
+        for (verify_cache_shard &shard : verify_cache)
+        {
+            std::scoped_lock<std::mutex> lock(shard.mutex);
+            stats.size += shard.entries.size();
+        }
+
+        return stats;
+    }
+
     /**
      * Generate random bytes of specified length.
      */
@@ -185,6 +307,54 @@ namespace crypto
     template const std::string get_list_hash<std::set<std::string>>(const std::set<std::string> &str_list);
     template const std::string get_list_hash<std::vector<std::string>>(const std::vector<std::string> &str_list);
     template const std::string get_list_hash<std::vector<std::string_view>>(const std::vector<std::string_view> &str_list);
+    template const std::string get_list_hash<std::pmr::set<std::string_view>>(const std::pmr::set<std::string_view> &str_list);
+
+    /**
+     * Calculates the hashes of a batch of independent hash jobs. Batches which are large enough are split across the
+     * shared hashing worker threads. Each job's hash is identical to what get_list_hash() produces for its parts.
+     * @param jobs The hash jobs. Each job's 'hash' field is populated with the result.
+     */
+    void get_hashes(std::vector<hash_job> &jobs)
+    {
+        size_t total_size = 0;
+        for (const hash_job &job : jobs)
+        {
+            for (std::string_view sv : job.parts)
+                total_size += sv.size();
+        }
+
+        if (jobs.size() < 2 || hash_pool.size() == 0 || total_size < PARALLEL_HASH_MIN_SIZE)
+        {
+            for (hash_job &job : jobs)
+                job.hash = get_list_hash(job.parts);
+            return;
+        }
+
+        // Split the jobs into contiguous groups of roughly equal total size, one group per thread.
+        const size_t group_count = std::min(jobs.size(), hash_pool.size() + 1);
+        const size_t group_target_size = (total_size + group_count - 1) / group_count;
+
+        std::vector<std::function<void()>> tasks;
+        size_t group_start = 0, group_size = 0;
+        for (size_t i = 0; i < jobs.size(); i++)
+        {
+            for (std::string_view sv : jobs[i].parts)
+                group_size += sv.size();
+
+            if (group_size >= group_target_size || i == jobs.size() - 1)
+            {
+                tasks.push_back([&jobs, group_start, group_end = i + 1]()
+                                {
+                                    for (size_t j = group_start; j < group_end; j++)
+                                        jobs[j].hash = get_list_hash(jobs[j].parts);
+                                });
+                group_start = i + 1;
+                group_size = 0;
+            }
+        }
+
+        hash_pool.run(tasks);
+    }
 
     const std::string generate_uuid()
     {
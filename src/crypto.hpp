@@ -13,6 +13,36 @@ namespace crypto
     // Prefix byte to append to ed25519 keys.
     constexpr const unsigned char KEYPFX_ed25519 = 0xED;
 
+    // Max no. of successful signature verifications remembered by the verification cache.
+    constexpr size_t VERIFY_CACHE_SIZE = 65536;
+
+    // No. of independently locked shards the verification cache is split into.
+    constexpr size_t VERIFY_CACHE_SHARD_COUNT = 16;
+
+    // Min. total size of a hashing batch for it to be spread across the hashing worker threads.
+    constexpr size_t PARALLEL_HASH_MIN_SIZE = 1 * 1024 * 1024;
+
+    // Max no. of threads (including the calling thread) used for hashing a batch.
+    constexpr size_t MAX_HASH_THREADS = 8;
+
+    /**
+     * An independent hash calculation within a hashing batch. The hash is calculated over the concatenation of
+     * the parts (same as get_list_hash).
+     */
+    struct hash_job
+    {
+        std::vector<std::string_view> parts;
+        std::string hash;
+    };
+
+    struct verify_cache_stats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t size = 0;
+    };
+
     int init();
 
     void generate_signing_keys(std::string &pubkey, std::string &seckey);
@@ -21,6 +51,10 @@ namespace crypto
 
     int verify(std::string_view msg, std::string_view sig, std::string_view pubkey);
 
+    int verify_cached(std::string_view msg, std::string_view sig, std::string_view pubkey);
+
+    const verify_cache_stats get_verify_cache_stats();
+
     void random_bytes(std::string &result, const size_t len);
 
     const std::string get_hash(std::string_view data);
@@ -32,6 +66,8 @@ namespace crypto
     template <typename T>
     const std::string get_list_hash(const T &str_list);
 
+    void get_hashes(std::vector<hash_job> &jobs);
+
     const std::string generate_uuid();
 
 } // namespace crypto
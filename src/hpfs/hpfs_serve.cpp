@@ -3,11 +3,13 @@
 #include "../util/sequence_hash.hpp"
 #include "../util/util.hpp"
 #include "../p2p/p2p.hpp"
+#include "../p2p/peer_compression.hpp"
 #include "../msg/fbuf/p2pmsg_conversion.hpp"
 #include "../ledger/ledger.hpp"
 #include "../hplog.hpp"
 #include "hpfs_serve.hpp"
 #include "hpfs_sync.hpp"
+#include "../thread_placement.hpp"
 
 namespace p2pmsg = msg::fbuf::p2pmsg;
 
@@ -54,6 +56,7 @@ namespace hpfs
     void hpfs_serve::hpfs_serve_loop()
     {
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::SYNC, "hp-" + std::string(name) + "-serve");
 
         LOG_INFO << "Hpfs " << name << " server started.";
 
@@ -94,20 +97,21 @@ namespace hpfs
                     std::list<flatbuffers::FlatBufferBuilder> fbufs;
                     if (hpfs_serve::generate_sync_responses(fbufs, hr) == 0 && !fbufs.empty())
                     {
+                        // Compress (if applicable) before locking the peer connections.
+                        std::list<p2p::outbound_message> msgs;
+                        for (const flatbuffers::FlatBufferBuilder &fbuf : fbufs)
+                            msgs.emplace_back(fbuf);
+
                         // Find the peer that we should send the sync responses to.
                         std::scoped_lock<std::mutex> lock(p2p::ctx.peer_connections_mutex);
                         const auto peer_itr = p2p::ctx.peer_connections.find(session_id);
 
                         if (peer_itr != p2p::ctx.peer_connections.end())
                         {
-                            comm::comm_session *session = peer_itr->second;
+                            p2p::peer_comm_session *session = peer_itr->second;
 
-                            for (const flatbuffers::FlatBufferBuilder &fbuf : fbufs)
-                            {
-                                std::string_view msg = std::string_view(
-                                    reinterpret_cast<const char *>(fbuf.GetBufferPointer()), fbuf.GetSize());
-                                session->send(msg);
-                            }
+                            for (const p2p::outbound_message &msg : msgs)
+                                session->send(msg.for_session(*session));
                         }
                     }
 
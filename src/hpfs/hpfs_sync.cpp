@@ -7,7 +7,9 @@
 #include "../util/util.hpp"
 #include "../util/h32.hpp"
 #include "../crypto.hpp"
+#include "../metrics.hpp"
 #include "hpfs_sync.hpp"
+#include "../thread_placement.hpp"
 
 namespace p2pmsg = msg::fbuf::p2pmsg;
 
@@ -80,6 +82,7 @@ namespace hpfs
     void hpfs_sync::hpfs_syncer_loop()
     {
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::SYNC, "hp-" + name + "-sync");
         LOG_INFO << "Hpfs " << name << " sync: Worker started.";
 
         // Indicates whether any responses were processed in the previous loop iteration.
@@ -290,12 +293,19 @@ namespace hpfs
      */
     bool hpfs_sync::process_candidate_responses()
     {
+        static metrics::counter &processed_responses = metrics::get_counter("hp_hpfs_sync_responses_processed_total", "Hpfs sync responses applied.");
+        static metrics::counter &mismatched_responses = metrics::get_counter("hp_hpfs_sync_responses_mismatched_total", "Hpfs sync responses skipped due to hash mismatch.");
+        static metrics::counter &received_block_bytes = metrics::get_counter("hp_hpfs_sync_block_bytes_total", "File block bytes applied by hpfs sync.");
+
         // Reset resubmissions counter whenever we have a resposne.
         if (!candidate_hpfs_responses.empty())
             resubmissions_count = 0;
 
         const bool responses_processed = !candidate_hpfs_responses.empty();
 
+        std::unordered_map<const std::string *, util::h32> block_hashes;
+        calculate_file_block_hashes(block_hashes);
+
         for (auto &response : candidate_hpfs_responses)
         {
             if (is_shutting_down)
@@ -333,6 +343,7 @@ namespace hpfs
                 if (!validate_fs_entry_hash(vpath, hash, fs_resp.dir_mode(), peer_fs_entries))
                 {
                     LOG_INFO << "Hpfs " << name << " sync: Skipping mismatched fs entries response from [" << from << "] for " << vpath;
+                    mismatched_responses.inc();
                     continue;
                 }
 
@@ -351,6 +362,7 @@ namespace hpfs
                 if (!validate_file_hashmap_hash(vpath, hash, file_resp.file_mode(), block_hashes, block_hash_count))
                 {
                     LOG_INFO << "Hpfs " << name << " sync: Skipping mismatched hashmap response from [" << from << "] for " << vpath;
+                    mismatched_responses.inc();
                     continue;
                 }
 
@@ -376,20 +388,24 @@ namespace hpfs
                 std::string_view buf = msg::fbuf::flatbuf_bytes_to_sv(block_resp.data());
 
                 // Validate received block data against the hash.
-                if (!validate_file_block_hash(hash, block_id, buf))
+                const auto block_hash_itr = block_hashes.find(&response.second);
+                if (block_hash_itr == block_hashes.end() || block_hash_itr->second.to_string_view() != hash)
                 {
                     LOG_INFO << "Hpfs " << name << " sync: Skipping mismatched block response from [" << from << "] for block_id:" << block_id
                              << " (len:" << buf.length() << ") of " << vpath;
+                    mismatched_responses.inc();
                     continue;
                 }
 
                 LOG_DEBUG << "Hpfs " << name << " sync: Processing block response from [" << from << "] for block_id:" << block_id
                           << " (len:" << buf.length() << ") of " << vpath;
                 handle_file_block_response(vpath, block_id, buf);
+                received_block_bytes.inc(buf.length());
             }
 
             // Now that we have received matching hash and handled it successfully, remove it from the waiting list.
             submitted_requests.erase(pending_resp_itr);
+            processed_responses.inc();
 
             // After handling each response, check whether we have achieved the target hash.
             {
@@ -508,26 +524,50 @@ namespace hpfs
     }
 
     /**
-     * Vadidated the received hash against the received block.
-     * @param hash Received hash.
-     * @param block_id Id of the block.
-     * @param buf Block buffer.
-     * @returns true if hash is valid, otherwise false.
+     * Calculates the data hashes of all the block responses we are waiting for. The hashes are calculated as a single
+     * batch so large blocks get hashed in parallel.
+     * @param block_hashes Map to populate with the calculated hash against each block response message.
      */
-    bool hpfs_sync::validate_file_block_hash(std::string_view hash, const uint32_t block_id, std::string_view buf)
+    void hpfs_sync::calculate_file_block_hashes(std::unordered_map<const std::string *, util::h32> &block_hashes)
     {
-        // Calculate block offset of this block.
-        util::h32 hash_calculated = util::h32_empty;
-        // If file block 0 buf size 0 means the file is empty, So set hash should be empty.
-        if (block_id > 0 || buf.size() > 0)
+        std::vector<crypto::hash_job> jobs;
+        std::vector<const std::string *> job_responses;
+        std::list<std::string> block_offsets; // Holds the offset bytes referred to by the hash jobs.
+
+        for (const auto &response : candidate_hpfs_responses)
         {
+            const p2pmsg::P2PMsg &msg = *p2pmsg::GetP2PMsg(response.second.data());
+            const p2pmsg::HpfsResponseMsg &resp_msg = *msg.content_as_HpfsResponseMsg();
+            if (resp_msg.content_type() != p2pmsg::HpfsResponse_HpfsBlockResponse)
+                continue;
+
+            // No need to hash the blocks we are not waiting for.
+            std::string_view hash = msg::fbuf::flatbuf_bytes_to_sv(resp_msg.hash());
+            std::string_view vpath = msg::fbuf::flatbuf_str_to_sv(resp_msg.path());
+            if (submitted_requests.count(std::string(vpath).append(hash)) == 0)
+                continue;
+
+            const p2pmsg::HpfsBlockResponse &block_resp = *resp_msg.content_as_HpfsBlockResponse();
+            const uint32_t block_id = block_resp.block_id();
+            std::string_view buf = msg::fbuf::flatbuf_bytes_to_sv(block_resp.data());
+
+            // If file block 0 buf size 0 means the file is empty, So set hash should be empty.
+            if (block_id == 0 && buf.empty())
+            {
+                block_hashes[&response.second] = util::h32_empty;
+                continue;
+            }
+
             const off_t block_offset = block_id * hpfs::BLOCK_SIZE;
-            uint8_t bytes[8];
-            util::uint64_to_bytes(bytes, block_offset);
-            std::string_view offset = std::string_view(reinterpret_cast<const char *>(bytes), sizeof(bytes));
-            hash_calculated = crypto::get_hash(offset, buf);
+            std::string_view offset = block_offsets.emplace_back(util::uint64_to_string_bytes(block_offset));
+            jobs.push_back(crypto::hash_job{{offset, buf}, {}});
+            job_responses.push_back(&response.second);
         }
-        return hash_calculated.to_string_view() == hash;
+
+        crypto::get_hashes(jobs);
+
+        for (size_t i = 0; i < jobs.size(); i++)
+            block_hashes[job_responses[i]] = jobs[i].hash;
     }
 
     /**
@@ -109,7 +109,7 @@ namespace hpfs
         bool validate_file_hashmap_hash(std::string_view vpath, std::string_view hash, const mode_t file_mode,
                                         const util::h32 *hashes, const size_t hash_count);
 
-        bool validate_file_block_hash(std::string_view hash, const uint32_t block_id, std::string_view buf);
+        void calculate_file_block_hashes(std::unordered_map<const std::string *, util::h32> &block_hashes);
 
         void request_state_from_peer(const std::string &path, const bool is_file, const int32_t block_id,
                                      const util::h32 expected_hash, std::string &target_pubkey);
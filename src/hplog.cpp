@@ -1,10 +1,30 @@
 #include "pchheader.hpp"
 #include "conf.hpp"
 #include "hplog.hpp"
+#include "util/util.hpp"
+#include "thread_placement.hpp"
 
 namespace hplog
 {
     class plog_formatter;
+    class async_appender;
+
+    constexpr uint32_t WRITER_IDLE_WAIT = 10; // Writer thread sleep time when there are no records to write.
+    constexpr size_t WRITER_BATCH_SIZE = 256;
+
+    /**
+     * A log record captured on the logging thread. Formatting and writing happens on the writer thread.
+     */
+    struct queued_record
+    {
+        plog::Severity severity;
+        plog::util::Time time;
+        plog::util::nstring message;
+    };
+
+    // Original time of the record currently being written by the writer thread. Records handed to the sinks are
+    // re-created on the writer thread, so the formatter takes the timestamp from here instead of the record.
+    const plog::util::Time *writing_record_time = NULL;
 
     // Custom formatter adopted from:
     // https://github.com/SergiusTheBest/plog/blob/master/include/plog/Formatters/TxtFormatter.h
@@ -39,15 +59,17 @@ namespace hplog
 
         static plog::util::nstring format(const plog::Record &record)
         {
+            const plog::util::Time &time = writing_record_time ? *writing_record_time : record.getTime();
+
             tm t;
-            plog::util::localtime_s(&t, &record.getTime().time); // local time
+            plog::util::localtime_s(&t, &time.time); // local time
 
             plog::util::nostringstream ss;
             ss << t.tm_year + 1900 << std::setfill(PLOG_NSTR('0')) << std::setw(2) << t.tm_mon + 1 << std::setfill(PLOG_NSTR('0')) << std::setw(2) << t.tm_mday
                << PLOG_NSTR(" ") << std::setfill(PLOG_NSTR('0')) << std::setw(2) << t.tm_hour
                << PLOG_NSTR(":") << std::setfill(PLOG_NSTR('0')) << std::setw(2) << t.tm_min
                << PLOG_NSTR(":") << std::setfill(PLOG_NSTR('0')) << std::setw(2) << t.tm_sec
-               << PLOG_NSTR(".") << std::setfill(PLOG_NSTR('0')) << std::setw(3) << record.getTime().millitm // Uncomment for millseconds.
+               << PLOG_NSTR(".") << std::setfill(PLOG_NSTR('0')) << std::setw(3) << time.millitm // Uncomment for millseconds.
                << PLOG_NSTR(" ") << PLOG_NSTR("[") << severity_to_string(record.getSeverity())
                << PLOG_NSTR("][hpc] ") << record.getMessage() << PLOG_NSTR("\n");
 
@@ -55,6 +77,119 @@ namespace hplog
         }
     };
 
+    /**
+     * plog appender which only queues the records. A background thread formats the queued records and writes
+     * them to the actual sinks, so logging threads never wait on formatting, file/console io or sink locks.
+     * Records are queued on a lock-free queue which keeps a separate sub-queue per producing thread.
+     */
+    class async_appender : public plog::IAppender
+    {
+    private:
+        moodycamel::ConcurrentQueue<queued_record> records;
+        std::atomic<size_t> queued_count = 0;
+        std::atomic<uint64_t> dropped_count = 0;
+        std::vector<plog::IAppender *> sinks;
+        std::thread writer_thread;
+        std::atomic<bool> is_shutting_down = false;
+        std::atomic<bool> is_stopped = false;
+
+        void write_records(queued_record *batch, const size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                queued_record &qr = batch[i];
+                plog::Record record(qr.severity, "", 0, "", 0, 0);
+                record << qr.message;
+
+                writing_record_time = &qr.time;
+                for (plog::IAppender *sink : sinks)
+                    sink->write(record);
+                writing_record_time = NULL;
+            }
+        }
+
+        void writer_loop()
+        {
+            util::mask_signal();
+            thread_placement::apply(thread_placement::THREAD_CLASS::GENERAL, "hp-log-writer");
+
+            std::vector<queued_record> batch(WRITER_BATCH_SIZE);
+            while (true)
+            {
+                const size_t count = records.try_dequeue_bulk(batch.begin(), WRITER_BATCH_SIZE);
+                if (count > 0)
+                {
+                    queued_count -= count;
+                    write_records(batch.data(), count);
+                }
+
+                const uint64_t dropped = dropped_count.exchange(0);
+                if (dropped > 0)
+                {
+                    queued_record qr{plog::Severity::warning, {}, PLOG_NSTR("Log queue full. Dropped ") + std::to_string(dropped) + PLOG_NSTR(" log records.")};
+                    plog::util::ftime(&qr.time);
+                    write_records(&qr, 1);
+                }
+
+                if (count == 0)
+                {
+                    // Exit only after all queued records have been written.
+                    if (is_shutting_down)
+                        break;
+
+                    util::sleep(WRITER_IDLE_WAIT);
+                }
+            }
+        }
+
+    public:
+        ~async_appender()
+        {
+            stop();
+        }
+
+        void add_sink(plog::IAppender *sink)
+        {
+            sinks.push_back(sink);
+        }
+
+        void start()
+        {
+            writer_thread = std::thread(&async_appender::writer_loop, this);
+        }
+
+        void stop()
+        {
+            is_shutting_down = true;
+            if (writer_thread.joinable())
+                writer_thread.join();
+            is_stopped = true;
+        }
+
+        void write(const plog::Record &record) override
+        {
+            // Once the writer has stopped, any late records are written directly to the sinks.
+            if (is_stopped)
+            {
+                for (plog::IAppender *sink : sinks)
+                    sink->write(record);
+                return;
+            }
+
+            if (queued_count >= MAX_QUEUED_RECORDS)
+            {
+                dropped_count++;
+                return;
+            }
+
+            queued_record qr{record.getSeverity(), record.getTime(), record.getMessage()};
+            if (records.enqueue(std::move(qr)))
+                queued_count++;
+        }
+    };
+
+    async_appender appender;
+
     void init()
     {
         plog::Severity level;
@@ -77,12 +212,28 @@ namespace hplog
         // Take decision to append logger for file / console or both.
         if (conf::cfg.log.loggers.count("console") == 1)
         {
-            logger.addAppender(&consoleAppender);
+            appender.add_sink(&consoleAppender);
         }
 
         if (conf::cfg.log.loggers.count("file") == 1)
         {
-            logger.addAppender(&fileAppender);
+            appender.add_sink(&fileAppender);
         }
+
+        appender.start();
+        logger.addAppender(&appender);
+
+#ifdef HP_STRIP_DEBUG_LOGS
+        if (level == plog::Severity::debug)
+            LOG_WARNING << "Debug log statements are not available in this build.";
+#endif
+    }
+
+    /**
+     * Writes out any queued log records and stops the log writer.
+     */
+    void deinit()
+    {
+        appender.stop();
     }
 } // namespace hplog
\ No newline at end of file
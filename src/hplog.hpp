@@ -3,7 +3,13 @@
 
 namespace hplog
 {
+    // Max no. of log records waiting to be written. Records logged beyond this are dropped instead of
+    // blocking the logging thread.
+    constexpr size_t MAX_QUEUED_RECORDS = 65536;
+
     void init();
+
+    void deinit();
 } // namespace hplog
 
-#endif
\ No newline at end of file
+#endif
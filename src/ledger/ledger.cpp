@@ -226,14 +226,20 @@ namespace ledger
                              const p2p::proposal &proposal, util::sequence_hash &new_lcl_id, ledger_record &ledger)
     {
         // Combined binary hash of consensus user binary pub keys.
-        const std::string user_hash = crypto::get_list_hash(proposal.users);
+        std::vector<std::string_view> user_pubkeys;
+        user_pubkeys.reserve(proposal.users.size());
+        for (const util::pk33 &pubkey : proposal.users)
+            user_pubkeys.push_back(pubkey.to_string_view());
+
+        const std::string user_hash = crypto::get_list_hash(user_pubkeys);
 
         // Combined binary hash of consensus input hashes.
         std::vector<std::string_view> inp_hashes;
+        inp_hashes.reserve(proposal.input_ordered_hashes.size());
 
         // We need to consider the last 32 bytes of each ordered hash to get input hash without the nonce prefix.
-        for (const std::string &o_hash : proposal.input_ordered_hashes)
-            inp_hashes.push_back(util::get_string_suffix(o_hash, BLAKE3_OUT_LEN));
+        for (const util::h40 &o_hash : proposal.input_ordered_hashes)
+            inp_hashes.push_back(util::get_string_suffix(o_hash.to_string_view(), BLAKE3_OUT_LEN));
 
         const std::string input_hash = crypto::get_list_hash(inp_hashes);
 
@@ -250,7 +256,7 @@ namespace ledger
         data.push_back(proposal.group_nonce.to_string_view());
         data.push_back(user_hash);
         data.push_back(input_hash);
-        data.push_back(proposal.output_hash);
+        data.push_back(proposal.output_hash.to_string_view());
 
         // Combined binary hash of data fields. blake3(seq_no + time + state_hash + patch_hash + user_hash + input_hash + output_hash)
         const std::string data_hash = crypto::get_list_hash(data);
@@ -272,7 +278,7 @@ namespace ledger
             std::string(proposal.group_nonce.to_string_view()),
             user_hash,
             input_hash,
-            proposal.output_hash // Merkle root output hash.
+            std::string(proposal.output_hash.to_string_view()) // Merkle root output hash.
         };
 
         if (sqlite::insert_ledger_row(db, ledger) == -1)
@@ -336,8 +342,7 @@ namespace ledger
                         RAW_DATA_RETURN(-1);
 
                     // Write the input to the blob file. Then we save the written offset and blob size in sqlite record.
-                    std::string buf;
-                    usr::input_store.read_buf(cui.input, buf);
+                    const std::string_view buf = usr::input_store.view_buf(cui.input);
                     if (write(in_fd, buf.data(), buf.size()) == -1)
                     {
                         LOG_ERROR << errno << ": Error when writing input blob.";
@@ -345,8 +350,8 @@ namespace ledger
                     }
 
                     // Insert sqlite record.
-                    std::string_view hash = util::get_string_suffix(cui.ordered_hash, BLAKE3_OUT_LEN);
-                    const uint64_t nonce = util::uint64_from_bytes((uint8_t *)cui.ordered_hash.data());
+                    std::string_view hash = util::get_string_suffix(cui.ordered_hash.to_string_view(), BLAKE3_OUT_LEN);
+                    const uint64_t nonce = util::uint64_from_bytes(cui.ordered_hash.data);
 
                     if (sqlite::insert_user_input_record(inputs_stmt, lcl_id.seq_no, pubkey, hash, nonce, in_pos, buf.size()) == -1)
                         RAW_DATA_RETURN(-1);
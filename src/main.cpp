@@ -9,6 +9,8 @@
 #include "crypto.hpp"
 #include "./sc/sc.hpp"
 #include "hplog.hpp"
+#include "metrics.hpp"
+#include "thread_placement.hpp"
 #include "usr/usr.hpp"
 #include "usr/read_req.hpp"
 #include "p2p/p2p.hpp"
@@ -68,6 +70,8 @@ int parse_cmd(int argc, char **argv)
  */
 void deinit()
 {
+    // Metrics exporter is stopped first since its gauges read from the other subsystems.
+    metrics::deinit();
     usr::deinit();
     p2p::deinit();
     read_req::deinit();
@@ -75,6 +79,7 @@ void deinit()
     sc::deinit();
     ledger::deinit();
     conf::deinit();
+    hplog::deinit();
 }
 
 void sig_exit_handler(int signum)
@@ -207,7 +212,9 @@ int main(int argc, char **argv)
                 LOG_INFO << "Public key: " << conf::cfg.node.public_key_hex;
                 LOG_INFO << "Contract: " << conf::cfg.contract.id << " (" << conf::cfg.contract.version << ")";
 
-                if (sc::init() == -1 ||
+                if (thread_placement::init() == -1 ||
+                    metrics::init() == -1 ||
+                    sc::init() == -1 ||
                     ledger::init() == -1 ||
                     unl::init() == -1 ||
                     consensus::init() == -1 ||
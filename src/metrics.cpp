@@ -0,0 +1,310 @@
+#include "pchheader.hpp"
+#include "metrics.hpp"
+#include "conf.hpp"
+#include "hplog.hpp"
+#include "util/util.hpp"
+#include "thread_placement.hpp"
+
+namespace metrics
+{
+    constexpr int FILE_PERMS = 0644;
+    constexpr uint32_t EXPORTER_SLEEP = 100; // Exporter thread shutdown check interval.
+
+    // Percentiles exported for each histogram.
+    constexpr double EXPORTED_PERCENTILES[] = {0.5, 0.9, 0.99, 0.999};
+
+    enum METRIC_TYPE
+    {
+        COUNTER,
+        GAUGE,
+        HISTOGRAM
+    };
+
+    struct metric_entry
+    {
+        METRIC_TYPE type;
+        std::string help;
+        // Only one of below is used based on the metric type. Metric objects never move once registered.
+        std::unique_ptr<counter> counter_metric;
+        std::unique_ptr<gauge> gauge_metric;
+        std::unique_ptr<histogram> histogram_metric;
+        std::function<int64_t()> gauge_callback;
+    };
+
+    // Registered metrics keyed by name. Registration and export lock the registry. Updates never do since callers
+    // hold on to the metric references.
+    std::map<std::string, metric_entry, std::less<>> registry;
+    std::mutex registry_mutex;
+
+    std::thread exporter_thread;
+    std::atomic<bool> is_shutting_down = false;
+
+    //----- histogram
+
+    size_t histogram::bucket_index(const uint64_t value)
+    {
+        if (value < HISTOGRAM_LINEAR_MAX)
+            return value;
+
+        // Position of the highest set bit (>= 4 since value >= 16).
+        const uint64_t exponent = 63 - __builtin_clzll(value);
+        // The 3 bits after the highest set bit pick the sub bucket.
+        const uint64_t sub_bucket = (value >> (exponent - 3)) & (HISTOGRAM_SUB_BUCKETS - 1);
+        return HISTOGRAM_LINEAR_MAX + (exponent - 4) * HISTOGRAM_SUB_BUCKETS + sub_bucket;
+    }
+
+    uint64_t histogram::bucket_upper_bound(const size_t index)
+    {
+        if (index < HISTOGRAM_LINEAR_MAX)
+            return index;
+
+        const uint64_t exponent = ((index - HISTOGRAM_LINEAR_MAX) / HISTOGRAM_SUB_BUCKETS) + 4;
+        const uint64_t sub_bucket = (index - HISTOGRAM_LINEAR_MAX) % HISTOGRAM_SUB_BUCKETS;
+        const uint64_t width = 1ULL << (exponent - 3);
+        return (1ULL << exponent) + (sub_bucket + 1) * width - 1;
+    }
+
+    void histogram::record(const uint64_t value)
+    {
+        buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        count.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t histogram::get_count() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    uint64_t histogram::get_sum() const
+    {
+        return sum.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Returns the upper bound of the bucket which contains the given percentile.
+     * @param percentile Percentile between 0 and 1.
+     */
+    uint64_t histogram::get_percentile(const double percentile) const
+    {
+        uint64_t total = 0;
+        std::array<uint64_t, HISTOGRAM_BUCKET_COUNT> snapshot;
+        for (size_t i = 0; i < HISTOGRAM_BUCKET_COUNT; i++)
+        {
+            snapshot[i] = buckets[i].load(std::memory_order_relaxed);
+            total += snapshot[i];
+        }
+
+        if (total == 0)
+            return 0;
+
+        const uint64_t target = MAX(1, (uint64_t)ceil(percentile * total));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < HISTOGRAM_BUCKET_COUNT; i++)
+        {
+            seen += snapshot[i];
+            if (seen >= target)
+                return bucket_upper_bound(i);
+        }
+
+        return bucket_upper_bound(HISTOGRAM_BUCKET_COUNT - 1);
+    }
+
+    scoped_timer::scoped_timer(histogram &target) : target(target), start(util::get_epoch_milliseconds())
+    {
+    }
+
+    scoped_timer::~scoped_timer()
+    {
+        const uint64_t now = util::get_epoch_milliseconds();
+        target.record(now > start ? (now - start) : 0);
+    }
+
+    //----- registry
+
+    /**
+     * Returns the registry entry of the given name. Registers it if not registered yet.
+     * A name registered again with a different type is a programming error and aborts the process, as the entry
+     * does not hold a metric of the requested type.
+     */
+    metric_entry &get_entry(std::string_view name, std::string_view help, const METRIC_TYPE type)
+    {
+        metric_entry *entry = NULL;
+        {
+            std::scoped_lock<std::mutex> lock(registry_mutex);
+
+            auto itr = registry.find(name);
+            if (itr == registry.end())
+            {
+                itr = registry.try_emplace(std::string(name)).first;
+                metric_entry &new_entry = itr->second;
+                new_entry.type = type;
+                new_entry.help = help;
+                if (type == METRIC_TYPE::COUNTER)
+                    new_entry.counter_metric = std::make_unique<counter>();
+                else if (type == METRIC_TYPE::GAUGE)
+                    new_entry.gauge_metric = std::make_unique<gauge>();
+                else
+                    new_entry.histogram_metric = std::make_unique<histogram>();
+            }
+
+            entry = &itr->second;
+        }
+
+        // Logged outside the registry lock since logging may update metrics.
+        if (entry->type != type)
+        {
+            LOG_ERROR << "Metric " << name << " registered with type " << entry->type << " is requested with type " << type << ".";
+            hplog::deinit(); // Flush the queued log records before aborting.
+            std::abort();
+        }
+
+        return *entry;
+    }
+
+    /**
+     * Returns the counter registered under the given name. Registers it if not registered yet.
+     * Callers are expected to keep the returned reference (eg. in a function-local static) for updates.
+     */
+    counter &get_counter(std::string_view name, std::string_view help)
+    {
+        return *get_entry(name, help, METRIC_TYPE::COUNTER).counter_metric;
+    }
+
+    gauge &get_gauge(std::string_view name, std::string_view help)
+    {
+        return *get_entry(name, help, METRIC_TYPE::GAUGE).gauge_metric;
+    }
+
+    histogram &get_histogram(std::string_view name, std::string_view help)
+    {
+        return *get_entry(name, help, METRIC_TYPE::HISTOGRAM).histogram_metric;
+    }
+
+    /**
+     * Registers a gauge whose value is obtained by invoking the callback at export time. Used for values
+     * that are already tracked elsewhere (eg. queue depths).
+     */
+    void register_gauge_callback(std::string_view name, std::string_view help, std::function<int64_t()> callback)
+    {
+        get_entry(name, help, METRIC_TYPE::GAUGE).gauge_callback = std::move(callback);
+    }
+
+    /**
+     * Generates the Prometheus text exposition of all registered metrics.
+     * Histograms are exported as summaries with fixed percentiles.
+     */
+    const std::string export_text()
+    {
+        std::string text;
+        std::scoped_lock<std::mutex> lock(registry_mutex);
+
+        for (const auto &[name, entry] : registry)
+        {
+            text.append("# HELP ").append(name).append(" ").append(entry.help).append("\n");
+
+            if (entry.type == METRIC_TYPE::COUNTER)
+            {
+                text.append("# TYPE ").append(name).append(" counter\n");
+                text.append(name).append(" ").append(std::to_string(entry.counter_metric->get())).append("\n");
+            }
+            else if (entry.type == METRIC_TYPE::GAUGE)
+            {
+                const int64_t value = entry.gauge_callback ? entry.gauge_callback() : entry.gauge_metric->get();
+                text.append("# TYPE ").append(name).append(" gauge\n");
+                text.append(name).append(" ").append(std::to_string(value)).append("\n");
+            }
+            else
+            {
+                const histogram &h = *entry.histogram_metric;
+                text.append("# TYPE ").append(name).append(" summary\n");
+                for (const double percentile : EXPORTED_PERCENTILES)
+                {
+                    std::ostringstream quantile;
+                    quantile << percentile;
+                    text.append(name).append("{quantile=\"").append(quantile.str()).append("\"} ").append(std::to_string(h.get_percentile(percentile))).append("\n");
+                }
+                text.append(name).append("_sum ").append(std::to_string(h.get_sum())).append("\n");
+                text.append(name).append("_count ").append(std::to_string(h.get_count())).append("\n");
+            }
+        }
+
+        return text;
+    }
+
+    /**
+     * Writes the metrics file. Written to a temp file first and renamed so scrapers never see a partial file.
+     */
+    int write_metrics_file(const std::string &file_path)
+    {
+        const std::string text = export_text();
+        const std::string tmp_path = file_path + ".tmp";
+
+        const int fd = open(tmp_path.data(), O_CREAT | O_RDWR | O_TRUNC, FILE_PERMS);
+        if (fd == -1 || write(fd, text.data(), text.size()) == -1)
+        {
+            LOG_ERROR << errno << ": Error writing metrics file " << tmp_path;
+            if (fd != -1)
+                close(fd);
+            return -1;
+        }
+        close(fd);
+
+        if (rename(tmp_path.data(), file_path.data()) == -1)
+        {
+            LOG_ERROR << errno << ": Error renaming metrics file " << tmp_path;
+            return -1;
+        }
+
+        return 0;
+    }
+
+    void exporter_loop()
+    {
+        util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::GENERAL, "hp-metrics");
+
+        const std::string file_path = conf::ctx.log_dir + "/" + METRICS_FILE_NAME;
+        const uint64_t interval = conf::cfg.log.metrics_interval * 1000;
+        uint64_t last_export = 0;
+
+        LOG_INFO << "Metrics exporter started. " << file_path;
+
+        while (!is_shutting_down)
+        {
+            const uint64_t now = util::get_epoch_milliseconds();
+            if (now - last_export >= interval)
+            {
+                write_metrics_file(file_path);
+                last_export = now;
+            }
+
+            util::sleep(EXPORTER_SLEEP);
+        }
+
+        // Export once more so the file reflects the final state.
+        write_metrics_file(file_path);
+
+        LOG_INFO << "Metrics exporter stopped.";
+    }
+
+    /**
+     * Starts the periodic metrics file export if enabled in config.
+     * @return 0 on success. -1 on failure.
+     */
+    int init()
+    {
+        if (conf::cfg.log.metrics_interval > 0)
+            exporter_thread = std::thread(exporter_loop);
+
+        return 0;
+    }
+
+    void deinit()
+    {
+        is_shutting_down = true;
+        if (exporter_thread.joinable())
+            exporter_thread.join();
+    }
+
+} // namespace metrics
@@ -0,0 +1,103 @@
+#ifndef _HP_METRICS_
+#define _HP_METRICS_
+
+#include "pchheader.hpp"
+
+/**
+ * Node metrics registry. Counters, gauges and latency histograms are updated lock-free from any thread
+ * and periodically exported in Prometheus text format.
+ */
+namespace metrics
+{
+    // Histogram values below this are counted in exact buckets. Larger values are counted in log-linear buckets
+    // (HDR style) with HISTOGRAM_SUB_BUCKETS buckets per power of two, which gives ~12% relative precision.
+    constexpr uint64_t HISTOGRAM_LINEAR_MAX = 16;
+    constexpr uint64_t HISTOGRAM_SUB_BUCKETS = 8;
+    constexpr size_t HISTOGRAM_BUCKET_COUNT = HISTOGRAM_LINEAR_MAX + (64 - 4) * HISTOGRAM_SUB_BUCKETS;
+
+    // Exported metrics file name inside the log directory.
+    constexpr const char *METRICS_FILE_NAME = "metrics.prom";
+
+    class counter
+    {
+    private:
+        std::atomic<uint64_t> value = 0;
+
+    public:
+        void inc(const uint64_t n = 1)
+        {
+            value.fetch_add(n, std::memory_order_relaxed);
+        }
+
+        uint64_t get() const
+        {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    class gauge
+    {
+    private:
+        std::atomic<int64_t> value = 0;
+
+    public:
+        void set(const int64_t v)
+        {
+            value.store(v, std::memory_order_relaxed);
+        }
+
+        void add(const int64_t n)
+        {
+            value.fetch_add(n, std::memory_order_relaxed);
+        }
+
+        int64_t get() const
+        {
+            return value.load(std::memory_order_relaxed);
+        }
+    };
+
+    class histogram
+    {
+    private:
+        std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKET_COUNT> buckets = {};
+        std::atomic<uint64_t> count = 0;
+        std::atomic<uint64_t> sum = 0;
+
+        static size_t bucket_index(const uint64_t value);
+        static uint64_t bucket_upper_bound(const size_t index);
+
+    public:
+        void record(const uint64_t value);
+        uint64_t get_count() const;
+        uint64_t get_sum() const;
+        uint64_t get_percentile(const double percentile) const;
+    };
+
+    /**
+     * Records the elapsed milliseconds into the given histogram when going out of scope.
+     */
+    class scoped_timer
+    {
+    private:
+        histogram &target;
+        const uint64_t start;
+
+    public:
+        scoped_timer(histogram &target);
+        ~scoped_timer();
+    };
+
+    int init();
+    void deinit();
+
+    counter &get_counter(std::string_view name, std::string_view help);
+    gauge &get_gauge(std::string_view name, std::string_view help);
+    histogram &get_histogram(std::string_view name, std::string_view help);
+    void register_gauge_callback(std::string_view name, std::string_view help, std::function<int64_t()> callback);
+
+    const std::string export_text();
+
+} // namespace metrics
+
+#endif
@@ -33,7 +33,8 @@ namespace msg::usrmsg::bson
     void create_status_response(std::vector<uint8_t> &msg)
     {
         const util::sequence_hash lcl_id = status::get_lcl_id();
-        const std::set<std::string> unl = status::get_unl();
+        const std::shared_ptr<const std::set<std::string>> unl_snapshot = status::get_unl();
+        const std::set<std::string> &unl = *unl_snapshot;
         const status::VOTE_STATUS vote_status = status::get_vote_status();
         const bool weakly_connected = status::get_weakly_connected();
 
@@ -68,7 +69,8 @@ namespace msg::usrmsg::bson
         encoder.key(msg::usrmsg::FLD_PEERS);
 
         {
-            const std::set<conf::peer_ip_port> peers = status::get_peers();
+            const std::shared_ptr<const std::set<conf::peer_ip_port>> peers_snapshot = status::get_peers();
+            const std::set<conf::peer_ip_port> &peers = *peers_snapshot;
             const size_t max_peers_count = MIN(MAX_KNOWN_PEERS_INFO, peers.size());
             size_t count = 1;
 
@@ -187,9 +189,19 @@ namespace msg::usrmsg::bson
     }
 
     /**
-     * Constructs a contract output container message.
-     * @param msg Buffer to construct the generated bson message into.
-     *            Message format:
+     * Strips the document length prefix and the terminating null byte from an encoded bson document so the remaining
+     * element list can be spliced into another document.
+     * @param doc Encoded bson document.
+     */
+    void strip_document_frame(std::vector<uint8_t> &doc)
+    {
+        doc.pop_back();
+        doc.erase(doc.begin(), doc.begin() + 4);
+    }
+
+    /**
+     * Constructs the round-common parts of contract output container messages.
+     * The complete message format is:
      *            {
      *              "type": "contract_output",
      *              "ledger_seq_no": <integer>,
@@ -199,51 +211,85 @@ namespace msg::usrmsg::bson
      *              "hash_tree": [<binary merkle hash tree for this round>], // Collapsed merkle tree with user's hash element marked as null. 
      *              "unl_sig": [["<pubkey>", "<sig>"], ...] // Binary UNL pubkeys and signatures of root hash.
      *            }
-     * @param hash This user's combined output hash. [output hash = hash(pubkey+all outputs for the user)]
-     * @param outputs List of outputs for the user.
-     * @param hash_root Root node of the collapsed merkle hash tree for this round.
+     * The unl signature list is serialized once into the tail fragment as a bson element list (without the document
+     * framing). The small ledger fields are kept as values and encoded along with each user's fields.
+     * @param fragments The fragments to populate.
      * @param unl_sig List of unl signatures issued on the root hash. (root hash = merkle root hash of hashes of all users)
      * @param lcl_seq_no Current ledger seq no.
      * @param lcl_hash Current ledger hash.
      */
-    void create_contract_output_container(std::vector<uint8_t> &msg, std::string_view hash, const ::std::vector<std::string> &outputs,
-                                          const util::merkle_hash_node &hash_root, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+    void create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
                                           const uint64_t lcl_seq_no, std::string_view lcl_hash)
     {
-        jsoncons::bson::bson_bytes_encoder encoder(msg);
-        encoder.begin_object();
-        encoder.key(msg::usrmsg::FLD_TYPE);
-        encoder.string_value(msg::usrmsg::MSGTYPE_CONTRACT_OUTPUT);
-        encoder.key(msg::usrmsg::FLD_LEDGER_SEQ_NO);
-        encoder.int64_value(lcl_seq_no);
-        encoder.key(msg::usrmsg::FLD_LEDGER_HASH);
-        encoder.byte_string_value(lcl_hash);
+        fragments.lcl_seq_no = lcl_seq_no;
+        fragments.lcl_hash = lcl_hash;
 
-        encoder.key(msg::usrmsg::FLD_OUTPUTS);
-        encoder.begin_array();
-        for (size_t i = 0; i < outputs.size(); i++)
-            encoder.byte_string_value(outputs[i]);
-        encoder.end_array();
-
-        encoder.key(msg::usrmsg::FLD_OUTPUT_HASH);
-        encoder.byte_string_value(hash);
-
-        encoder.key(msg::usrmsg::FLD_HASH_TREE);
-        populate_output_hash_array(encoder, hash_root);
+        {
+            jsoncons::bson::bson_bytes_encoder encoder(fragments.tail);
+            encoder.begin_object();
+            encoder.key(msg::usrmsg::FLD_UNL_SIG);
+            encoder.begin_array();
+            for (const auto &[pubkey, sig] : unl_sig)
+            {
+                encoder.begin_array();
+                encoder.byte_string_value(pubkey);
+                encoder.byte_string_value(sig);
+                encoder.end_array();
+            }
+            encoder.end_array();
+            encoder.end_object();
+            encoder.flush();
+        }
+        strip_document_frame(fragments.tail);
+    }
 
-        encoder.key(msg::usrmsg::FLD_UNL_SIG);
-        encoder.begin_array();
-        for (const auto &[pubkey, sig] : unl_sig)
+    /**
+     * Constructs a contract output container message. The user's fields are encoded directly into the message buffer
+     * and the round-common tail fragment is appended to the same document.
+     * @param msg Buffer to construct the generated bson message into.
+     * @param fragments Round-common message parts created with create_contract_output_fragments().
+     * @param hash This user's combined output hash. [output hash = hash(pubkey+all outputs for the user)]
+     * @param outputs List of outputs for the user.
+     * @param hash_root Root node of the collapsed merkle hash tree for this round.
+     */
+    void create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                          std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root)
+    {
+        const size_t doc_start = msg.size();
         {
+            jsoncons::bson::bson_bytes_encoder encoder(msg);
+            encoder.begin_object();
+            encoder.key(msg::usrmsg::FLD_TYPE);
+            encoder.string_value(msg::usrmsg::MSGTYPE_CONTRACT_OUTPUT);
+            encoder.key(msg::usrmsg::FLD_LEDGER_SEQ_NO);
+            encoder.int64_value(fragments.lcl_seq_no);
+            encoder.key(msg::usrmsg::FLD_LEDGER_HASH);
+            encoder.byte_string_value(fragments.lcl_hash);
+
+            encoder.key(msg::usrmsg::FLD_OUTPUTS);
             encoder.begin_array();
-            encoder.byte_string_value(pubkey);
-            encoder.byte_string_value(sig);
+            for (size_t i = 0; i < outputs.size(); i++)
+                encoder.byte_string_value(outputs[i]);
             encoder.end_array();
+
+            encoder.key(msg::usrmsg::FLD_OUTPUT_HASH);
+            encoder.byte_string_value(hash);
+
+            encoder.key(msg::usrmsg::FLD_HASH_TREE);
+            populate_output_hash_array(encoder, hash_root);
+            encoder.end_object();
+            encoder.flush();
         }
-        encoder.end_array();
 
-        encoder.end_object();
-        encoder.flush();
+        // Replace the terminating null byte of the encoded document with the tail elements and patch the
+        // document length (int32 little endian) to cover them.
+        msg.pop_back();
+        msg.insert(msg.end(), fragments.tail.begin(), fragments.tail.end());
+        msg.push_back(0);
+
+        const uint32_t doc_len = msg.size() - doc_start;
+        for (int i = 0; i < 4; i++)
+            msg[doc_start + i] = (doc_len >> (8 * i)) & 0xff;
     }
 
     /**
@@ -497,6 +543,30 @@ namespace msg::usrmsg::bson
         return 0;
     }
 
+    /**
+     * Extracts a contract read cancel message sent by user.
+     * 
+     * @param extracted_id The id of the read request to cancel.
+     * @param d The bson document holding the read cancel message.
+     *          Accepted read cancel format:
+     *          {
+     *            "type": "contract_read_cancel",
+     *            "id": "<read request id>"
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_read_cancel(std::string &extracted_id, const jsoncons::ojson &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d[msg::usrmsg::FLD_ID].is<std::string>())
+        {
+            LOG_DEBUG << "Read cancel 'id' field missing or invalid.";
+            return -1;
+        }
+
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        return 0;
+    }
+
     /**
      * Extracts a signed input container message sent by user.
      * 
@@ -535,15 +605,17 @@ namespace msg::usrmsg::bson
      * @param input The extracted input.
      * @param nonce The extracted nonce.
      * @param max_ledger_seq_no The extracted max ledger sequence no.
+     * @param streamed Whether the input is the hash of bytes uploaded in chunks.
      * @param contentjson The bson input container message.
      *                    {
-     *                      "input": <binary buffer>,
+     *                      "input": <binary buffer>, // Hash of the uploaded bytes if streamed.
      *                      "nonce": <integer>, // Indicates input ordering.
-     *                      "max_ledger_seq_no": <integer>
+     *                      "max_ledger_seq_no": <integer>,
+     *                      "streamed": <bool> // Optional. Defaults to false.
      *                    }
      * @return 0 on succesful extraction. -1 on failure.
      */
-    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no, std::string_view contentbson)
+    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no, bool &streamed, std::string_view contentbson)
     {
         jsoncons::ojson d;
         try
@@ -562,7 +634,8 @@ namespace msg::usrmsg::bson
             return -1;
         }
 
-        if (!d[msg::usrmsg::FLD_INPUT].is_byte_string_view() || !d[msg::usrmsg::FLD_NONCE].is_uint64() || !d[msg::usrmsg::FLD_MAX_LEDGER_SEQ_NO].is_uint64())
+        if (!d[msg::usrmsg::FLD_INPUT].is_byte_string_view() || !d[msg::usrmsg::FLD_NONCE].is_uint64() || !d[msg::usrmsg::FLD_MAX_LEDGER_SEQ_NO].is_uint64() ||
+            (d.contains(msg::usrmsg::FLD_STREAMED) && !d[msg::usrmsg::FLD_STREAMED].is_bool()))
         {
             LOG_DEBUG << "User input container invalid field values.";
             return -1;
@@ -576,6 +649,7 @@ namespace msg::usrmsg::bson
         }
 
         max_ledger_seq_no = d[msg::usrmsg::FLD_MAX_LEDGER_SEQ_NO].as<uint64_t>();
+        streamed = d.contains(msg::usrmsg::FLD_STREAMED) && d[msg::usrmsg::FLD_STREAMED].as<bool>();
 
         const jsoncons::byte_string_view &bsv = d[msg::usrmsg::FLD_INPUT].as_byte_string_view();
         input = std::string_view(reinterpret_cast<const char *>(bsv.data()), bsv.size());
@@ -583,6 +657,89 @@ namespace msg::usrmsg::bson
         return 0;
     }
 
+    /**
+     * Extracts the message which starts a chunked contract input upload.
+     * @param extracted_id The user-assigned upload id.
+     * @param extracted_size The total input size the user is going to upload.
+     * @param d The bson document holding the message.
+     *          Accepted message format:
+     *          {
+     *            "type": "contract_input_begin",
+     *            "id": "<any string>",
+     *            "size": <integer> // Total input size in bytes.
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size, const jsoncons::ojson &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d.contains(msg::usrmsg::FLD_SIZE) ||
+            !d[msg::usrmsg::FLD_ID].is<std::string>() || !d[msg::usrmsg::FLD_SIZE].is<uint64_t>())
+        {
+            LOG_DEBUG << "Input upload begin required fields missing or invalid.";
+            return -1;
+        }
+
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        extracted_size = d[msg::usrmsg::FLD_SIZE].as<uint64_t>();
+        return 0;
+    }
+
+    /**
+     * Extracts a chunk of a contract input upload.
+     * @param extracted_id The upload id the chunk belongs to.
+     * @param extracted_data The chunk data. This points into the bson document and is valid as long as the document.
+     * @param d The bson document holding the message.
+     *          Accepted message format:
+     *          {
+     *            "type": "contract_input_chunk",
+     *            "id": "<any string>",
+     *            "data": <binary buffer>
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data, const jsoncons::ojson &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d.contains(msg::usrmsg::FLD_DATA) ||
+            !d[msg::usrmsg::FLD_ID].is<std::string>() || !d[msg::usrmsg::FLD_DATA].is_byte_string_view())
+        {
+            LOG_DEBUG << "Input upload chunk required fields missing or invalid.";
+            return -1;
+        }
+
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        const jsoncons::byte_string_view &bsv = d[msg::usrmsg::FLD_DATA].as_byte_string_view();
+        extracted_data = std::string_view(reinterpret_cast<const char *>(bsv.data()), bsv.size());
+        return 0;
+    }
+
+    /**
+     * Extracts the message which completes a chunked contract input upload.
+     * @param extracted_id The upload id.
+     * @param extracted_input_container The input container extracted from the message.
+     * @param extracted_sig The binary signature extracted from the message.
+     * @param d The bson document holding the message.
+     *          Accepted message format:
+     *          {
+     *            "type": "contract_input_end",
+     *            "id": "<any string>",
+     *            "input_container": <bson serialized input container>, // 'input' holds the hash of the uploaded bytes and 'streamed' is true.
+     *            "sig": <binary signature buffer of the bson serialized content>
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig,
+                                 const jsoncons::ojson &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d[msg::usrmsg::FLD_ID].is<std::string>())
+        {
+            LOG_DEBUG << "Input upload end 'id' field missing or invalid.";
+            return -1;
+        }
+
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        return extract_signed_input_container(extracted_input_container, extracted_sig, d);
+    }
+
     /**
      * Extract ledger event subscription request.
      * @param channel Extracted subscription channel.
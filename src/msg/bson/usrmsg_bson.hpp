@@ -6,6 +6,7 @@
 #include "../../ledger/ledger_query.hpp"
 #include "../../usr/user_common.hpp"
 #include "../../status.hpp"
+#include "../usrmsg_common.hpp"
 
 namespace msg::usrmsg::bson
 {
@@ -19,10 +20,12 @@ namespace msg::usrmsg::bson
 
     void create_contract_read_response_container(std::vector<uint8_t> &msg, std::string_view reply_for, std::string_view content);
 
-    void create_contract_output_container(std::vector<uint8_t> &msg, std::string_view hash, const ::std::vector<std::string> &outputs,
-                                          const util::merkle_hash_node &hash_root, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+    void create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
                                           const uint64_t lcl_seq_no, std::string_view lcl_hash);
 
+    void create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                          std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root);
+
     void create_unl_notification(std::vector<uint8_t> &msg, const ::std::set<std::string> &unl_list);
 
     void create_ledger_created_notification(std::vector<uint8_t> &msg, const ledger::ledger_record &ledger);
@@ -43,11 +46,20 @@ namespace msg::usrmsg::bson
 
     int extract_read_request(std::string &extracted_id, std::string &extracted_content, const jsoncons::ojson &d);
 
+    int extract_read_cancel(std::string &extracted_id, const jsoncons::ojson &d);
+
     int extract_signed_input_container(std::string &extracted_input_container, std::string &extracted_sig,
                                        const jsoncons::ojson &d);
 
-    int extract_input_container(std::string &input, uint64_t &nonce,
-                                uint64_t &max_ledger_seq_no, std::string_view contentbson);
+    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no,
+                                bool &streamed, std::string_view contentbson);
+
+    int extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size, const jsoncons::ojson &d);
+
+    int extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data, const jsoncons::ojson &d);
+
+    int extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig,
+                                 const jsoncons::ojson &d);
 
     int extract_subscription_request(usr::NOTIFICATION_CHANNEL &channel, bool &enabled, const jsoncons::ojson &d);
 
@@ -55,6 +67,8 @@ namespace msg::usrmsg::bson
 
     void populate_output_hash_array(jsoncons::bson::bson_bytes_encoder &encoder, const util::merkle_hash_node &node);
 
+    void strip_document_frame(std::vector<uint8_t> &doc);
+
     void populate_ledger_query_results(jsoncons::bson::bson_bytes_encoder &encoder, const std::vector<ledger::ledger_record> &results);
 
     void populate_ledger_fields(jsoncons::bson::bson_bytes_encoder &encoder, const ledger::ledger_record &ledger);
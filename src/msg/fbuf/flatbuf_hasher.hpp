@@ -3,6 +3,8 @@
 
 #include "../../pchheader.hpp"
 #include "../../util/util.hpp"
+#include "../../util/fixed_bytes.hpp"
+#include "../../p2p/proposal_set.hpp"
 #include "p2pmsg_generated.h"
 
 namespace msg::fbuf::p2pmsg
@@ -42,10 +44,11 @@ namespace msg::fbuf::p2pmsg
             blake3_hasher_update(&hasher, sv.data(), sv.size());
         }
 
-        void add(const std::set<std::string> &sl)
+        template <size_t N>
+        void add(const p2p::proposal_set<N> &set)
         {
-            for(const std::string &s : sl)
-                add(s);
+            for (const util::fixed_bytes<N> &value : set)
+                add(value.to_string_view());
         }
 
         void add(const flatbuffers::Vector<uint8_t> *v)
@@ -3,6 +3,7 @@
 #include "../../unl.hpp"
 #include "../../crypto.hpp"
 #include "../../p2p/p2p.hpp"
+#include "../../usr/usr.hpp"
 #include "common_helpers.hpp"
 #include "flatbuf_hasher.hpp"
 #include "p2pmsg_conversion.hpp"
@@ -52,6 +53,55 @@ namespace msg::fbuf::p2pmsg
         return p2p::peer_message_info{p2p_msg, p2p_msg->content_type(), p2p_msg->created_on()};
     }
 
+    /**
+     * Checks whether all byte arrays of the given vector are exactly N bytes and in strictly ascending order
+     * (the order in which proposals are built).
+     */
+    template <size_t N>
+    bool is_sorted_bytearrayvector(const flatbuffers::Vector<flatbuffers::Offset<ByteArray>> *fbvec)
+    {
+        const uint8_t *prev = NULL;
+        for (const auto el : *fbvec)
+        {
+            if (!el->array() || el->array()->size() != N)
+                return false;
+
+            const uint8_t *current = el->array()->data();
+            if (prev && memcmp(prev, current, N) >= 0)
+                return false;
+            prev = current;
+        }
+        return true;
+    }
+
+    /**
+     * Checks whether a flatbuffer byte vector is present and has exactly the given size.
+     */
+    bool is_fixed_size_bytes(const flatbuffers::Vector<uint8_t> *bytes, const size_t size)
+    {
+        return bytes && bytes->size() == size;
+    }
+
+    /**
+     * Validates the proposal fields which are decoded without further checks. Proposals are built with sorted
+     * unique users and input hashes, so we check the sortedness once on receipt and decoding never has to sort.
+     * @return True if the proposal is well formed. False otherwise.
+     */
+    bool verify_proposal_msg_structure(const p2p::peer_message_info &mi)
+    {
+        const auto &msg = *mi.p2p_msg->content_as_ProposalMsg();
+
+        return msg.pubkey() && msg.sig() &&
+               is_fixed_size_bytes(msg.node_nonce(), sizeof(util::h32)) &&
+               is_fixed_size_bytes(msg.group_nonce(), sizeof(util::h32)) &&
+               is_fixed_size_bytes(msg.state_hash(), sizeof(util::h32)) &&
+               is_fixed_size_bytes(msg.patch_hash(), sizeof(util::h32)) &&
+               msg.last_primary_shard_id() && is_fixed_size_bytes(msg.last_primary_shard_id()->hash(), sizeof(util::h32)) &&
+               msg.last_raw_shard_id() && is_fixed_size_bytes(msg.last_raw_shard_id()->hash(), sizeof(util::h32)) &&
+               (!msg.users() || is_sorted_bytearrayvector<sizeof(util::pk33)>(msg.users())) &&
+               (!msg.input_hashes() || is_sorted_bytearrayvector<sizeof(util::h40)>(msg.input_hashes()));
+    }
+
     /**
      * Validate proposal signature against the hash of proposal fields.
      * @return The proposal hash if verification success. Empty hash of verification failed.
@@ -63,7 +113,7 @@ namespace msg::fbuf::p2pmsg
         std::string_view pubkey = flatbuf_bytes_to_sv(msg.pubkey());
 
         // Before verifying the hash, Validate if the message is from a trusted node.
-        if (!unl::exists(std::string(pubkey)))
+        if (!unl::exists(pubkey))
         {
             LOG_DEBUG << "Peer proposal message pubkey verification failed. Not in UNL.";
             return util::h32_empty;
@@ -71,7 +121,7 @@ namespace msg::fbuf::p2pmsg
 
         // Get hash of proposal data field values and verify the signature against the hash.
         const util::h32 hash = hash_proposal_msg(msg);
-        if (crypto::verify(hash.to_string_view(), flatbuf_bytes_to_sv(msg.sig()), pubkey) == 0)
+        if (crypto::verify_cached(hash.to_string_view(), flatbuf_bytes_to_sv(msg.sig()), pubkey) == 0)
             return hash;
         else
             return util::h32_empty;
@@ -105,7 +155,7 @@ namespace msg::fbuf::p2pmsg
         std::string_view pubkey = flatbuf_bytes_to_sv(msg.pubkey());
 
         // Before verifying the hash, Validate if the message is from a trusted node.
-        if (!unl::exists(std::string(pubkey)))
+        if (!unl::exists(pubkey))
         {
             LOG_INFO << "Peer npl message pubkey verification failed. Not in UNL.";
             return false;
@@ -117,7 +167,7 @@ namespace msg::fbuf::p2pmsg
         hasher.add(msg.lcl_id());
 
         const util::h32 hash = hasher.hash();
-        return crypto::verify(hash.to_string_view(), flatbuf_bytes_to_sv(msg.sig()), pubkey) == 0;
+        return crypto::verify_cached(hash.to_string_view(), flatbuf_bytes_to_sv(msg.sig()), pubkey) == 0;
     }
 
     const p2p::peer_challenge create_peer_challenge_from_msg(const p2p::peer_message_info &mi)
@@ -127,7 +177,8 @@ namespace msg::fbuf::p2pmsg
             std::string(flatbuf_str_to_sv(msg.contract_id())),
             msg.time_config(),
             msg.is_full_history(),
-            std::string(flatbuf_bytes_to_sv(msg.challenge()))};
+            std::string(flatbuf_bytes_to_sv(msg.challenge())),
+            msg.compression()};
     }
 
     const p2p::peer_challenge_response create_peer_challenge_response_from_msg(const p2p::peer_message_info &mi)
@@ -139,7 +190,14 @@ namespace msg::fbuf::p2pmsg
             std::string(flatbuf_bytes_to_sv(msg.pubkey()))};
     }
 
-    const p2p::proposal create_proposal_from_msg(const p2p::peer_message_info &mi, const util::h32 &hash)
+    /**
+     * Creates a proposal from a received proposal message. The proposal keeps the message buffer and reads its users
+     * and input hashes in place, so the message must have passed verify_proposal_msg_structure().
+     * @param mi Message info pointing into the given buffer.
+     * @param hash The proposal hash.
+     * @param buffer The received message buffer.
+     */
+    const p2p::proposal create_proposal_from_msg(const p2p::peer_message_info &mi, const util::h32 &hash, std::shared_ptr<const std::string> buffer)
     {
         const auto &msg = *mi.p2p_msg->content_as_ProposalMsg();
 
@@ -161,13 +219,13 @@ namespace msg::fbuf::p2pmsg
         p.last_raw_shard_id = flatbuf_seqhash_to_seqhash(msg.last_raw_shard_id());
 
         if (msg.users())
-            p.users = flatbuf_bytearrayvector_to_stringlist(msg.users());
+            p.users = p2p::proposal_set<sizeof(util::pk33)>(buffer, msg.users());
 
         if (msg.input_hashes())
-            p.input_ordered_hashes = flatbuf_bytearrayvector_to_stringlist(msg.input_hashes());
+            p.input_ordered_hashes = p2p::proposal_set<sizeof(util::h40)>(buffer, msg.input_hashes());
 
-        if (msg.output_hash())
-            p.output_hash = flatbuf_bytes_to_sv(msg.output_hash());
+        if (msg.output_hash() && msg.output_hash()->size() == sizeof(util::h32))
+            p.output_hash = flatbuf_bytes_to_hash(msg.output_hash());
 
         if (msg.output_sig())
             p.output_sig = flatbuf_bytes_to_sv(msg.output_sig());
@@ -268,14 +326,6 @@ namespace msg::fbuf::p2pmsg
             flatbuf_bytes_to_hash(fbseqhash->hash())};
     }
 
-    const std::set<std::string> flatbuf_bytearrayvector_to_stringlist(const flatbuffers::Vector<flatbuffers::Offset<ByteArray>> *fbvec)
-    {
-        std::set<std::string> set;
-        for (const auto el : *fbvec)
-            set.emplace(std::string(flatbuf_bytes_to_sv(el->array())));
-        return set;
-    }
-
     const std::unordered_map<std::string, std::list<usr::submitted_user_input>>
     flatbuf_user_input_group_to_user_input_map(const flatbuffers::Vector<flatbuffers::Offset<UserInputGroup>> *fbvec)
     {
@@ -287,10 +337,17 @@ namespace msg::fbuf::p2pmsg
 
             for (const auto msg : *group->messages())
             {
-                user_inputs_list.push_back(usr::submitted_user_input{
+                usr::submitted_user_input &submitted = user_inputs_list.emplace_back(usr::submitted_user_input{
                     std::string(flatbuf_bytes_to_sv(msg->input_container())),
                     std::string(flatbuf_bytes_to_sv(msg->sig())),
                     static_cast<util::PROTOCOL>(msg->protocol())});
+
+                // Chunk uploaded inputs carry the input bytes separately from the signed container.
+                if (msg->input())
+                {
+                    submitted.streamed = true;
+                    submitted.streamed_input = flatbuf_bytes_to_sv(msg->input());
+                }
             }
 
             map.emplace(flatbuf_bytes_to_sv(group->pubkey()), std::move(user_inputs_list));
@@ -341,7 +398,11 @@ namespace msg::fbuf::p2pmsg
 
     //---std to Flatbuf---//
 
-    const std::string generate_proposal_signature(const p2p::proposal &p)
+    /**
+     * Generate a hash using the consensus data fields of the given proposal. Produces the same hash as
+     * hash_proposal_msg() for the serialized proposal.
+     */
+    const util::h32 hash_proposal(const p2p::proposal &p)
     {
         flatbuf_hasher hasher;
         hasher.add(p.stage);
@@ -356,8 +417,7 @@ namespace msg::fbuf::p2pmsg
         hasher.add(p.patch_hash);
         hasher.add(p.last_primary_shard_id);
         hasher.add(p.last_raw_shard_id);
-
-        return crypto::sign(hasher.hash().to_string_view(), conf::cfg.node.private_key);
+        return hasher.hash();
     }
 
     const std::string generate_npl_signature(std::string_view data, const util::sequence_hash &lcl_id)
@@ -390,7 +450,8 @@ namespace msg::fbuf::p2pmsg
             sv_to_flatbuf_str(builder, conf::cfg.contract.id),
             CURRENT_TIME_CONFIG,
             conf::cfg.node.history == conf::HISTORY::FULL,
-            sv_to_flatbuf_bytes(builder, challenge));
+            sv_to_flatbuf_bytes(builder, challenge),
+            CompressionType_Deflate); // We always accept compressed messages regardless of our own outbound compression setting.
         create_p2p_msg(builder, P2PMsgContent_PeerChallengeMsg, msg.Union());
     }
 
@@ -415,20 +476,24 @@ namespace msg::fbuf::p2pmsg
         create_p2p_msg(builder, P2PMsgContent_NonUnlProposalMsg, msg.Union());
     }
 
+    /**
+     * Serializes the given proposal signed with this node's key.
+     * @param p Proposal to serialize. Its root hash must already be populated using hash_proposal().
+     */
     void create_msg_from_proposal(flatbuffers::FlatBufferBuilder &builder, const p2p::proposal &p)
     {
         const auto msg = CreateProposalMsg(
             builder,
             sv_to_flatbuf_bytes(builder, conf::cfg.node.public_key),
-            sv_to_flatbuf_bytes(builder, generate_proposal_signature(p)),
+            sv_to_flatbuf_bytes(builder, crypto::sign(p.root_hash.to_string_view(), conf::cfg.node.private_key)),
             p.stage,
             p.time,
             p.time_config,
             hash_to_flatbuf_bytes(builder, p.node_nonce),
             hash_to_flatbuf_bytes(builder, p.group_nonce),
-            stringlist_to_flatbuf_bytearrayvector(builder, p.users),
-            stringlist_to_flatbuf_bytearrayvector(builder, p.input_ordered_hashes),
-            sv_to_flatbuf_bytes(builder, p.output_hash),
+            proposal_set_to_flatbuf_bytearrayvector(builder, p.users),
+            proposal_set_to_flatbuf_bytearrayvector(builder, p.input_ordered_hashes),
+            hash_to_flatbuf_bytes(builder, p.output_hash),
             sv_to_flatbuf_bytes(builder, p.output_sig),
             hash_to_flatbuf_bytes(builder, p.state_hash),
             hash_to_flatbuf_bytes(builder, p.patch_hash),
@@ -620,6 +685,23 @@ namespace msg::fbuf::p2pmsg
         create_p2p_msg(builder, P2PMsgContent_SuppressMsg, msg.Union());
     }
 
+    /**
+     * Wraps compressed bytes of a peer message.
+     * @param compression Compression used to produce the data.
+     * @param uncompressed_size Size of the original message.
+     * @param data Compressed bytes of the original message.
+     */
+    void create_compressed_msg(flatbuffers::FlatBufferBuilder &builder, const CompressionType compression, const uint32_t uncompressed_size, std::string_view data)
+    {
+        const auto msg = CreateCompressedMsg(
+            builder,
+            compression,
+            uncompressed_size,
+            sv_to_flatbuf_bytes(builder, data));
+
+        create_p2p_msg(builder, P2PMsgContent_CompressedMsg, msg.Union());
+    }
+
     const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<UserInputGroup>>>
     user_input_map_to_flatbuf_user_input_group(flatbuffers::FlatBufferBuilder &builder, const std::unordered_map<std::string, std::list<usr::submitted_user_input>> &map)
     {
@@ -630,11 +712,18 @@ namespace msg::fbuf::p2pmsg
             std::vector<flatbuffers::Offset<UserInput>> fbmsgsvec;
             for (const usr::submitted_user_input &msg : msglist)
             {
+                // Chunk uploaded inputs submitted to us are read straight from the input store where they were assembled.
+                flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input = 0;
+                if (msg.streamed)
+                    input = sv_to_flatbuf_bytes(builder, msg.stored_input.is_null() ? std::string_view(msg.streamed_input)
+                                                                                    : usr::input_store.view_buf(msg.stored_input));
+
                 fbmsgsvec.push_back(CreateUserInput(
                     builder,
                     sv_to_flatbuf_bytes(builder, msg.input_container),
                     sv_to_flatbuf_bytes(builder, msg.sig),
-                    static_cast<uint8_t>(msg.protocol)));
+                    static_cast<uint8_t>(msg.protocol),
+                    input));
             }
 
             fbvec.push_back(CreateUserInputGroup(
@@ -695,13 +784,18 @@ namespace msg::fbuf::p2pmsg
         return CreateSequenceHash(builder, seqhash.seq_no, hash_to_flatbuf_bytes(builder, seqhash.hash));
     }
 
+    template <size_t N>
     const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ByteArray>>>
-    stringlist_to_flatbuf_bytearrayvector(flatbuffers::FlatBufferBuilder &builder, const std::set<std::string> &set)
+    proposal_set_to_flatbuf_bytearrayvector(flatbuffers::FlatBufferBuilder &builder, const p2p::proposal_set<N> &set)
     {
         std::vector<flatbuffers::Offset<ByteArray>> fbvec;
         fbvec.reserve(set.size());
-        for (std::string_view str : set)
-            fbvec.push_back(CreateByteArray(builder, sv_to_flatbuf_bytes(builder, str)));
+        for (const util::fixed_bytes<N> &value : set)
+            fbvec.push_back(CreateByteArray(builder, sv_to_flatbuf_bytes(builder, value.to_string_view())));
         return builder.CreateVector(fbvec);
     }
+    template const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ByteArray>>>
+    proposal_set_to_flatbuf_bytearrayvector<sizeof(util::pk33)>(flatbuffers::FlatBufferBuilder &builder, const p2p::proposal_set<sizeof(util::pk33)> &set);
+    template const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ByteArray>>>
+    proposal_set_to_flatbuf_bytearrayvector<sizeof(util::h40)>(flatbuffers::FlatBufferBuilder &builder, const p2p::proposal_set<sizeof(util::h40)> &set);
 }
\ No newline at end of file
@@ -14,6 +14,8 @@ namespace msg::fbuf::p2pmsg
 
     const p2p::peer_message_info get_peer_message_info(std::string_view message, const p2p::peer_comm_session *session = NULL);
 
+    bool verify_proposal_msg_structure(const p2p::peer_message_info &mi);
+
     const util::h32 verify_proposal_msg_trust(const p2p::peer_message_info &mi);
 
     const util::h32 hash_proposal_msg(const msg::fbuf::p2pmsg::ProposalMsg &msg);
@@ -24,7 +26,7 @@ namespace msg::fbuf::p2pmsg
 
     const p2p::peer_challenge_response create_peer_challenge_response_from_msg(const p2p::peer_message_info &mi);
 
-    const p2p::proposal create_proposal_from_msg(const p2p::peer_message_info &mi, const util::h32 &hash);
+    const p2p::proposal create_proposal_from_msg(const p2p::peer_message_info &mi, const util::h32 &hash, std::shared_ptr<const std::string> buffer);
 
     const p2p::npl_message create_npl_from_msg(const p2p::peer_message_info &mi);
 
@@ -46,8 +48,6 @@ namespace msg::fbuf::p2pmsg
 
     util::sequence_hash flatbuf_seqhash_to_seqhash(const msg::fbuf::p2pmsg::SequenceHash *fbseqhash);
 
-    const std::set<std::string> flatbuf_bytearrayvector_to_stringlist(const flatbuffers::Vector<flatbuffers::Offset<ByteArray>> *fbvec);
-
     const std::unordered_map<std::string, std::list<usr::submitted_user_input>>
     flatbuf_user_input_group_to_user_input_map(const flatbuffers::Vector<flatbuffers::Offset<UserInputGroup>> *fbvec);
 
@@ -58,7 +58,7 @@ namespace msg::fbuf::p2pmsg
 
     //---std to Flatbuf---//
 
-    const std::string generate_proposal_signature(const p2p::proposal &p);
+    const util::h32 hash_proposal(const p2p::proposal &p);
 
     const std::string generate_npl_signature(std::string_view data, const util::sequence_hash &lcl_id);
 
@@ -105,6 +105,8 @@ namespace msg::fbuf::p2pmsg
 
     void create_suppress_msg(flatbuffers::FlatBufferBuilder &builder, const uint8_t reason);
 
+    void create_compressed_msg(flatbuffers::FlatBufferBuilder &builder, const CompressionType compression, const uint32_t uncompressed_size, std::string_view data);
+
     const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<UserInputGroup>>>
     user_input_map_to_flatbuf_user_input_group(flatbuffers::FlatBufferBuilder &builder, const std::unordered_map<std::string, std::list<usr::submitted_user_input>> &map);
 
@@ -117,8 +119,9 @@ namespace msg::fbuf::p2pmsg
     const flatbuffers::Offset<msg::fbuf::p2pmsg::SequenceHash>
     seqhash_to_flatbuf_seqhash(flatbuffers::FlatBufferBuilder &builder, const util::sequence_hash &seqhash);
 
+    template <size_t N>
     const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ByteArray>>>
-    stringlist_to_flatbuf_bytearrayvector(flatbuffers::FlatBufferBuilder &builder, const std::set<std::string> &set);
+    proposal_set_to_flatbuf_bytearrayvector(flatbuffers::FlatBufferBuilder &builder, const p2p::proposal_set<N> &set);
 }
 
 #endif
@@ -37,6 +37,9 @@ struct NplMsgBuilder;
 struct SuppressMsg;
 struct SuppressMsgBuilder;
 
+struct CompressedMsg;
+struct CompressedMsgBuilder;
+
 struct HpfsFSHashEntry;
 struct HpfsFSHashEntryBuilder;
 
@@ -104,11 +107,12 @@ enum P2PMsgContent {
   P2PMsgContent_HpfsLogRequest = 12,
   P2PMsgContent_HpfsLogResponse = 13,
   P2PMsgContent_SuppressMsg = 14,
+  P2PMsgContent_CompressedMsg = 15,
   P2PMsgContent_MIN = P2PMsgContent_NONE,
-  P2PMsgContent_MAX = P2PMsgContent_SuppressMsg
+  P2PMsgContent_MAX = P2PMsgContent_CompressedMsg
 };
 
-inline const P2PMsgContent (&EnumValuesP2PMsgContent())[15] {
+inline const P2PMsgContent (&EnumValuesP2PMsgContent())[16] {
   static const P2PMsgContent values[] = {
     P2PMsgContent_NONE,
     P2PMsgContent_PeerChallengeMsg,
@@ -124,13 +128,14 @@ inline const P2PMsgContent (&EnumValuesP2PMsgContent())[15] {
     P2PMsgContent_PeerListResponseMsg,
     P2PMsgContent_HpfsLogRequest,
     P2PMsgContent_HpfsLogResponse,
-    P2PMsgContent_SuppressMsg
+    P2PMsgContent_SuppressMsg,
+    P2PMsgContent_CompressedMsg
   };
   return values;
 }
 
 inline const char * const *EnumNamesP2PMsgContent() {
-  static const char * const names[16] = {
+  static const char * const names[17] = {
     "NONE",
     "PeerChallengeMsg",
     "PeerChallengeResponseMsg",
@@ -146,13 +151,14 @@ inline const char * const *EnumNamesP2PMsgContent() {
     "HpfsLogRequest",
     "HpfsLogResponse",
     "SuppressMsg",
+    "CompressedMsg",
     nullptr
   };
   return names;
 }
 
 inline const char *EnumNameP2PMsgContent(P2PMsgContent e) {
-  if (flatbuffers::IsOutRange(e, P2PMsgContent_NONE, P2PMsgContent_SuppressMsg)) return "";
+  if (flatbuffers::IsOutRange(e, P2PMsgContent_NONE, P2PMsgContent_CompressedMsg)) return "";
   const size_t index = static_cast<size_t>(e);
   return EnumNamesP2PMsgContent()[index];
 }
@@ -217,6 +223,10 @@ template<> struct P2PMsgContentTraits<msg::fbuf::p2pmsg::SuppressMsg> {
   static const P2PMsgContent enum_value = P2PMsgContent_SuppressMsg;
 };
 
+template<> struct P2PMsgContentTraits<msg::fbuf::p2pmsg::CompressedMsg> {
+  static const P2PMsgContent enum_value = P2PMsgContent_CompressedMsg;
+};
+
 bool VerifyP2PMsgContent(flatbuffers::Verifier &verifier, const void *obj, P2PMsgContent type);
 bool VerifyP2PMsgContentVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
 
@@ -247,6 +257,36 @@ inline const char *EnumNameSuppressReason(SuppressReason e) {
   return EnumNamesSuppressReason()[index];
 }
 
+enum CompressionType {
+  CompressionType_None = 0,
+  CompressionType_Deflate = 1,
+  CompressionType_MIN = CompressionType_None,
+  CompressionType_MAX = CompressionType_Deflate
+};
+
+inline const CompressionType (&EnumValuesCompressionType())[2] {
+  static const CompressionType values[] = {
+    CompressionType_None,
+    CompressionType_Deflate
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesCompressionType() {
+  static const char * const names[3] = {
+    "None",
+    "Deflate",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameCompressionType(CompressionType e) {
+  if (flatbuffers::IsOutRange(e, CompressionType_None, CompressionType_Deflate)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesCompressionType()[index];
+}
+
 enum HpfsFsEntryResponseType {
   HpfsFsEntryResponseType_Matched = 0,
   HpfsFsEntryResponseType_Mismatched = 1,
@@ -455,6 +495,9 @@ struct P2PMsg FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const msg::fbuf::p2pmsg::SuppressMsg *content_as_SuppressMsg() const {
     return content_type() == msg::fbuf::p2pmsg::P2PMsgContent_SuppressMsg ? static_cast<const msg::fbuf::p2pmsg::SuppressMsg *>(content()) : nullptr;
   }
+  const msg::fbuf::p2pmsg::CompressedMsg *content_as_CompressedMsg() const {
+    return content_type() == msg::fbuf::p2pmsg::P2PMsgContent_CompressedMsg ? static_cast<const msg::fbuf::p2pmsg::CompressedMsg *>(content()) : nullptr;
+  }
   void *mutable_content() {
     return GetPointer<void *>(VT_CONTENT);
   }
@@ -526,6 +569,10 @@ template<> inline const msg::fbuf::p2pmsg::SuppressMsg *P2PMsg::content_as<msg::
   return content_as_SuppressMsg();
 }
 
+template<> inline const msg::fbuf::p2pmsg::CompressedMsg *P2PMsg::content_as<msg::fbuf::p2pmsg::CompressedMsg>() const {
+  return content_as_CompressedMsg();
+}
+
 struct P2PMsgBuilder {
   typedef P2PMsg Table;
   flatbuffers::FlatBufferBuilder &fbb_;
@@ -589,7 +636,8 @@ struct PeerChallengeMsg FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_CONTRACT_ID = 4,
     VT_TIME_CONFIG = 6,
     VT_IS_FULL_HISTORY = 8,
-    VT_CHALLENGE = 10
+    VT_CHALLENGE = 10,
+    VT_COMPRESSION = 12
   };
   const flatbuffers::String *contract_id() const {
     return GetPointer<const flatbuffers::String *>(VT_CONTRACT_ID);
@@ -615,6 +663,12 @@ struct PeerChallengeMsg FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   flatbuffers::Vector<uint8_t> *mutable_challenge() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_CHALLENGE);
   }
+  msg::fbuf::p2pmsg::CompressionType compression() const {
+    return static_cast<msg::fbuf::p2pmsg::CompressionType>(GetField<uint8_t>(VT_COMPRESSION, 0));
+  }
+  bool mutate_compression(msg::fbuf::p2pmsg::CompressionType _compression) {
+    return SetField<uint8_t>(VT_COMPRESSION, static_cast<uint8_t>(_compression), 0);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_CONTRACT_ID) &&
@@ -623,6 +677,7 @@ struct PeerChallengeMsg FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint8_t>(verifier, VT_IS_FULL_HISTORY) &&
            VerifyOffset(verifier, VT_CHALLENGE) &&
            verifier.VerifyVector(challenge()) &&
+           VerifyField<uint8_t>(verifier, VT_COMPRESSION) &&
            verifier.EndTable();
   }
 };
@@ -643,6 +698,9 @@ struct PeerChallengeMsgBuilder {
   void add_challenge(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> challenge) {
     fbb_.AddOffset(PeerChallengeMsg::VT_CHALLENGE, challenge);
   }
+  void add_compression(msg::fbuf::p2pmsg::CompressionType compression) {
+    fbb_.AddElement<uint8_t>(PeerChallengeMsg::VT_COMPRESSION, static_cast<uint8_t>(compression), 0);
+  }
   explicit PeerChallengeMsgBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -660,11 +718,13 @@ inline flatbuffers::Offset<PeerChallengeMsg> CreatePeerChallengeMsg(
     flatbuffers::Offset<flatbuffers::String> contract_id = 0,
     uint32_t time_config = 0,
     bool is_full_history = false,
-    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> challenge = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> challenge = 0,
+    msg::fbuf::p2pmsg::CompressionType compression = msg::fbuf::p2pmsg::CompressionType_None) {
   PeerChallengeMsgBuilder builder_(_fbb);
   builder_.add_challenge(challenge);
   builder_.add_time_config(time_config);
   builder_.add_contract_id(contract_id);
+  builder_.add_compression(compression);
   builder_.add_is_full_history(is_full_history);
   return builder_.Finish();
 }
@@ -674,7 +734,8 @@ inline flatbuffers::Offset<PeerChallengeMsg> CreatePeerChallengeMsgDirect(
     const char *contract_id = nullptr,
     uint32_t time_config = 0,
     bool is_full_history = false,
-    const std::vector<uint8_t> *challenge = nullptr) {
+    const std::vector<uint8_t> *challenge = nullptr,
+    msg::fbuf::p2pmsg::CompressionType compression = msg::fbuf::p2pmsg::CompressionType_None) {
   auto contract_id__ = contract_id ? _fbb.CreateString(contract_id) : 0;
   auto challenge__ = challenge ? _fbb.CreateVector<uint8_t>(*challenge) : 0;
   return msg::fbuf::p2pmsg::CreatePeerChallengeMsg(
@@ -682,7 +743,8 @@ inline flatbuffers::Offset<PeerChallengeMsg> CreatePeerChallengeMsgDirect(
       contract_id__,
       time_config,
       is_full_history,
-      challenge__);
+      challenge__,
+      compression);
 }
 
 struct PeerChallengeResponseMsg FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -779,7 +841,8 @@ struct UserInput FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
     VT_INPUT_CONTAINER = 4,
     VT_SIG = 6,
-    VT_PROTOCOL = 8
+    VT_PROTOCOL = 8,
+    VT_INPUT = 10
   };
   const flatbuffers::Vector<uint8_t> *input_container() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INPUT_CONTAINER);
@@ -799,6 +862,12 @@ struct UserInput FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool mutate_protocol(uint8_t _protocol) {
     return SetField<uint8_t>(VT_PROTOCOL, _protocol, 0);
   }
+  const flatbuffers::Vector<uint8_t> *input() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INPUT);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_input() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INPUT);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_INPUT_CONTAINER) &&
@@ -806,6 +875,8 @@ struct UserInput FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyOffset(verifier, VT_SIG) &&
            verifier.VerifyVector(sig()) &&
            VerifyField<uint8_t>(verifier, VT_PROTOCOL) &&
+           VerifyOffset(verifier, VT_INPUT) &&
+           verifier.VerifyVector(input()) &&
            verifier.EndTable();
   }
 };
@@ -823,6 +894,9 @@ struct UserInputBuilder {
   void add_protocol(uint8_t protocol) {
     fbb_.AddElement<uint8_t>(UserInput::VT_PROTOCOL, protocol, 0);
   }
+  void add_input(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input) {
+    fbb_.AddOffset(UserInput::VT_INPUT, input);
+  }
   explicit UserInputBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -839,8 +913,10 @@ inline flatbuffers::Offset<UserInput> CreateUserInput(
     flatbuffers::FlatBufferBuilder &_fbb,
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_container = 0,
     flatbuffers::Offset<flatbuffers::Vector<uint8_t>> sig = 0,
-    uint8_t protocol = 0) {
+    uint8_t protocol = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input = 0) {
   UserInputBuilder builder_(_fbb);
+  builder_.add_input(input);
   builder_.add_sig(sig);
   builder_.add_input_container(input_container);
   builder_.add_protocol(protocol);
@@ -851,14 +927,17 @@ inline flatbuffers::Offset<UserInput> CreateUserInputDirect(
     flatbuffers::FlatBufferBuilder &_fbb,
     const std::vector<uint8_t> *input_container = nullptr,
     const std::vector<uint8_t> *sig = nullptr,
-    uint8_t protocol = 0) {
+    uint8_t protocol = 0,
+    const std::vector<uint8_t> *input = nullptr) {
   auto input_container__ = input_container ? _fbb.CreateVector<uint8_t>(*input_container) : 0;
   auto sig__ = sig ? _fbb.CreateVector<uint8_t>(*sig) : 0;
+  auto input__ = input ? _fbb.CreateVector<uint8_t>(*input) : 0;
   return msg::fbuf::p2pmsg::CreateUserInput(
       _fbb,
       input_container__,
       sig__,
-      protocol);
+      protocol,
+      input__);
 }
 
 struct UserInputGroup FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -1452,6 +1531,91 @@ inline flatbuffers::Offset<SuppressMsg> CreateSuppressMsgDirect(
       reason);
 }
 
+struct CompressedMsg FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef CompressedMsgBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_COMPRESSION = 4,
+    VT_UNCOMPRESSED_SIZE = 6,
+    VT_DATA = 8
+  };
+  msg::fbuf::p2pmsg::CompressionType compression() const {
+    return static_cast<msg::fbuf::p2pmsg::CompressionType>(GetField<uint8_t>(VT_COMPRESSION, 0));
+  }
+  bool mutate_compression(msg::fbuf::p2pmsg::CompressionType _compression) {
+    return SetField<uint8_t>(VT_COMPRESSION, static_cast<uint8_t>(_compression), 0);
+  }
+  uint32_t uncompressed_size() const {
+    return GetField<uint32_t>(VT_UNCOMPRESSED_SIZE, 0);
+  }
+  bool mutate_uncompressed_size(uint32_t _uncompressed_size) {
+    return SetField<uint32_t>(VT_UNCOMPRESSED_SIZE, _uncompressed_size, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_data() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_COMPRESSION) &&
+           VerifyField<uint32_t>(verifier, VT_UNCOMPRESSED_SIZE) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct CompressedMsgBuilder {
+  typedef CompressedMsg Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_compression(msg::fbuf::p2pmsg::CompressionType compression) {
+    fbb_.AddElement<uint8_t>(CompressedMsg::VT_COMPRESSION, static_cast<uint8_t>(compression), 0);
+  }
+  void add_uncompressed_size(uint32_t uncompressed_size) {
+    fbb_.AddElement<uint32_t>(CompressedMsg::VT_UNCOMPRESSED_SIZE, uncompressed_size, 0);
+  }
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(CompressedMsg::VT_DATA, data);
+  }
+  explicit CompressedMsgBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  CompressedMsgBuilder &operator=(const CompressedMsgBuilder &);
+  flatbuffers::Offset<CompressedMsg> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<CompressedMsg>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<CompressedMsg> CreateCompressedMsg(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    msg::fbuf::p2pmsg::CompressionType compression = msg::fbuf::p2pmsg::CompressionType_None,
+    uint32_t uncompressed_size = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
+  CompressedMsgBuilder builder_(_fbb);
+  builder_.add_data(data);
+  builder_.add_uncompressed_size(uncompressed_size);
+  builder_.add_compression(compression);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<CompressedMsg> CreateCompressedMsgDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    msg::fbuf::p2pmsg::CompressionType compression = msg::fbuf::p2pmsg::CompressionType_None,
+    uint32_t uncompressed_size = 0,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return msg::fbuf::p2pmsg::CreateCompressedMsg(
+      _fbb,
+      compression,
+      uncompressed_size,
+      data__);
+}
+
 struct HpfsFSHashEntry FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef HpfsFSHashEntryBuilder Builder;
   enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
@@ -2810,6 +2974,10 @@ inline bool VerifyP2PMsgContent(flatbuffers::Verifier &verifier, const void *obj
       auto ptr = reinterpret_cast<const msg::fbuf::p2pmsg::SuppressMsg *>(obj);
       return verifier.VerifyTable(ptr);
     }
+    case P2PMsgContent_CompressedMsg: {
+      auto ptr = reinterpret_cast<const msg::fbuf::p2pmsg::CompressedMsg *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
     default: return true;
   }
 }
@@ -0,0 +1,683 @@
+#include "../../conf.hpp"
+#include "../../pchheader.hpp"
+#include "../../util/version.hpp"
+#include "../../util/util.hpp"
+#include "../../util/sequence_hash.hpp"
+#include "../../hplog.hpp"
+#include "../../ledger/ledger_query.hpp"
+#include "../../status.hpp"
+#include "../usrmsg_common.hpp"
+#include "common_helpers.hpp"
+#include "usrmsg_fbuf.hpp"
+
+namespace msg::fbuf::usrmsg
+{
+    /**
+     * This section contains the flatbuffer user message protocol. Message structures are defined in usrmsg.fbs.
+     * Binary fields are carried as raw bytes (no hex/base64 expansion) and incoming messages are read in-place
+     * from the received buffer after verification.
+     */
+
+    /**
+     * Constructs a status response message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     */
+    void create_status_response(std::vector<uint8_t> &msg)
+    {
+        const util::sequence_hash lcl_id = status::get_lcl_id();
+        const std::shared_ptr<const std::set<std::string>> unl_snapshot = status::get_unl();
+        const std::set<std::string> &unl = *unl_snapshot;
+        const status::VOTE_STATUS vote_status = status::get_vote_status();
+        const bool weakly_connected = status::get_weakly_connected();
+
+        flatbuffers::FlatBufferBuilder builder(1024);
+
+        std::vector<flatbuffers::Offset<ByteArray>> unl_list;
+        unl_list.reserve(unl.size());
+        for (std::string_view pubkey : unl)
+            unl_list.push_back(CreateByteArray(builder, sv_to_flatbuf_bytes(builder, pubkey)));
+
+        std::vector<flatbuffers::Offset<flatbuffers::String>> peer_list;
+        {
+            const std::shared_ptr<const std::set<conf::peer_ip_port>> peers_snapshot = status::get_peers();
+            const std::set<conf::peer_ip_port> &peers = *peers_snapshot;
+            const size_t max_peers_count = MIN(msg::usrmsg::MAX_KNOWN_PEERS_INFO, peers.size());
+            peer_list.reserve(max_peers_count);
+
+            for (auto peer = peers.begin(); peer != peers.end() && peer_list.size() < max_peers_count; peer++)
+                peer_list.push_back(sv_to_flatbuf_str(builder, peer->to_string()));
+        }
+
+        const auto content = CreateStatResponse(
+            builder,
+            sv_to_flatbuf_str(builder, version::HP_VERSION),
+            lcl_id.seq_no,
+            hash_to_flatbuf_bytes(builder, lcl_id.hash),
+            sv_to_flatbuf_str(builder, msg::usrmsg::VOTE_STATUSES[vote_status]),
+            conf::cfg.contract.consensus.roundtime,
+            conf::cfg.contract.execute,
+            conf::cfg.user.concurrent_read_requests != 0,
+            conf::cfg.node.history == conf::HISTORY::FULL,
+            weakly_connected,
+            builder.CreateVector(unl_list),
+            builder.CreateVector(peer_list));
+
+        finish_user_msg(msg, builder, UserMsgContent_StatResponse, content.Union());
+    }
+
+    /**
+     * Constructs a lcl response message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     */
+    void create_lcl_response(std::vector<uint8_t> &msg)
+    {
+        const util::sequence_hash lcl_id = status::get_lcl_id();
+
+        flatbuffers::FlatBufferBuilder builder(128);
+        const auto content = CreateLclResponse(
+            builder,
+            lcl_id.seq_no,
+            hash_to_flatbuf_bytes(builder, lcl_id.hash));
+
+        finish_user_msg(msg, builder, UserMsgContent_LclResponse, content.Union());
+    }
+
+    /**
+     * Constructs a contract input status message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param status Accepted or rejected status.
+     * @param reason Rejected reason. Empty if accepted.
+     * @param input_hash Binary Hash of the original input signature. This is used by user
+     *                   to tie the response with the input submission.
+     * @param ledger_seq_no Seq no. of the ledger the input got included in. 0 if not applicable.
+     * @param ledger_hash Hash of the ledger the input got included in.
+     */
+    void create_contract_input_status(std::vector<uint8_t> &msg, std::string_view status, std::string_view reason,
+                                      std::string_view input_hash, const uint64_t ledger_seq_no, const util::h32 &ledger_hash)
+    {
+        flatbuffers::FlatBufferBuilder builder(256);
+
+        // Reject reason is only included for rejected inputs.
+        // Ledger information is only included in 'accepted' input statuses.
+        const auto content = CreateContractInputStatus(
+            builder,
+            sv_to_flatbuf_str(builder, status),
+            reason.empty() ? 0 : sv_to_flatbuf_str(builder, reason),
+            sv_to_flatbuf_bytes(builder, input_hash),
+            ledger_seq_no,
+            ledger_seq_no > 0 ? hash_to_flatbuf_bytes(builder, ledger_hash) : 0);
+
+        finish_user_msg(msg, builder, UserMsgContent_ContractInputStatus, content.Union());
+    }
+
+    /**
+     * Constructs a contract read response message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param reply_for The id of the read request this is a response to.
+     * @param content The contract binary output content to be put in the message.
+     */
+    void create_contract_read_response_container(std::vector<uint8_t> &msg, std::string_view reply_for, std::string_view content)
+    {
+        flatbuffers::FlatBufferBuilder builder(content.size() + 128);
+        const auto resp = CreateContractReadResponse(
+            builder,
+            sv_to_flatbuf_str(builder, reply_for),
+            sv_to_flatbuf_bytes(builder, content));
+
+        finish_user_msg(msg, builder, UserMsgContent_ContractReadResponse, resp.Union());
+    }
+
+    /**
+     * Captures the round-common parts of contract output container messages. Flatbuffers are built back to front with
+     * offsets relative to the buffer end, so serialized fragments cannot be spliced. Only the round values are kept
+     * and each user message is built from them.
+     * @param fragments The fragments to populate.
+     * @param unl_sig List of unl signatures issued on the root hash. Must outlive the fragments.
+     * @param lcl_seq_no Current ledger seq no.
+     * @param lcl_hash Current ledger hash.
+     */
+    void create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+                                          const uint64_t lcl_seq_no, std::string_view lcl_hash)
+    {
+        fragments.lcl_seq_no = lcl_seq_no;
+        fragments.lcl_hash = lcl_hash;
+        fragments.unl_sig = &unl_sig;
+    }
+
+    /**
+     * Constructs a contract output container message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param fragments Round-common message parts created with create_contract_output_fragments().
+     * @param hash This user's combined output hash. [output hash = hash(pubkey+all outputs for the user)]
+     * @param outputs List of outputs for the user.
+     * @param hash_root Root node of the collapsed merkle hash tree for this round.
+     */
+    void create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                          std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root)
+    {
+        flatbuffers::FlatBufferBuilder builder(1024);
+
+        std::vector<flatbuffers::Offset<UnlSig>> sigs;
+        sigs.reserve(fragments.unl_sig->size());
+        for (const auto &[pubkey, sig] : *fragments.unl_sig)
+            sigs.push_back(CreateUnlSig(builder, sv_to_flatbuf_bytes(builder, pubkey), sv_to_flatbuf_bytes(builder, sig)));
+
+        const auto content = CreateContractOutput(
+            builder,
+            fragments.lcl_seq_no,
+            sv_to_flatbuf_bytes(builder, fragments.lcl_hash),
+            bytes_list_to_flatbuf_byte_arrays(builder, outputs),
+            sv_to_flatbuf_bytes(builder, hash),
+            populate_output_hash_tree(builder, hash_root),
+            builder.CreateVector(sigs));
+
+        finish_user_msg(msg, builder, UserMsgContent_ContractOutput, content.Union());
+    }
+
+    /**
+     * Constructs unl change notification message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param unl_list The unl node binary pubkey list to be put in the message.
+     */
+    void create_unl_notification(std::vector<uint8_t> &msg, const ::std::set<std::string> &unl_list)
+    {
+        flatbuffers::FlatBufferBuilder builder(1024);
+
+        std::vector<flatbuffers::Offset<ByteArray>> unl;
+        unl.reserve(unl_list.size());
+        for (std::string_view pubkey : unl_list)
+            unl.push_back(CreateByteArray(builder, sv_to_flatbuf_bytes(builder, pubkey)));
+
+        const auto content = CreateUnlChange(builder, builder.CreateVector(unl));
+        finish_user_msg(msg, builder, UserMsgContent_UnlChange, content.Union());
+    }
+
+    /**
+     * Constructs ledger created notification message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param ledger The created ledger.
+     */
+    void create_ledger_created_notification(std::vector<uint8_t> &msg, const ledger::ledger_record &ledger)
+    {
+        flatbuffers::FlatBufferBuilder builder(512);
+        const auto content = CreateLedgerCreatedEvent(builder, populate_ledger(builder, ledger));
+        finish_user_msg(msg, builder, UserMsgContent_LedgerCreatedEvent, content.Union());
+    }
+
+    /**
+     * Constructs vote status notification message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param vote_status The current vote status of the node.
+     */
+    void create_vote_status_notification(std::vector<uint8_t> &msg, const status::VOTE_STATUS vote_status)
+    {
+        flatbuffers::FlatBufferBuilder builder(64);
+        const auto content = CreateVoteStatusEvent(builder, sv_to_flatbuf_str(builder, msg::usrmsg::VOTE_STATUSES[vote_status]));
+        finish_user_msg(msg, builder, UserMsgContent_VoteStatusEvent, content.Union());
+    }
+
+    /**
+     * Constructs health stat message.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param ev Current health information.
+     */
+    void create_health_notification(std::vector<uint8_t> &msg, const status::health_event &ev)
+    {
+        flatbuffers::FlatBufferBuilder builder(128);
+
+        if (ev.index() == 0)
+        {
+            const status::proposal_health &phealth = std::get<status::proposal_health>(ev);
+            const auto content = CreateProposalHealthEvent(
+                builder,
+                CreateLatencyStat(builder, phealth.comm_latency_min, phealth.comm_latency_max, phealth.comm_latency_avg),
+                CreateLatencyStat(builder, phealth.read_latency_min, phealth.read_latency_max, phealth.read_latency_avg),
+                phealth.batch_size);
+            finish_user_msg(msg, builder, UserMsgContent_ProposalHealthEvent, content.Union());
+        }
+        else if (ev.index() == 1)
+        {
+            const status::connectivity_health &conn = std::get<status::connectivity_health>(ev);
+            const auto content = CreateConnectivityHealthEvent(builder, conn.peer_count, conn.is_weakly_connected);
+            finish_user_msg(msg, builder, UserMsgContent_ConnectivityHealthEvent, content.Union());
+        }
+    }
+
+    /**
+     * Constructs a ledger query response.
+     * @param msg Buffer to construct the generated flatbuffer message into.
+     * @param reply_for Original query id to associate the response with.
+     * @param result Query results to be sent in the response.
+     */
+    void create_ledger_query_response(std::vector<uint8_t> &msg, std::string_view reply_for,
+                                      const ledger::query::query_result &result)
+    {
+        flatbuffers::FlatBufferBuilder builder(1024);
+
+        flatbuffers::Offset<flatbuffers::String> error = 0;
+        flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Ledger>>> results = 0;
+
+        if (result.index() == 0)
+        {
+            error = sv_to_flatbuf_str(builder, std::get<const char *>(result));
+        }
+        else
+        {
+            const std::vector<ledger::ledger_record> &ledgers = std::get<std::vector<ledger::ledger_record>>(result);
+            std::vector<flatbuffers::Offset<Ledger>> list;
+            list.reserve(ledgers.size());
+            for (const ledger::ledger_record &ledger : ledgers)
+                list.push_back(populate_ledger(builder, ledger));
+            results = builder.CreateVector(list);
+        }
+
+        const auto content = CreateLedgerQueryResult(builder, sv_to_flatbuf_str(builder, reply_for), error, results);
+        finish_user_msg(msg, builder, UserMsgContent_LedgerQueryResult, content.Union());
+    }
+
+    /**
+     * Verifies and accesses a flatbuffer message sent by a user. The message is not copied, so the returned
+     * message pointer is only valid as long as the message buffer is alive.
+     * @param d Pointer to assign the verified message root.
+     * @param message The message to parse.
+     * @return 0 on successful parsing. -1 for failure.
+     */
+    int parse_user_message(const UserMsg *&d, std::string_view message)
+    {
+        flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t *>(message.data()), message.size());
+        if (!VerifyUserMsgBuffer(verifier))
+        {
+            LOG_DEBUG << "User flatbuffer message verification failed.";
+            return -1;
+        }
+
+        d = GetUserMsg(message.data());
+        if (d->content_type() == UserMsgContent_NONE)
+        {
+            LOG_DEBUG << "User flatbuffer message content missing.";
+            return -1;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Extracts the message type of the flatbuffer message in terms of the common user message type names.
+     * Node-to-user message types are reported as unknown.
+     */
+    int extract_type(std::string &extracted_type, const UserMsg *d)
+    {
+        switch (d->content_type())
+        {
+        case UserMsgContent_StatRequest:
+            extracted_type = msg::usrmsg::MSGTYPE_STAT;
+            break;
+        case UserMsgContent_LclRequest:
+            extracted_type = msg::usrmsg::MSGTYPE_LCL;
+            break;
+        case UserMsgContent_ContractReadRequest:
+            extracted_type = msg::usrmsg::MSGTYPE_CONTRACT_READ_REQUEST;
+            break;
+        case UserMsgContent_ContractInput:
+            extracted_type = msg::usrmsg::MSGTYPE_CONTRACT_INPUT;
+            break;
+        case UserMsgContent_SubscriptionRequest:
+            extracted_type = msg::usrmsg::MSGTYPE_SUBSCRIPTION;
+            break;
+        case UserMsgContent_LedgerQuery:
+            extracted_type = msg::usrmsg::MSGTYPE_LEDGER_QUERY;
+            break;
+        case UserMsgContent_ContractInputBegin:
+            extracted_type = msg::usrmsg::MSGTYPE_CONTRACT_INPUT_BEGIN;
+            break;
+        case UserMsgContent_ContractInputChunk:
+            extracted_type = msg::usrmsg::MSGTYPE_CONTRACT_INPUT_CHUNK;
+            break;
+        case UserMsgContent_ContractInputEnd:
+            extracted_type = msg::usrmsg::MSGTYPE_CONTRACT_INPUT_END;
+            break;
+        case UserMsgContent_ContractReadCancel:
+            extracted_type = msg::usrmsg::MSGTYPE_CONTRACT_READ_CANCEL;
+            break;
+        default:
+            extracted_type = msg::usrmsg::MSGTYPE_UNKNOWN;
+            break;
+        }
+        return 0;
+    }
+
+    /**
+     * Extracts a contract read request message sent by user.
+     * @param extracted_id The request id extracted from the message.
+     * @param extracted_content The content to be passed to the contract, extracted from the message.
+     * @param d The flatbuffer message holding the read request.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_read_request(std::string &extracted_id, std::string &extracted_content, const UserMsg *d)
+    {
+        const ContractReadRequest *req = d->content_as_ContractReadRequest();
+        if (!req || !req->id() || !req->content())
+        {
+            LOG_DEBUG << "Read request required fields missing.";
+            return -1;
+        }
+
+        extracted_id = flatbuf_str_to_sv(req->id());
+        extracted_content = flatbuf_bytes_to_sv(req->content());
+        return 0;
+    }
+
+    /**
+     * Extracts a contract read cancel message sent by user.
+     * @param extracted_id The id of the read request to cancel.
+     * @param d The flatbuffer message holding the read cancel.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_read_cancel(std::string &extracted_id, const UserMsg *d)
+    {
+        const ContractReadCancel *cancel = d->content_as_ContractReadCancel();
+        if (!cancel || !cancel->id())
+        {
+            LOG_DEBUG << "Read cancel required fields missing.";
+            return -1;
+        }
+
+        extracted_id = flatbuf_str_to_sv(cancel->id());
+        return 0;
+    }
+
+    /**
+     * Extracts a signed input container message sent by user.
+     * @param extracted_input_container The serialized input container extracted from the message.
+     * @param extracted_sig The binary signature extracted from the message.
+     * @param d The flatbuffer message holding the input container.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_signed_input_container(std::string &extracted_input_container, std::string &extracted_sig, const UserMsg *d)
+    {
+        const ContractInput *input = d->content_as_ContractInput();
+        if (!input || !input->input_container() || !input->sig())
+        {
+            LOG_DEBUG << "User signed input required fields missing.";
+            return -1;
+        }
+
+        extracted_input_container = flatbuf_bytes_to_sv(input->input_container());
+        extracted_sig = flatbuf_bytes_to_sv(input->sig());
+        return 0;
+    }
+
+    /**
+     * Extract the individual components of a given flatbuffer input container.
+     * @param input The extracted input.
+     * @param nonce The extracted nonce.
+     * @param max_ledger_seq_no The extracted max ledger sequence no.
+     * @param streamed Whether the input is the hash of bytes uploaded in chunks.
+     * @param contentfbuf The flatbuffer serialized InputContainer.
+     * @return 0 on succesful extraction. -1 on failure.
+     */
+    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no, bool &streamed, std::string_view contentfbuf)
+    {
+        flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t *>(contentfbuf.data()), contentfbuf.size());
+        if (!verifier.VerifyBuffer<InputContainer>(nullptr))
+        {
+            LOG_DEBUG << "User input container flatbuffer verification failed.";
+            return -1;
+        }
+
+        const InputContainer *container = flatbuffers::GetRoot<InputContainer>(contentfbuf.data());
+        if (!container->input())
+        {
+            LOG_DEBUG << "User input container required fields missing.";
+            return -1;
+        }
+
+        nonce = container->nonce();
+        if (nonce == 0)
+        {
+            LOG_DEBUG << "Input nonce must be a positive integer.";
+            return -1;
+        }
+
+        max_ledger_seq_no = container->max_ledger_seq_no();
+        streamed = container->streamed();
+        input = flatbuf_bytes_to_sv(container->input());
+        return 0;
+    }
+
+    /**
+     * Extracts the message which starts a chunked contract input upload.
+     * @param extracted_id The user-assigned upload id.
+     * @param extracted_size The total input size the user is going to upload.
+     * @param d The flatbuffer message holding the upload begin message.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size, const UserMsg *d)
+    {
+        const ContractInputBegin *msg = d->content_as_ContractInputBegin();
+        if (!msg || !msg->id())
+        {
+            LOG_DEBUG << "Input upload begin required fields missing.";
+            return -1;
+        }
+
+        extracted_id = flatbuf_str_to_sv(msg->id());
+        extracted_size = msg->size();
+        return 0;
+    }
+
+    /**
+     * Extracts a chunk of a contract input upload.
+     * @param extracted_id The upload id the chunk belongs to.
+     * @param extracted_data The chunk data. This points into the message buffer.
+     * @param d The flatbuffer message holding the chunk.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data, const UserMsg *d)
+    {
+        const ContractInputChunk *msg = d->content_as_ContractInputChunk();
+        if (!msg || !msg->id() || !msg->data())
+        {
+            LOG_DEBUG << "Input upload chunk required fields missing.";
+            return -1;
+        }
+
+        extracted_id = flatbuf_str_to_sv(msg->id());
+        extracted_data = flatbuf_bytes_to_sv(msg->data());
+        return 0;
+    }
+
+    /**
+     * Extracts the message which completes a chunked contract input upload.
+     * @param extracted_id The upload id.
+     * @param extracted_input_container The serialized input container extracted from the message.
+     * @param extracted_sig The binary signature extracted from the message.
+     * @param d The flatbuffer message holding the upload end message.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig, const UserMsg *d)
+    {
+        const ContractInputEnd *msg = d->content_as_ContractInputEnd();
+        if (!msg || !msg->id() || !msg->input_container() || !msg->sig())
+        {
+            LOG_DEBUG << "Input upload end required fields missing.";
+            return -1;
+        }
+
+        extracted_id = flatbuf_str_to_sv(msg->id());
+        extracted_input_container = flatbuf_bytes_to_sv(msg->input_container());
+        extracted_sig = flatbuf_bytes_to_sv(msg->sig());
+        return 0;
+    }
+
+    /**
+     * Extract notification subscription request.
+     * @param channel Extracted subscription channel.
+     * @param enabled Whether the subscription is enabled or not.
+     * @param d The flatbuffer message holding the subscription request.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_subscription_request(usr::NOTIFICATION_CHANNEL &channel, bool &enabled, const UserMsg *d)
+    {
+        const SubscriptionRequest *req = d->content_as_SubscriptionRequest();
+        if (!req)
+            return -1;
+
+        if (req->channel() == NotificationChannel_LedgerEvent)
+        {
+            channel = usr::NOTIFICATION_CHANNEL::LEDGER_EVENT;
+        }
+        else if (req->channel() == NotificationChannel_UnlChange)
+        {
+            channel = usr::NOTIFICATION_CHANNEL::UNL_CHANGE;
+        }
+        else if (req->channel() == NotificationChannel_HealthEvent &&
+                 (conf::cfg.health.proposal_stats || conf::cfg.health.connectivity_stats))
+        {
+            channel = usr::NOTIFICATION_CHANNEL::HEALTH_STAT;
+        }
+        else
+        {
+            LOG_DEBUG << "User subscription request invalid channel.";
+            return -1;
+        }
+
+        enabled = req->enabled();
+        return 0;
+    }
+
+    /**
+     * Extract query information from a ledger query request.
+     * @param extracted_query Extracted query criteria.
+     * @param extracted_id The query id.
+     * @param d The flatbuffer message holding the query.
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_ledger_query(ledger::query::query_request &extracted_query, std::string &extracted_id, const UserMsg *d)
+    {
+        const LedgerQuery *query = d->content_as_LedgerQuery();
+        if (!query || !query->id() || !query->filter_by())
+        {
+            LOG_DEBUG << "Ledger query required fields missing.";
+            return -1;
+        }
+
+        if (query->id()->size() == 0)
+        {
+            LOG_DEBUG << "Ledger query invalid id.";
+            return -1;
+        }
+
+        if (flatbuf_str_to_sv(query->filter_by()) != msg::usrmsg::QUERY_FILTER_BY_SEQ_NO)
+        {
+            LOG_DEBUG << "Ledger query invalid filter-by criteria.";
+            return -1;
+        }
+
+        extracted_id = flatbuf_str_to_sv(query->id());
+        extracted_query = ledger::query::seq_no_query{
+            query->seq_no(),
+            query->include_inputs(),
+            query->include_outputs()};
+        return 0;
+    }
+
+    /**
+     * Wraps the given content in the root user message and copies the finished buffer into the output message.
+     */
+    void finish_user_msg(std::vector<uint8_t> &msg, flatbuffers::FlatBufferBuilder &builder,
+                         const UserMsgContent content_type, const flatbuffers::Offset<void> content)
+    {
+        FinishUserMsgBuffer(builder, CreateUserMsg(builder, content_type, content));
+
+        const uint8_t *buf = builder.GetBufferPointer();
+        msg.assign(buf, buf + builder.GetSize());
+    }
+
+    const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ByteArray>>>
+    bytes_list_to_flatbuf_byte_arrays(flatbuffers::FlatBufferBuilder &builder, const std::vector<std::string> &list)
+    {
+        std::vector<flatbuffers::Offset<ByteArray>> arrays;
+        arrays.reserve(list.size());
+        for (std::string_view bytes : list)
+            arrays.push_back(CreateByteArray(builder, sv_to_flatbuf_bytes(builder, bytes)));
+        return builder.CreateVector(arrays);
+    }
+
+    const flatbuffers::Offset<HashTreeNode>
+    populate_output_hash_tree(flatbuffers::FlatBufferBuilder &builder, const util::merkle_hash_node &node)
+    {
+        if (node.children.empty())
+        {
+            // The retained node is serialized without a hash.
+            // This is so the client can identify the self-hash position within the hash tree.
+            if (node.is_retained)
+                return CreateHashTreeNode(builder);
+            else
+                return CreateHashTreeNode(builder, sv_to_flatbuf_bytes(builder, node.hash));
+        }
+
+        // Child nodes must be fully built before the parent table is started.
+        std::vector<flatbuffers::Offset<HashTreeNode>> children;
+        children.reserve(node.children.size());
+        for (const auto &child : node.children)
+            children.push_back(populate_output_hash_tree(builder, child));
+
+        return CreateHashTreeNode(builder, 0, builder.CreateVector(children));
+    }
+
+    const flatbuffers::Offset<Ledger>
+    populate_ledger(flatbuffers::FlatBufferBuilder &builder, const ledger::ledger_record &ledger)
+    {
+        // If raw inputs or outputs is not requested, we don't include that field at all in the response.
+        // Otherwise the field will always contain a vector (empty vector if no data).
+
+        flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<LedgerInput>>> inputs = 0;
+        if (ledger.inputs)
+        {
+            std::vector<flatbuffers::Offset<LedgerInput>> list;
+            list.reserve(ledger.inputs->size());
+            for (const ledger::ledger_user_input &inp : *ledger.inputs)
+            {
+                list.push_back(CreateLedgerInput(
+                    builder,
+                    sv_to_flatbuf_bytes(builder, inp.pubkey),
+                    sv_to_flatbuf_bytes(builder, inp.hash),
+                    inp.nonce,
+                    sv_to_flatbuf_bytes(builder, inp.blob)));
+            }
+            inputs = builder.CreateVector(list);
+        }
+
+        flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<LedgerOutput>>> outputs = 0;
+        if (ledger.outputs)
+        {
+            std::vector<flatbuffers::Offset<LedgerOutput>> list;
+            list.reserve(ledger.outputs->size());
+            for (const ledger::ledger_user_output &user : *ledger.outputs)
+            {
+                list.push_back(CreateLedgerOutput(
+                    builder,
+                    sv_to_flatbuf_bytes(builder, user.pubkey),
+                    sv_to_flatbuf_bytes(builder, user.hash),
+                    bytes_list_to_flatbuf_byte_arrays(builder, user.outputs)));
+            }
+            outputs = builder.CreateVector(list);
+        }
+
+        return CreateLedger(
+            builder,
+            ledger.seq_no,
+            ledger.timestamp,
+            sv_to_flatbuf_bytes(builder, ledger.ledger_hash),
+            sv_to_flatbuf_bytes(builder, ledger.prev_ledger_hash),
+            sv_to_flatbuf_bytes(builder, ledger.state_hash),
+            sv_to_flatbuf_bytes(builder, ledger.config_hash),
+            sv_to_flatbuf_bytes(builder, ledger.user_hash),
+            sv_to_flatbuf_bytes(builder, ledger.input_hash),
+            sv_to_flatbuf_bytes(builder, ledger.output_hash),
+            inputs,
+            outputs);
+    }
+
+} // namespace msg::fbuf::usrmsg
@@ -0,0 +1,77 @@
+#ifndef _HP_MSG_FBUF_USRMSG_FBUF_
+#define _HP_MSG_FBUF_USRMSG_FBUF_
+
+#include "../../pchheader.hpp"
+#include "../../util/merkle_hash_tree.hpp"
+#include "../../ledger/ledger_query.hpp"
+#include "../../usr/user_common.hpp"
+#include "../../status.hpp"
+#include "../usrmsg_common.hpp"
+#include "usrmsg_generated.h"
+
+namespace msg::fbuf::usrmsg
+{
+    void create_status_response(std::vector<uint8_t> &msg);
+
+    void create_lcl_response(std::vector<uint8_t> &msg);
+
+    void create_contract_input_status(std::vector<uint8_t> &msg, std::string_view status, std::string_view reason,
+                                      std::string_view input_hash, const uint64_t ledger_seq_no, const util::h32 &ledger_hash);
+
+    void create_contract_read_response_container(std::vector<uint8_t> &msg, std::string_view reply_for, std::string_view content);
+
+    void create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+                                          const uint64_t lcl_seq_no, std::string_view lcl_hash);
+
+    void create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                          std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root);
+
+    void create_unl_notification(std::vector<uint8_t> &msg, const ::std::set<std::string> &unl_list);
+
+    void create_ledger_created_notification(std::vector<uint8_t> &msg, const ledger::ledger_record &ledger);
+
+    void create_vote_status_notification(std::vector<uint8_t> &msg, const status::VOTE_STATUS vote_status);
+
+    void create_health_notification(std::vector<uint8_t> &msg, const status::health_event &ev);
+
+    void create_ledger_query_response(std::vector<uint8_t> &msg, std::string_view reply_for,
+                                      const ledger::query::query_result &result);
+
+    int parse_user_message(const UserMsg *&d, std::string_view message);
+
+    int extract_type(std::string &extracted_type, const UserMsg *d);
+
+    int extract_read_request(std::string &extracted_id, std::string &extracted_content, const UserMsg *d);
+
+    int extract_read_cancel(std::string &extracted_id, const UserMsg *d);
+
+    int extract_signed_input_container(std::string &extracted_input_container, std::string &extracted_sig, const UserMsg *d);
+
+    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no,
+                                bool &streamed, std::string_view contentfbuf);
+
+    int extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size, const UserMsg *d);
+
+    int extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data, const UserMsg *d);
+
+    int extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig, const UserMsg *d);
+
+    int extract_subscription_request(usr::NOTIFICATION_CHANNEL &channel, bool &enabled, const UserMsg *d);
+
+    int extract_ledger_query(ledger::query::query_request &extracted_query, std::string &extracted_id, const UserMsg *d);
+
+    void finish_user_msg(std::vector<uint8_t> &msg, flatbuffers::FlatBufferBuilder &builder,
+                         const UserMsgContent content_type, const flatbuffers::Offset<void> content);
+
+    const flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<ByteArray>>>
+    bytes_list_to_flatbuf_byte_arrays(flatbuffers::FlatBufferBuilder &builder, const std::vector<std::string> &list);
+
+    const flatbuffers::Offset<HashTreeNode>
+    populate_output_hash_tree(flatbuffers::FlatBufferBuilder &builder, const util::merkle_hash_node &node);
+
+    const flatbuffers::Offset<Ledger>
+    populate_ledger(flatbuffers::FlatBufferBuilder &builder, const ledger::ledger_record &ledger);
+
+} // namespace msg::fbuf::usrmsg
+
+#endif
@@ -0,0 +1,3112 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_USRMSG_MSG_FBUF_USRMSG_H_
+#define FLATBUFFERS_GENERATED_USRMSG_MSG_FBUF_USRMSG_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace msg {
+namespace fbuf {
+namespace usrmsg {
+
+struct UserMsg;
+struct UserMsgBuilder;
+
+struct StatRequest;
+struct StatRequestBuilder;
+
+struct LclRequest;
+struct LclRequestBuilder;
+
+struct ContractReadRequest;
+struct ContractReadRequestBuilder;
+
+struct ContractReadCancel;
+struct ContractReadCancelBuilder;
+
+struct ContractInput;
+struct ContractInputBuilder;
+
+struct InputContainer;
+struct InputContainerBuilder;
+
+struct ContractInputBegin;
+struct ContractInputBeginBuilder;
+
+struct ContractInputChunk;
+struct ContractInputChunkBuilder;
+
+struct ContractInputEnd;
+struct ContractInputEndBuilder;
+
+struct SubscriptionRequest;
+struct SubscriptionRequestBuilder;
+
+struct LedgerQuery;
+struct LedgerQueryBuilder;
+
+struct StatResponse;
+struct StatResponseBuilder;
+
+struct LclResponse;
+struct LclResponseBuilder;
+
+struct ContractReadResponse;
+struct ContractReadResponseBuilder;
+
+struct ContractInputStatus;
+struct ContractInputStatusBuilder;
+
+struct HashTreeNode;
+struct HashTreeNodeBuilder;
+
+struct UnlSig;
+struct UnlSigBuilder;
+
+struct ContractOutput;
+struct ContractOutputBuilder;
+
+struct UnlChange;
+struct UnlChangeBuilder;
+
+struct LedgerInput;
+struct LedgerInputBuilder;
+
+struct LedgerOutput;
+struct LedgerOutputBuilder;
+
+struct Ledger;
+struct LedgerBuilder;
+
+struct LedgerCreatedEvent;
+struct LedgerCreatedEventBuilder;
+
+struct VoteStatusEvent;
+struct VoteStatusEventBuilder;
+
+struct LatencyStat;
+struct LatencyStatBuilder;
+
+struct ProposalHealthEvent;
+struct ProposalHealthEventBuilder;
+
+struct ConnectivityHealthEvent;
+struct ConnectivityHealthEventBuilder;
+
+struct LedgerQueryResult;
+struct LedgerQueryResultBuilder;
+
+struct ByteArray;
+struct ByteArrayBuilder;
+
+enum UserMsgContent {
+  UserMsgContent_NONE = 0,
+  UserMsgContent_StatRequest = 1,
+  UserMsgContent_LclRequest = 2,
+  UserMsgContent_ContractReadRequest = 3,
+  UserMsgContent_ContractInput = 4,
+  UserMsgContent_SubscriptionRequest = 5,
+  UserMsgContent_LedgerQuery = 6,
+  UserMsgContent_StatResponse = 7,
+  UserMsgContent_LclResponse = 8,
+  UserMsgContent_ContractReadResponse = 9,
+  UserMsgContent_ContractInputStatus = 10,
+  UserMsgContent_ContractOutput = 11,
+  UserMsgContent_UnlChange = 12,
+  UserMsgContent_LedgerCreatedEvent = 13,
+  UserMsgContent_VoteStatusEvent = 14,
+  UserMsgContent_ProposalHealthEvent = 15,
+  UserMsgContent_ConnectivityHealthEvent = 16,
+  UserMsgContent_LedgerQueryResult = 17,
+  UserMsgContent_ContractInputBegin = 18,
+  UserMsgContent_ContractInputChunk = 19,
+  UserMsgContent_ContractInputEnd = 20,
+  UserMsgContent_ContractReadCancel = 21,
+  UserMsgContent_MIN = UserMsgContent_NONE,
+  UserMsgContent_MAX = UserMsgContent_ContractReadCancel
+};
+
+inline const UserMsgContent (&EnumValuesUserMsgContent())[22] {
+  static const UserMsgContent values[] = {
+    UserMsgContent_NONE,
+    UserMsgContent_StatRequest,
+    UserMsgContent_LclRequest,
+    UserMsgContent_ContractReadRequest,
+    UserMsgContent_ContractInput,
+    UserMsgContent_SubscriptionRequest,
+    UserMsgContent_LedgerQuery,
+    UserMsgContent_StatResponse,
+    UserMsgContent_LclResponse,
+    UserMsgContent_ContractReadResponse,
+    UserMsgContent_ContractInputStatus,
+    UserMsgContent_ContractOutput,
+    UserMsgContent_UnlChange,
+    UserMsgContent_LedgerCreatedEvent,
+    UserMsgContent_VoteStatusEvent,
+    UserMsgContent_ProposalHealthEvent,
+    UserMsgContent_ConnectivityHealthEvent,
+    UserMsgContent_LedgerQueryResult,
+    UserMsgContent_ContractInputBegin,
+    UserMsgContent_ContractInputChunk,
+    UserMsgContent_ContractInputEnd,
+    UserMsgContent_ContractReadCancel
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesUserMsgContent() {
+  static const char * const names[23] = {
+    "NONE",
+    "StatRequest",
+    "LclRequest",
+    "ContractReadRequest",
+    "ContractInput",
+    "SubscriptionRequest",
+    "LedgerQuery",
+    "StatResponse",
+    "LclResponse",
+    "ContractReadResponse",
+    "ContractInputStatus",
+    "ContractOutput",
+    "UnlChange",
+    "LedgerCreatedEvent",
+    "VoteStatusEvent",
+    "ProposalHealthEvent",
+    "ConnectivityHealthEvent",
+    "LedgerQueryResult",
+    "ContractInputBegin",
+    "ContractInputChunk",
+    "ContractInputEnd",
+    "ContractReadCancel",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameUserMsgContent(UserMsgContent e) {
+  if (flatbuffers::IsOutRange(e, UserMsgContent_NONE, UserMsgContent_ContractReadCancel)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesUserMsgContent()[index];
+}
+
+template<typename T> struct UserMsgContentTraits {
+  static const UserMsgContent enum_value = UserMsgContent_NONE;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::StatRequest> {
+  static const UserMsgContent enum_value = UserMsgContent_StatRequest;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::LclRequest> {
+  static const UserMsgContent enum_value = UserMsgContent_LclRequest;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractReadRequest> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractReadRequest;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractInput> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractInput;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::SubscriptionRequest> {
+  static const UserMsgContent enum_value = UserMsgContent_SubscriptionRequest;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::LedgerQuery> {
+  static const UserMsgContent enum_value = UserMsgContent_LedgerQuery;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::StatResponse> {
+  static const UserMsgContent enum_value = UserMsgContent_StatResponse;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::LclResponse> {
+  static const UserMsgContent enum_value = UserMsgContent_LclResponse;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractReadResponse> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractReadResponse;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractInputStatus> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractInputStatus;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractOutput> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractOutput;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::UnlChange> {
+  static const UserMsgContent enum_value = UserMsgContent_UnlChange;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::LedgerCreatedEvent> {
+  static const UserMsgContent enum_value = UserMsgContent_LedgerCreatedEvent;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::VoteStatusEvent> {
+  static const UserMsgContent enum_value = UserMsgContent_VoteStatusEvent;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ProposalHealthEvent> {
+  static const UserMsgContent enum_value = UserMsgContent_ProposalHealthEvent;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ConnectivityHealthEvent> {
+  static const UserMsgContent enum_value = UserMsgContent_ConnectivityHealthEvent;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::LedgerQueryResult> {
+  static const UserMsgContent enum_value = UserMsgContent_LedgerQueryResult;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractInputBegin> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractInputBegin;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractInputChunk> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractInputChunk;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractInputEnd> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractInputEnd;
+};
+
+template<> struct UserMsgContentTraits<msg::fbuf::usrmsg::ContractReadCancel> {
+  static const UserMsgContent enum_value = UserMsgContent_ContractReadCancel;
+};
+
+bool VerifyUserMsgContent(flatbuffers::Verifier &verifier, const void *obj, UserMsgContent type);
+bool VerifyUserMsgContentVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+
+enum NotificationChannel {
+  NotificationChannel_UnlChange = 0,
+  NotificationChannel_LedgerEvent = 1,
+  NotificationChannel_HealthEvent = 2,
+  NotificationChannel_MIN = NotificationChannel_UnlChange,
+  NotificationChannel_MAX = NotificationChannel_HealthEvent
+};
+
+inline const NotificationChannel (&EnumValuesNotificationChannel())[3] {
+  static const NotificationChannel values[] = {
+    NotificationChannel_UnlChange,
+    NotificationChannel_LedgerEvent,
+    NotificationChannel_HealthEvent
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesNotificationChannel() {
+  static const char * const names[4] = {
+    "UnlChange",
+    "LedgerEvent",
+    "HealthEvent",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameNotificationChannel(NotificationChannel e) {
+  if (flatbuffers::IsOutRange(e, NotificationChannel_UnlChange, NotificationChannel_HealthEvent)) return "";
+  const size_t index = static_cast<size_t>(e);
+  return EnumNamesNotificationChannel()[index];
+}
+
+struct UserMsg FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef UserMsgBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CONTENT_TYPE = 4,
+    VT_CONTENT = 6
+  };
+  msg::fbuf::usrmsg::UserMsgContent content_type() const {
+    return static_cast<msg::fbuf::usrmsg::UserMsgContent>(GetField<uint8_t>(VT_CONTENT_TYPE, 0));
+  }
+  const void *content() const {
+    return GetPointer<const void *>(VT_CONTENT);
+  }
+  template<typename T> const T *content_as() const;
+  const msg::fbuf::usrmsg::StatRequest *content_as_StatRequest() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_StatRequest ? static_cast<const msg::fbuf::usrmsg::StatRequest *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::LclRequest *content_as_LclRequest() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_LclRequest ? static_cast<const msg::fbuf::usrmsg::LclRequest *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractReadRequest *content_as_ContractReadRequest() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractReadRequest ? static_cast<const msg::fbuf::usrmsg::ContractReadRequest *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractInput *content_as_ContractInput() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractInput ? static_cast<const msg::fbuf::usrmsg::ContractInput *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::SubscriptionRequest *content_as_SubscriptionRequest() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_SubscriptionRequest ? static_cast<const msg::fbuf::usrmsg::SubscriptionRequest *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::LedgerQuery *content_as_LedgerQuery() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_LedgerQuery ? static_cast<const msg::fbuf::usrmsg::LedgerQuery *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::StatResponse *content_as_StatResponse() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_StatResponse ? static_cast<const msg::fbuf::usrmsg::StatResponse *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::LclResponse *content_as_LclResponse() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_LclResponse ? static_cast<const msg::fbuf::usrmsg::LclResponse *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractReadResponse *content_as_ContractReadResponse() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractReadResponse ? static_cast<const msg::fbuf::usrmsg::ContractReadResponse *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractInputStatus *content_as_ContractInputStatus() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractInputStatus ? static_cast<const msg::fbuf::usrmsg::ContractInputStatus *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractOutput *content_as_ContractOutput() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractOutput ? static_cast<const msg::fbuf::usrmsg::ContractOutput *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::UnlChange *content_as_UnlChange() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_UnlChange ? static_cast<const msg::fbuf::usrmsg::UnlChange *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::LedgerCreatedEvent *content_as_LedgerCreatedEvent() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_LedgerCreatedEvent ? static_cast<const msg::fbuf::usrmsg::LedgerCreatedEvent *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::VoteStatusEvent *content_as_VoteStatusEvent() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_VoteStatusEvent ? static_cast<const msg::fbuf::usrmsg::VoteStatusEvent *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ProposalHealthEvent *content_as_ProposalHealthEvent() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ProposalHealthEvent ? static_cast<const msg::fbuf::usrmsg::ProposalHealthEvent *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ConnectivityHealthEvent *content_as_ConnectivityHealthEvent() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ConnectivityHealthEvent ? static_cast<const msg::fbuf::usrmsg::ConnectivityHealthEvent *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::LedgerQueryResult *content_as_LedgerQueryResult() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_LedgerQueryResult ? static_cast<const msg::fbuf::usrmsg::LedgerQueryResult *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractInputBegin *content_as_ContractInputBegin() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractInputBegin ? static_cast<const msg::fbuf::usrmsg::ContractInputBegin *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractInputChunk *content_as_ContractInputChunk() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractInputChunk ? static_cast<const msg::fbuf::usrmsg::ContractInputChunk *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractInputEnd *content_as_ContractInputEnd() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractInputEnd ? static_cast<const msg::fbuf::usrmsg::ContractInputEnd *>(content()) : nullptr;
+  }
+  const msg::fbuf::usrmsg::ContractReadCancel *content_as_ContractReadCancel() const {
+    return content_type() == msg::fbuf::usrmsg::UserMsgContent_ContractReadCancel ? static_cast<const msg::fbuf::usrmsg::ContractReadCancel *>(content()) : nullptr;
+  }
+  void *mutable_content() {
+    return GetPointer<void *>(VT_CONTENT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_CONTENT_TYPE) &&
+           VerifyOffset(verifier, VT_CONTENT) &&
+           VerifyUserMsgContent(verifier, content(), content_type()) &&
+           verifier.EndTable();
+  }
+};
+
+template<> inline const msg::fbuf::usrmsg::StatRequest *UserMsg::content_as<msg::fbuf::usrmsg::StatRequest>() const {
+  return content_as_StatRequest();
+}
+
+template<> inline const msg::fbuf::usrmsg::LclRequest *UserMsg::content_as<msg::fbuf::usrmsg::LclRequest>() const {
+  return content_as_LclRequest();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractReadRequest *UserMsg::content_as<msg::fbuf::usrmsg::ContractReadRequest>() const {
+  return content_as_ContractReadRequest();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractInput *UserMsg::content_as<msg::fbuf::usrmsg::ContractInput>() const {
+  return content_as_ContractInput();
+}
+
+template<> inline const msg::fbuf::usrmsg::SubscriptionRequest *UserMsg::content_as<msg::fbuf::usrmsg::SubscriptionRequest>() const {
+  return content_as_SubscriptionRequest();
+}
+
+template<> inline const msg::fbuf::usrmsg::LedgerQuery *UserMsg::content_as<msg::fbuf::usrmsg::LedgerQuery>() const {
+  return content_as_LedgerQuery();
+}
+
+template<> inline const msg::fbuf::usrmsg::StatResponse *UserMsg::content_as<msg::fbuf::usrmsg::StatResponse>() const {
+  return content_as_StatResponse();
+}
+
+template<> inline const msg::fbuf::usrmsg::LclResponse *UserMsg::content_as<msg::fbuf::usrmsg::LclResponse>() const {
+  return content_as_LclResponse();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractReadResponse *UserMsg::content_as<msg::fbuf::usrmsg::ContractReadResponse>() const {
+  return content_as_ContractReadResponse();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractInputStatus *UserMsg::content_as<msg::fbuf::usrmsg::ContractInputStatus>() const {
+  return content_as_ContractInputStatus();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractOutput *UserMsg::content_as<msg::fbuf::usrmsg::ContractOutput>() const {
+  return content_as_ContractOutput();
+}
+
+template<> inline const msg::fbuf::usrmsg::UnlChange *UserMsg::content_as<msg::fbuf::usrmsg::UnlChange>() const {
+  return content_as_UnlChange();
+}
+
+template<> inline const msg::fbuf::usrmsg::LedgerCreatedEvent *UserMsg::content_as<msg::fbuf::usrmsg::LedgerCreatedEvent>() const {
+  return content_as_LedgerCreatedEvent();
+}
+
+template<> inline const msg::fbuf::usrmsg::VoteStatusEvent *UserMsg::content_as<msg::fbuf::usrmsg::VoteStatusEvent>() const {
+  return content_as_VoteStatusEvent();
+}
+
+template<> inline const msg::fbuf::usrmsg::ProposalHealthEvent *UserMsg::content_as<msg::fbuf::usrmsg::ProposalHealthEvent>() const {
+  return content_as_ProposalHealthEvent();
+}
+
+template<> inline const msg::fbuf::usrmsg::ConnectivityHealthEvent *UserMsg::content_as<msg::fbuf::usrmsg::ConnectivityHealthEvent>() const {
+  return content_as_ConnectivityHealthEvent();
+}
+
+template<> inline const msg::fbuf::usrmsg::LedgerQueryResult *UserMsg::content_as<msg::fbuf::usrmsg::LedgerQueryResult>() const {
+  return content_as_LedgerQueryResult();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractInputBegin *UserMsg::content_as<msg::fbuf::usrmsg::ContractInputBegin>() const {
+  return content_as_ContractInputBegin();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractInputChunk *UserMsg::content_as<msg::fbuf::usrmsg::ContractInputChunk>() const {
+  return content_as_ContractInputChunk();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractInputEnd *UserMsg::content_as<msg::fbuf::usrmsg::ContractInputEnd>() const {
+  return content_as_ContractInputEnd();
+}
+
+template<> inline const msg::fbuf::usrmsg::ContractReadCancel *UserMsg::content_as<msg::fbuf::usrmsg::ContractReadCancel>() const {
+  return content_as_ContractReadCancel();
+}
+
+struct UserMsgBuilder {
+  typedef UserMsg Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_content_type(msg::fbuf::usrmsg::UserMsgContent content_type) {
+    fbb_.AddElement<uint8_t>(UserMsg::VT_CONTENT_TYPE, static_cast<uint8_t>(content_type), 0);
+  }
+  void add_content(flatbuffers::Offset<void> content) {
+    fbb_.AddOffset(UserMsg::VT_CONTENT, content);
+  }
+  explicit UserMsgBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  UserMsgBuilder &operator=(const UserMsgBuilder &);
+  flatbuffers::Offset<UserMsg> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<UserMsg>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<UserMsg> CreateUserMsg(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    msg::fbuf::usrmsg::UserMsgContent content_type = msg::fbuf::usrmsg::UserMsgContent_NONE,
+    flatbuffers::Offset<void> content = 0) {
+  UserMsgBuilder builder_(_fbb);
+  builder_.add_content(content);
+  builder_.add_content_type(content_type);
+  return builder_.Finish();
+}
+
+struct StatRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef StatRequestBuilder Builder;
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           verifier.EndTable();
+  }
+};
+
+struct StatRequestBuilder {
+  typedef StatRequest Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  explicit StatRequestBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  StatRequestBuilder &operator=(const StatRequestBuilder &);
+  flatbuffers::Offset<StatRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<StatRequest>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<StatRequest> CreateStatRequest(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  StatRequestBuilder builder_(_fbb);
+  return builder_.Finish();
+}
+
+struct LclRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LclRequestBuilder Builder;
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           verifier.EndTable();
+  }
+};
+
+struct LclRequestBuilder {
+  typedef LclRequest Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  explicit LclRequestBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LclRequestBuilder &operator=(const LclRequestBuilder &);
+  flatbuffers::Offset<LclRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LclRequest>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LclRequest> CreateLclRequest(
+    flatbuffers::FlatBufferBuilder &_fbb) {
+  LclRequestBuilder builder_(_fbb);
+  return builder_.Finish();
+}
+
+struct ContractReadRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractReadRequestBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_CONTENT = 6
+  };
+  const flatbuffers::String *id() const {
+    return GetPointer<const flatbuffers::String *>(VT_ID);
+  }
+  flatbuffers::String *mutable_id() {
+    return GetPointer<flatbuffers::String *>(VT_ID);
+  }
+  const flatbuffers::Vector<uint8_t> *content() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_CONTENT);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_content() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_CONTENT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           VerifyOffset(verifier, VT_CONTENT) &&
+           verifier.VerifyVector(content()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractReadRequestBuilder {
+  typedef ContractReadRequest Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(flatbuffers::Offset<flatbuffers::String> id) {
+    fbb_.AddOffset(ContractReadRequest::VT_ID, id);
+  }
+  void add_content(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> content) {
+    fbb_.AddOffset(ContractReadRequest::VT_CONTENT, content);
+  }
+  explicit ContractReadRequestBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractReadRequestBuilder &operator=(const ContractReadRequestBuilder &);
+  flatbuffers::Offset<ContractReadRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractReadRequest>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractReadRequest> CreateContractReadRequest(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> content = 0) {
+  ContractReadRequestBuilder builder_(_fbb);
+  builder_.add_content(content);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractReadRequest> CreateContractReadRequestDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    const std::vector<uint8_t> *content = nullptr) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  auto content__ = content ? _fbb.CreateVector<uint8_t>(*content) : 0;
+  return msg::fbuf::usrmsg::CreateContractReadRequest(
+      _fbb,
+      id__,
+      content__);
+}
+
+struct ContractReadCancel FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractReadCancelBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4
+  };
+  const flatbuffers::String *id() const {
+    return GetPointer<const flatbuffers::String *>(VT_ID);
+  }
+  flatbuffers::String *mutable_id() {
+    return GetPointer<flatbuffers::String *>(VT_ID);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractReadCancelBuilder {
+  typedef ContractReadCancel Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(flatbuffers::Offset<flatbuffers::String> id) {
+    fbb_.AddOffset(ContractReadCancel::VT_ID, id);
+  }
+  explicit ContractReadCancelBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractReadCancelBuilder &operator=(const ContractReadCancelBuilder &);
+  flatbuffers::Offset<ContractReadCancel> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractReadCancel>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractReadCancel> CreateContractReadCancel(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id = 0) {
+  ContractReadCancelBuilder builder_(_fbb);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractReadCancel> CreateContractReadCancelDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  return msg::fbuf::usrmsg::CreateContractReadCancel(
+      _fbb,
+      id__);
+}
+
+struct ContractInput FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractInputBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_INPUT_CONTAINER = 4,
+    VT_SIG = 6
+  };
+  const flatbuffers::Vector<uint8_t> *input_container() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INPUT_CONTAINER);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_input_container() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INPUT_CONTAINER);
+  }
+  const flatbuffers::Vector<uint8_t> *sig() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_SIG);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_sig() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_SIG);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_INPUT_CONTAINER) &&
+           verifier.VerifyVector(input_container()) &&
+           VerifyOffset(verifier, VT_SIG) &&
+           verifier.VerifyVector(sig()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractInputBuilder {
+  typedef ContractInput Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_input_container(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_container) {
+    fbb_.AddOffset(ContractInput::VT_INPUT_CONTAINER, input_container);
+  }
+  void add_sig(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> sig) {
+    fbb_.AddOffset(ContractInput::VT_SIG, sig);
+  }
+  explicit ContractInputBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractInputBuilder &operator=(const ContractInputBuilder &);
+  flatbuffers::Offset<ContractInput> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractInput>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractInput> CreateContractInput(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_container = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> sig = 0) {
+  ContractInputBuilder builder_(_fbb);
+  builder_.add_sig(sig);
+  builder_.add_input_container(input_container);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractInput> CreateContractInputDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *input_container = nullptr,
+    const std::vector<uint8_t> *sig = nullptr) {
+  auto input_container__ = input_container ? _fbb.CreateVector<uint8_t>(*input_container) : 0;
+  auto sig__ = sig ? _fbb.CreateVector<uint8_t>(*sig) : 0;
+  return msg::fbuf::usrmsg::CreateContractInput(
+      _fbb,
+      input_container__,
+      sig__);
+}
+
+struct InputContainer FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef InputContainerBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_INPUT = 4,
+    VT_NONCE = 6,
+    VT_MAX_LEDGER_SEQ_NO = 8,
+    VT_STREAMED = 10
+  };
+  const flatbuffers::Vector<uint8_t> *input() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INPUT);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_input() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INPUT);
+  }
+  uint64_t nonce() const {
+    return GetField<uint64_t>(VT_NONCE, 0);
+  }
+  bool mutate_nonce(uint64_t _nonce) {
+    return SetField<uint64_t>(VT_NONCE, _nonce, 0);
+  }
+  uint64_t max_ledger_seq_no() const {
+    return GetField<uint64_t>(VT_MAX_LEDGER_SEQ_NO, 0);
+  }
+  bool mutate_max_ledger_seq_no(uint64_t _max_ledger_seq_no) {
+    return SetField<uint64_t>(VT_MAX_LEDGER_SEQ_NO, _max_ledger_seq_no, 0);
+  }
+  bool streamed() const {
+    return GetField<uint8_t>(VT_STREAMED, 0) != 0;
+  }
+  bool mutate_streamed(bool _streamed) {
+    return SetField<uint8_t>(VT_STREAMED, static_cast<uint8_t>(_streamed), 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_INPUT) &&
+           verifier.VerifyVector(input()) &&
+           VerifyField<uint64_t>(verifier, VT_NONCE) &&
+           VerifyField<uint64_t>(verifier, VT_MAX_LEDGER_SEQ_NO) &&
+           VerifyField<uint8_t>(verifier, VT_STREAMED) &&
+           verifier.EndTable();
+  }
+};
+
+struct InputContainerBuilder {
+  typedef InputContainer Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_input(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input) {
+    fbb_.AddOffset(InputContainer::VT_INPUT, input);
+  }
+  void add_nonce(uint64_t nonce) {
+    fbb_.AddElement<uint64_t>(InputContainer::VT_NONCE, nonce, 0);
+  }
+  void add_max_ledger_seq_no(uint64_t max_ledger_seq_no) {
+    fbb_.AddElement<uint64_t>(InputContainer::VT_MAX_LEDGER_SEQ_NO, max_ledger_seq_no, 0);
+  }
+  void add_streamed(bool streamed) {
+    fbb_.AddElement<uint8_t>(InputContainer::VT_STREAMED, static_cast<uint8_t>(streamed), 0);
+  }
+  explicit InputContainerBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  InputContainerBuilder &operator=(const InputContainerBuilder &);
+  flatbuffers::Offset<InputContainer> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<InputContainer>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<InputContainer> CreateInputContainer(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input = 0,
+    uint64_t nonce = 0,
+    uint64_t max_ledger_seq_no = 0,
+    bool streamed = false) {
+  InputContainerBuilder builder_(_fbb);
+  builder_.add_max_ledger_seq_no(max_ledger_seq_no);
+  builder_.add_nonce(nonce);
+  builder_.add_input(input);
+  builder_.add_streamed(streamed);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<InputContainer> CreateInputContainerDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *input = nullptr,
+    uint64_t nonce = 0,
+    uint64_t max_ledger_seq_no = 0,
+    bool streamed = false) {
+  auto input__ = input ? _fbb.CreateVector<uint8_t>(*input) : 0;
+  return msg::fbuf::usrmsg::CreateInputContainer(
+      _fbb,
+      input__,
+      nonce,
+      max_ledger_seq_no,
+      streamed);
+}
+
+struct ContractInputBegin FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractInputBeginBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_SIZE = 6
+  };
+  const flatbuffers::String *id() const {
+    return GetPointer<const flatbuffers::String *>(VT_ID);
+  }
+  flatbuffers::String *mutable_id() {
+    return GetPointer<flatbuffers::String *>(VT_ID);
+  }
+  uint64_t size() const {
+    return GetField<uint64_t>(VT_SIZE, 0);
+  }
+  bool mutate_size(uint64_t _size) {
+    return SetField<uint64_t>(VT_SIZE, _size, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           VerifyField<uint64_t>(verifier, VT_SIZE) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractInputBeginBuilder {
+  typedef ContractInputBegin Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(flatbuffers::Offset<flatbuffers::String> id) {
+    fbb_.AddOffset(ContractInputBegin::VT_ID, id);
+  }
+  void add_size(uint64_t size) {
+    fbb_.AddElement<uint64_t>(ContractInputBegin::VT_SIZE, size, 0);
+  }
+  explicit ContractInputBeginBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractInputBeginBuilder &operator=(const ContractInputBeginBuilder &);
+  flatbuffers::Offset<ContractInputBegin> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractInputBegin>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractInputBegin> CreateContractInputBegin(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id = 0,
+    uint64_t size = 0) {
+  ContractInputBeginBuilder builder_(_fbb);
+  builder_.add_size(size);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractInputBegin> CreateContractInputBeginDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    uint64_t size = 0) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  return msg::fbuf::usrmsg::CreateContractInputBegin(
+      _fbb,
+      id__,
+      size);
+}
+
+struct ContractInputChunk FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractInputChunkBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_DATA = 6
+  };
+  const flatbuffers::String *id() const {
+    return GetPointer<const flatbuffers::String *>(VT_ID);
+  }
+  flatbuffers::String *mutable_id() {
+    return GetPointer<flatbuffers::String *>(VT_ID);
+  }
+  const flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_data() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractInputChunkBuilder {
+  typedef ContractInputChunk Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(flatbuffers::Offset<flatbuffers::String> id) {
+    fbb_.AddOffset(ContractInputChunk::VT_ID, id);
+  }
+  void add_data(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(ContractInputChunk::VT_DATA, data);
+  }
+  explicit ContractInputChunkBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractInputChunkBuilder &operator=(const ContractInputChunkBuilder &);
+  flatbuffers::Offset<ContractInputChunk> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractInputChunk>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractInputChunk> CreateContractInputChunk(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = 0) {
+  ContractInputChunkBuilder builder_(_fbb);
+  builder_.add_data(data);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractInputChunk> CreateContractInputChunkDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return msg::fbuf::usrmsg::CreateContractInputChunk(
+      _fbb,
+      id__,
+      data__);
+}
+
+struct ContractInputEnd FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractInputEndBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_INPUT_CONTAINER = 6,
+    VT_SIG = 8
+  };
+  const flatbuffers::String *id() const {
+    return GetPointer<const flatbuffers::String *>(VT_ID);
+  }
+  flatbuffers::String *mutable_id() {
+    return GetPointer<flatbuffers::String *>(VT_ID);
+  }
+  const flatbuffers::Vector<uint8_t> *input_container() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INPUT_CONTAINER);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_input_container() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INPUT_CONTAINER);
+  }
+  const flatbuffers::Vector<uint8_t> *sig() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_SIG);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_sig() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_SIG);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           VerifyOffset(verifier, VT_INPUT_CONTAINER) &&
+           verifier.VerifyVector(input_container()) &&
+           VerifyOffset(verifier, VT_SIG) &&
+           verifier.VerifyVector(sig()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractInputEndBuilder {
+  typedef ContractInputEnd Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(flatbuffers::Offset<flatbuffers::String> id) {
+    fbb_.AddOffset(ContractInputEnd::VT_ID, id);
+  }
+  void add_input_container(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_container) {
+    fbb_.AddOffset(ContractInputEnd::VT_INPUT_CONTAINER, input_container);
+  }
+  void add_sig(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> sig) {
+    fbb_.AddOffset(ContractInputEnd::VT_SIG, sig);
+  }
+  explicit ContractInputEndBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractInputEndBuilder &operator=(const ContractInputEndBuilder &);
+  flatbuffers::Offset<ContractInputEnd> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractInputEnd>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractInputEnd> CreateContractInputEnd(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_container = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> sig = 0) {
+  ContractInputEndBuilder builder_(_fbb);
+  builder_.add_sig(sig);
+  builder_.add_input_container(input_container);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractInputEnd> CreateContractInputEndDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    const std::vector<uint8_t> *input_container = nullptr,
+    const std::vector<uint8_t> *sig = nullptr) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  auto input_container__ = input_container ? _fbb.CreateVector<uint8_t>(*input_container) : 0;
+  auto sig__ = sig ? _fbb.CreateVector<uint8_t>(*sig) : 0;
+  return msg::fbuf::usrmsg::CreateContractInputEnd(
+      _fbb,
+      id__,
+      input_container__,
+      sig__);
+}
+
+struct SubscriptionRequest FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef SubscriptionRequestBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_CHANNEL = 4,
+    VT_ENABLED = 6
+  };
+  msg::fbuf::usrmsg::NotificationChannel channel() const {
+    return static_cast<msg::fbuf::usrmsg::NotificationChannel>(GetField<uint8_t>(VT_CHANNEL, 0));
+  }
+  bool mutate_channel(msg::fbuf::usrmsg::NotificationChannel _channel) {
+    return SetField<uint8_t>(VT_CHANNEL, static_cast<uint8_t>(_channel), 0);
+  }
+  bool enabled() const {
+    return GetField<uint8_t>(VT_ENABLED, 0) != 0;
+  }
+  bool mutate_enabled(bool _enabled) {
+    return SetField<uint8_t>(VT_ENABLED, static_cast<uint8_t>(_enabled), 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_CHANNEL) &&
+           VerifyField<uint8_t>(verifier, VT_ENABLED) &&
+           verifier.EndTable();
+  }
+};
+
+struct SubscriptionRequestBuilder {
+  typedef SubscriptionRequest Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_channel(msg::fbuf::usrmsg::NotificationChannel channel) {
+    fbb_.AddElement<uint8_t>(SubscriptionRequest::VT_CHANNEL, static_cast<uint8_t>(channel), 0);
+  }
+  void add_enabled(bool enabled) {
+    fbb_.AddElement<uint8_t>(SubscriptionRequest::VT_ENABLED, static_cast<uint8_t>(enabled), 0);
+  }
+  explicit SubscriptionRequestBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  SubscriptionRequestBuilder &operator=(const SubscriptionRequestBuilder &);
+  flatbuffers::Offset<SubscriptionRequest> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<SubscriptionRequest>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<SubscriptionRequest> CreateSubscriptionRequest(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    msg::fbuf::usrmsg::NotificationChannel channel = msg::fbuf::usrmsg::NotificationChannel_UnlChange,
+    bool enabled = false) {
+  SubscriptionRequestBuilder builder_(_fbb);
+  builder_.add_enabled(enabled);
+  builder_.add_channel(channel);
+  return builder_.Finish();
+}
+
+struct LedgerQuery FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LedgerQueryBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_FILTER_BY = 6,
+    VT_SEQ_NO = 8,
+    VT_INCLUDE_INPUTS = 10,
+    VT_INCLUDE_OUTPUTS = 12
+  };
+  const flatbuffers::String *id() const {
+    return GetPointer<const flatbuffers::String *>(VT_ID);
+  }
+  flatbuffers::String *mutable_id() {
+    return GetPointer<flatbuffers::String *>(VT_ID);
+  }
+  const flatbuffers::String *filter_by() const {
+    return GetPointer<const flatbuffers::String *>(VT_FILTER_BY);
+  }
+  flatbuffers::String *mutable_filter_by() {
+    return GetPointer<flatbuffers::String *>(VT_FILTER_BY);
+  }
+  uint64_t seq_no() const {
+    return GetField<uint64_t>(VT_SEQ_NO, 0);
+  }
+  bool mutate_seq_no(uint64_t _seq_no) {
+    return SetField<uint64_t>(VT_SEQ_NO, _seq_no, 0);
+  }
+  bool include_inputs() const {
+    return GetField<uint8_t>(VT_INCLUDE_INPUTS, 0) != 0;
+  }
+  bool mutate_include_inputs(bool _include_inputs) {
+    return SetField<uint8_t>(VT_INCLUDE_INPUTS, static_cast<uint8_t>(_include_inputs), 0);
+  }
+  bool include_outputs() const {
+    return GetField<uint8_t>(VT_INCLUDE_OUTPUTS, 0) != 0;
+  }
+  bool mutate_include_outputs(bool _include_outputs) {
+    return SetField<uint8_t>(VT_INCLUDE_OUTPUTS, static_cast<uint8_t>(_include_outputs), 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ID) &&
+           verifier.VerifyString(id()) &&
+           VerifyOffset(verifier, VT_FILTER_BY) &&
+           verifier.VerifyString(filter_by()) &&
+           VerifyField<uint64_t>(verifier, VT_SEQ_NO) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_INPUTS) &&
+           VerifyField<uint8_t>(verifier, VT_INCLUDE_OUTPUTS) &&
+           verifier.EndTable();
+  }
+};
+
+struct LedgerQueryBuilder {
+  typedef LedgerQuery Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(flatbuffers::Offset<flatbuffers::String> id) {
+    fbb_.AddOffset(LedgerQuery::VT_ID, id);
+  }
+  void add_filter_by(flatbuffers::Offset<flatbuffers::String> filter_by) {
+    fbb_.AddOffset(LedgerQuery::VT_FILTER_BY, filter_by);
+  }
+  void add_seq_no(uint64_t seq_no) {
+    fbb_.AddElement<uint64_t>(LedgerQuery::VT_SEQ_NO, seq_no, 0);
+  }
+  void add_include_inputs(bool include_inputs) {
+    fbb_.AddElement<uint8_t>(LedgerQuery::VT_INCLUDE_INPUTS, static_cast<uint8_t>(include_inputs), 0);
+  }
+  void add_include_outputs(bool include_outputs) {
+    fbb_.AddElement<uint8_t>(LedgerQuery::VT_INCLUDE_OUTPUTS, static_cast<uint8_t>(include_outputs), 0);
+  }
+  explicit LedgerQueryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LedgerQueryBuilder &operator=(const LedgerQueryBuilder &);
+  flatbuffers::Offset<LedgerQuery> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LedgerQuery>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LedgerQuery> CreateLedgerQuery(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id = 0,
+    flatbuffers::Offset<flatbuffers::String> filter_by = 0,
+    uint64_t seq_no = 0,
+    bool include_inputs = false,
+    bool include_outputs = false) {
+  LedgerQueryBuilder builder_(_fbb);
+  builder_.add_seq_no(seq_no);
+  builder_.add_filter_by(filter_by);
+  builder_.add_id(id);
+  builder_.add_include_outputs(include_outputs);
+  builder_.add_include_inputs(include_inputs);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<LedgerQuery> CreateLedgerQueryDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *id = nullptr,
+    const char *filter_by = nullptr,
+    uint64_t seq_no = 0,
+    bool include_inputs = false,
+    bool include_outputs = false) {
+  auto id__ = id ? _fbb.CreateString(id) : 0;
+  auto filter_by__ = filter_by ? _fbb.CreateString(filter_by) : 0;
+  return msg::fbuf::usrmsg::CreateLedgerQuery(
+      _fbb,
+      id__,
+      filter_by__,
+      seq_no,
+      include_inputs,
+      include_outputs);
+}
+
+struct StatResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef StatResponseBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_HP_VERSION = 4,
+    VT_LEDGER_SEQ_NO = 6,
+    VT_LEDGER_HASH = 8,
+    VT_VOTE_STATUS = 10,
+    VT_ROUND_TIME = 12,
+    VT_CONTRACT_EXECUTION_ENABLED = 14,
+    VT_READ_REQUESTS_ENABLED = 16,
+    VT_IS_FULL_HISTORY_NODE = 18,
+    VT_WEAKLY_CONNECTED = 20,
+    VT_CURRENT_UNL = 22,
+    VT_PEERS = 24
+  };
+  const flatbuffers::String *hp_version() const {
+    return GetPointer<const flatbuffers::String *>(VT_HP_VERSION);
+  }
+  flatbuffers::String *mutable_hp_version() {
+    return GetPointer<flatbuffers::String *>(VT_HP_VERSION);
+  }
+  uint64_t ledger_seq_no() const {
+    return GetField<uint64_t>(VT_LEDGER_SEQ_NO, 0);
+  }
+  bool mutate_ledger_seq_no(uint64_t _ledger_seq_no) {
+    return SetField<uint64_t>(VT_LEDGER_SEQ_NO, _ledger_seq_no, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *ledger_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_ledger_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  const flatbuffers::String *vote_status() const {
+    return GetPointer<const flatbuffers::String *>(VT_VOTE_STATUS);
+  }
+  flatbuffers::String *mutable_vote_status() {
+    return GetPointer<flatbuffers::String *>(VT_VOTE_STATUS);
+  }
+  uint64_t round_time() const {
+    return GetField<uint64_t>(VT_ROUND_TIME, 0);
+  }
+  bool mutate_round_time(uint64_t _round_time) {
+    return SetField<uint64_t>(VT_ROUND_TIME, _round_time, 0);
+  }
+  bool contract_execution_enabled() const {
+    return GetField<uint8_t>(VT_CONTRACT_EXECUTION_ENABLED, 0) != 0;
+  }
+  bool mutate_contract_execution_enabled(bool _contract_execution_enabled) {
+    return SetField<uint8_t>(VT_CONTRACT_EXECUTION_ENABLED, static_cast<uint8_t>(_contract_execution_enabled), 0);
+  }
+  bool read_requests_enabled() const {
+    return GetField<uint8_t>(VT_READ_REQUESTS_ENABLED, 0) != 0;
+  }
+  bool mutate_read_requests_enabled(bool _read_requests_enabled) {
+    return SetField<uint8_t>(VT_READ_REQUESTS_ENABLED, static_cast<uint8_t>(_read_requests_enabled), 0);
+  }
+  bool is_full_history_node() const {
+    return GetField<uint8_t>(VT_IS_FULL_HISTORY_NODE, 0) != 0;
+  }
+  bool mutate_is_full_history_node(bool _is_full_history_node) {
+    return SetField<uint8_t>(VT_IS_FULL_HISTORY_NODE, static_cast<uint8_t>(_is_full_history_node), 0);
+  }
+  bool weakly_connected() const {
+    return GetField<uint8_t>(VT_WEAKLY_CONNECTED, 0) != 0;
+  }
+  bool mutate_weakly_connected(bool _weakly_connected) {
+    return SetField<uint8_t>(VT_WEAKLY_CONNECTED, static_cast<uint8_t>(_weakly_connected), 0);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *current_unl() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_CURRENT_UNL);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *mutable_current_unl() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_CURRENT_UNL);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *peers() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_PEERS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_peers() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_PEERS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_HP_VERSION) &&
+           verifier.VerifyString(hp_version()) &&
+           VerifyField<uint64_t>(verifier, VT_LEDGER_SEQ_NO) &&
+           VerifyOffset(verifier, VT_LEDGER_HASH) &&
+           verifier.VerifyVector(ledger_hash()) &&
+           VerifyOffset(verifier, VT_VOTE_STATUS) &&
+           verifier.VerifyString(vote_status()) &&
+           VerifyField<uint64_t>(verifier, VT_ROUND_TIME) &&
+           VerifyField<uint8_t>(verifier, VT_CONTRACT_EXECUTION_ENABLED) &&
+           VerifyField<uint8_t>(verifier, VT_READ_REQUESTS_ENABLED) &&
+           VerifyField<uint8_t>(verifier, VT_IS_FULL_HISTORY_NODE) &&
+           VerifyField<uint8_t>(verifier, VT_WEAKLY_CONNECTED) &&
+           VerifyOffset(verifier, VT_CURRENT_UNL) &&
+           verifier.VerifyVector(current_unl()) &&
+           verifier.VerifyVectorOfTables(current_unl()) &&
+           VerifyOffset(verifier, VT_PEERS) &&
+           verifier.VerifyVector(peers()) &&
+           verifier.VerifyVectorOfStrings(peers()) &&
+           verifier.EndTable();
+  }
+};
+
+struct StatResponseBuilder {
+  typedef StatResponse Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_hp_version(flatbuffers::Offset<flatbuffers::String> hp_version) {
+    fbb_.AddOffset(StatResponse::VT_HP_VERSION, hp_version);
+  }
+  void add_ledger_seq_no(uint64_t ledger_seq_no) {
+    fbb_.AddElement<uint64_t>(StatResponse::VT_LEDGER_SEQ_NO, ledger_seq_no, 0);
+  }
+  void add_ledger_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash) {
+    fbb_.AddOffset(StatResponse::VT_LEDGER_HASH, ledger_hash);
+  }
+  void add_vote_status(flatbuffers::Offset<flatbuffers::String> vote_status) {
+    fbb_.AddOffset(StatResponse::VT_VOTE_STATUS, vote_status);
+  }
+  void add_round_time(uint64_t round_time) {
+    fbb_.AddElement<uint64_t>(StatResponse::VT_ROUND_TIME, round_time, 0);
+  }
+  void add_contract_execution_enabled(bool contract_execution_enabled) {
+    fbb_.AddElement<uint8_t>(StatResponse::VT_CONTRACT_EXECUTION_ENABLED, static_cast<uint8_t>(contract_execution_enabled), 0);
+  }
+  void add_read_requests_enabled(bool read_requests_enabled) {
+    fbb_.AddElement<uint8_t>(StatResponse::VT_READ_REQUESTS_ENABLED, static_cast<uint8_t>(read_requests_enabled), 0);
+  }
+  void add_is_full_history_node(bool is_full_history_node) {
+    fbb_.AddElement<uint8_t>(StatResponse::VT_IS_FULL_HISTORY_NODE, static_cast<uint8_t>(is_full_history_node), 0);
+  }
+  void add_weakly_connected(bool weakly_connected) {
+    fbb_.AddElement<uint8_t>(StatResponse::VT_WEAKLY_CONNECTED, static_cast<uint8_t>(weakly_connected), 0);
+  }
+  void add_current_unl(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> current_unl) {
+    fbb_.AddOffset(StatResponse::VT_CURRENT_UNL, current_unl);
+  }
+  void add_peers(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> peers) {
+    fbb_.AddOffset(StatResponse::VT_PEERS, peers);
+  }
+  explicit StatResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  StatResponseBuilder &operator=(const StatResponseBuilder &);
+  flatbuffers::Offset<StatResponse> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<StatResponse>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<StatResponse> CreateStatResponse(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> hp_version = 0,
+    uint64_t ledger_seq_no = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash = 0,
+    flatbuffers::Offset<flatbuffers::String> vote_status = 0,
+    uint64_t round_time = 0,
+    bool contract_execution_enabled = false,
+    bool read_requests_enabled = false,
+    bool is_full_history_node = false,
+    bool weakly_connected = false,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> current_unl = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> peers = 0) {
+  StatResponseBuilder builder_(_fbb);
+  builder_.add_round_time(round_time);
+  builder_.add_ledger_seq_no(ledger_seq_no);
+  builder_.add_peers(peers);
+  builder_.add_current_unl(current_unl);
+  builder_.add_vote_status(vote_status);
+  builder_.add_ledger_hash(ledger_hash);
+  builder_.add_hp_version(hp_version);
+  builder_.add_weakly_connected(weakly_connected);
+  builder_.add_is_full_history_node(is_full_history_node);
+  builder_.add_read_requests_enabled(read_requests_enabled);
+  builder_.add_contract_execution_enabled(contract_execution_enabled);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<StatResponse> CreateStatResponseDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *hp_version = nullptr,
+    uint64_t ledger_seq_no = 0,
+    const std::vector<uint8_t> *ledger_hash = nullptr,
+    const char *vote_status = nullptr,
+    uint64_t round_time = 0,
+    bool contract_execution_enabled = false,
+    bool read_requests_enabled = false,
+    bool is_full_history_node = false,
+    bool weakly_connected = false,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *current_unl = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *peers = nullptr) {
+  auto hp_version__ = hp_version ? _fbb.CreateString(hp_version) : 0;
+  auto ledger_hash__ = ledger_hash ? _fbb.CreateVector<uint8_t>(*ledger_hash) : 0;
+  auto vote_status__ = vote_status ? _fbb.CreateString(vote_status) : 0;
+  auto current_unl__ = current_unl ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>(*current_unl) : 0;
+  auto peers__ = peers ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*peers) : 0;
+  return msg::fbuf::usrmsg::CreateStatResponse(
+      _fbb,
+      hp_version__,
+      ledger_seq_no,
+      ledger_hash__,
+      vote_status__,
+      round_time,
+      contract_execution_enabled,
+      read_requests_enabled,
+      is_full_history_node,
+      weakly_connected,
+      current_unl__,
+      peers__);
+}
+
+struct LclResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LclResponseBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_LEDGER_SEQ_NO = 4,
+    VT_LEDGER_HASH = 6
+  };
+  uint64_t ledger_seq_no() const {
+    return GetField<uint64_t>(VT_LEDGER_SEQ_NO, 0);
+  }
+  bool mutate_ledger_seq_no(uint64_t _ledger_seq_no) {
+    return SetField<uint64_t>(VT_LEDGER_SEQ_NO, _ledger_seq_no, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *ledger_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_ledger_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_LEDGER_SEQ_NO) &&
+           VerifyOffset(verifier, VT_LEDGER_HASH) &&
+           verifier.VerifyVector(ledger_hash()) &&
+           verifier.EndTable();
+  }
+};
+
+struct LclResponseBuilder {
+  typedef LclResponse Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_ledger_seq_no(uint64_t ledger_seq_no) {
+    fbb_.AddElement<uint64_t>(LclResponse::VT_LEDGER_SEQ_NO, ledger_seq_no, 0);
+  }
+  void add_ledger_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash) {
+    fbb_.AddOffset(LclResponse::VT_LEDGER_HASH, ledger_hash);
+  }
+  explicit LclResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LclResponseBuilder &operator=(const LclResponseBuilder &);
+  flatbuffers::Offset<LclResponse> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LclResponse>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LclResponse> CreateLclResponse(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t ledger_seq_no = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash = 0) {
+  LclResponseBuilder builder_(_fbb);
+  builder_.add_ledger_seq_no(ledger_seq_no);
+  builder_.add_ledger_hash(ledger_hash);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<LclResponse> CreateLclResponseDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t ledger_seq_no = 0,
+    const std::vector<uint8_t> *ledger_hash = nullptr) {
+  auto ledger_hash__ = ledger_hash ? _fbb.CreateVector<uint8_t>(*ledger_hash) : 0;
+  return msg::fbuf::usrmsg::CreateLclResponse(
+      _fbb,
+      ledger_seq_no,
+      ledger_hash__);
+}
+
+struct ContractReadResponse FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractReadResponseBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_REPLY_FOR = 4,
+    VT_CONTENT = 6
+  };
+  const flatbuffers::String *reply_for() const {
+    return GetPointer<const flatbuffers::String *>(VT_REPLY_FOR);
+  }
+  flatbuffers::String *mutable_reply_for() {
+    return GetPointer<flatbuffers::String *>(VT_REPLY_FOR);
+  }
+  const flatbuffers::Vector<uint8_t> *content() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_CONTENT);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_content() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_CONTENT);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_REPLY_FOR) &&
+           verifier.VerifyString(reply_for()) &&
+           VerifyOffset(verifier, VT_CONTENT) &&
+           verifier.VerifyVector(content()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractReadResponseBuilder {
+  typedef ContractReadResponse Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_reply_for(flatbuffers::Offset<flatbuffers::String> reply_for) {
+    fbb_.AddOffset(ContractReadResponse::VT_REPLY_FOR, reply_for);
+  }
+  void add_content(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> content) {
+    fbb_.AddOffset(ContractReadResponse::VT_CONTENT, content);
+  }
+  explicit ContractReadResponseBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractReadResponseBuilder &operator=(const ContractReadResponseBuilder &);
+  flatbuffers::Offset<ContractReadResponse> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractReadResponse>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractReadResponse> CreateContractReadResponse(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> reply_for = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> content = 0) {
+  ContractReadResponseBuilder builder_(_fbb);
+  builder_.add_content(content);
+  builder_.add_reply_for(reply_for);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractReadResponse> CreateContractReadResponseDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *reply_for = nullptr,
+    const std::vector<uint8_t> *content = nullptr) {
+  auto reply_for__ = reply_for ? _fbb.CreateString(reply_for) : 0;
+  auto content__ = content ? _fbb.CreateVector<uint8_t>(*content) : 0;
+  return msg::fbuf::usrmsg::CreateContractReadResponse(
+      _fbb,
+      reply_for__,
+      content__);
+}
+
+struct ContractInputStatus FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractInputStatusBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_STATUS = 4,
+    VT_REASON = 6,
+    VT_INPUT_HASH = 8,
+    VT_LEDGER_SEQ_NO = 10,
+    VT_LEDGER_HASH = 12
+  };
+  const flatbuffers::String *status() const {
+    return GetPointer<const flatbuffers::String *>(VT_STATUS);
+  }
+  flatbuffers::String *mutable_status() {
+    return GetPointer<flatbuffers::String *>(VT_STATUS);
+  }
+  const flatbuffers::String *reason() const {
+    return GetPointer<const flatbuffers::String *>(VT_REASON);
+  }
+  flatbuffers::String *mutable_reason() {
+    return GetPointer<flatbuffers::String *>(VT_REASON);
+  }
+  const flatbuffers::Vector<uint8_t> *input_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INPUT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_input_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INPUT_HASH);
+  }
+  uint64_t ledger_seq_no() const {
+    return GetField<uint64_t>(VT_LEDGER_SEQ_NO, 0);
+  }
+  bool mutate_ledger_seq_no(uint64_t _ledger_seq_no) {
+    return SetField<uint64_t>(VT_LEDGER_SEQ_NO, _ledger_seq_no, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *ledger_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_ledger_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_STATUS) &&
+           verifier.VerifyString(status()) &&
+           VerifyOffset(verifier, VT_REASON) &&
+           verifier.VerifyString(reason()) &&
+           VerifyOffset(verifier, VT_INPUT_HASH) &&
+           verifier.VerifyVector(input_hash()) &&
+           VerifyField<uint64_t>(verifier, VT_LEDGER_SEQ_NO) &&
+           VerifyOffset(verifier, VT_LEDGER_HASH) &&
+           verifier.VerifyVector(ledger_hash()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractInputStatusBuilder {
+  typedef ContractInputStatus Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_status(flatbuffers::Offset<flatbuffers::String> status) {
+    fbb_.AddOffset(ContractInputStatus::VT_STATUS, status);
+  }
+  void add_reason(flatbuffers::Offset<flatbuffers::String> reason) {
+    fbb_.AddOffset(ContractInputStatus::VT_REASON, reason);
+  }
+  void add_input_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_hash) {
+    fbb_.AddOffset(ContractInputStatus::VT_INPUT_HASH, input_hash);
+  }
+  void add_ledger_seq_no(uint64_t ledger_seq_no) {
+    fbb_.AddElement<uint64_t>(ContractInputStatus::VT_LEDGER_SEQ_NO, ledger_seq_no, 0);
+  }
+  void add_ledger_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash) {
+    fbb_.AddOffset(ContractInputStatus::VT_LEDGER_HASH, ledger_hash);
+  }
+  explicit ContractInputStatusBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractInputStatusBuilder &operator=(const ContractInputStatusBuilder &);
+  flatbuffers::Offset<ContractInputStatus> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractInputStatus>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractInputStatus> CreateContractInputStatus(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> status = 0,
+    flatbuffers::Offset<flatbuffers::String> reason = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_hash = 0,
+    uint64_t ledger_seq_no = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash = 0) {
+  ContractInputStatusBuilder builder_(_fbb);
+  builder_.add_ledger_seq_no(ledger_seq_no);
+  builder_.add_ledger_hash(ledger_hash);
+  builder_.add_input_hash(input_hash);
+  builder_.add_reason(reason);
+  builder_.add_status(status);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractInputStatus> CreateContractInputStatusDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *status = nullptr,
+    const char *reason = nullptr,
+    const std::vector<uint8_t> *input_hash = nullptr,
+    uint64_t ledger_seq_no = 0,
+    const std::vector<uint8_t> *ledger_hash = nullptr) {
+  auto status__ = status ? _fbb.CreateString(status) : 0;
+  auto reason__ = reason ? _fbb.CreateString(reason) : 0;
+  auto input_hash__ = input_hash ? _fbb.CreateVector<uint8_t>(*input_hash) : 0;
+  auto ledger_hash__ = ledger_hash ? _fbb.CreateVector<uint8_t>(*ledger_hash) : 0;
+  return msg::fbuf::usrmsg::CreateContractInputStatus(
+      _fbb,
+      status__,
+      reason__,
+      input_hash__,
+      ledger_seq_no,
+      ledger_hash__);
+}
+
+struct HashTreeNode FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef HashTreeNodeBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_HASH = 4,
+    VT_CHILDREN = 6
+  };
+  const flatbuffers::Vector<uint8_t> *hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>> *children() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>> *>(VT_CHILDREN);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>> *mutable_children() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>> *>(VT_CHILDREN);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_HASH) &&
+           verifier.VerifyVector(hash()) &&
+           VerifyOffset(verifier, VT_CHILDREN) &&
+           verifier.VerifyVector(children()) &&
+           verifier.VerifyVectorOfTables(children()) &&
+           verifier.EndTable();
+  }
+};
+
+struct HashTreeNodeBuilder {
+  typedef HashTreeNode Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash) {
+    fbb_.AddOffset(HashTreeNode::VT_HASH, hash);
+  }
+  void add_children(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>>> children) {
+    fbb_.AddOffset(HashTreeNode::VT_CHILDREN, children);
+  }
+  explicit HashTreeNodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  HashTreeNodeBuilder &operator=(const HashTreeNodeBuilder &);
+  flatbuffers::Offset<HashTreeNode> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<HashTreeNode>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<HashTreeNode> CreateHashTreeNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>>> children = 0) {
+  HashTreeNodeBuilder builder_(_fbb);
+  builder_.add_children(children);
+  builder_.add_hash(hash);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<HashTreeNode> CreateHashTreeNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *hash = nullptr,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>> *children = nullptr) {
+  auto hash__ = hash ? _fbb.CreateVector<uint8_t>(*hash) : 0;
+  auto children__ = children ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode>>(*children) : 0;
+  return msg::fbuf::usrmsg::CreateHashTreeNode(
+      _fbb,
+      hash__,
+      children__);
+}
+
+struct UnlSig FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef UnlSigBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PUBKEY = 4,
+    VT_SIG = 6
+  };
+  const flatbuffers::Vector<uint8_t> *pubkey() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PUBKEY);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_pubkey() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_PUBKEY);
+  }
+  const flatbuffers::Vector<uint8_t> *sig() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_SIG);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_sig() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_SIG);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_PUBKEY) &&
+           verifier.VerifyVector(pubkey()) &&
+           VerifyOffset(verifier, VT_SIG) &&
+           verifier.VerifyVector(sig()) &&
+           verifier.EndTable();
+  }
+};
+
+struct UnlSigBuilder {
+  typedef UnlSig Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_pubkey(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> pubkey) {
+    fbb_.AddOffset(UnlSig::VT_PUBKEY, pubkey);
+  }
+  void add_sig(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> sig) {
+    fbb_.AddOffset(UnlSig::VT_SIG, sig);
+  }
+  explicit UnlSigBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  UnlSigBuilder &operator=(const UnlSigBuilder &);
+  flatbuffers::Offset<UnlSig> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<UnlSig>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<UnlSig> CreateUnlSig(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> pubkey = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> sig = 0) {
+  UnlSigBuilder builder_(_fbb);
+  builder_.add_sig(sig);
+  builder_.add_pubkey(pubkey);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<UnlSig> CreateUnlSigDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *pubkey = nullptr,
+    const std::vector<uint8_t> *sig = nullptr) {
+  auto pubkey__ = pubkey ? _fbb.CreateVector<uint8_t>(*pubkey) : 0;
+  auto sig__ = sig ? _fbb.CreateVector<uint8_t>(*sig) : 0;
+  return msg::fbuf::usrmsg::CreateUnlSig(
+      _fbb,
+      pubkey__,
+      sig__);
+}
+
+struct ContractOutput FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ContractOutputBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_LEDGER_SEQ_NO = 4,
+    VT_LEDGER_HASH = 6,
+    VT_OUTPUTS = 8,
+    VT_OUTPUT_HASH = 10,
+    VT_HASH_TREE = 12,
+    VT_UNL_SIG = 14
+  };
+  uint64_t ledger_seq_no() const {
+    return GetField<uint64_t>(VT_LEDGER_SEQ_NO, 0);
+  }
+  bool mutate_ledger_seq_no(uint64_t _ledger_seq_no) {
+    return SetField<uint64_t>(VT_LEDGER_SEQ_NO, _ledger_seq_no, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *ledger_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_ledger_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_LEDGER_HASH);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *outputs() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_OUTPUTS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *mutable_outputs() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_OUTPUTS);
+  }
+  const flatbuffers::Vector<uint8_t> *output_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_OUTPUT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_output_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_OUTPUT_HASH);
+  }
+  const msg::fbuf::usrmsg::HashTreeNode *hash_tree() const {
+    return GetPointer<const msg::fbuf::usrmsg::HashTreeNode *>(VT_HASH_TREE);
+  }
+  msg::fbuf::usrmsg::HashTreeNode *mutable_hash_tree() {
+    return GetPointer<msg::fbuf::usrmsg::HashTreeNode *>(VT_HASH_TREE);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>> *unl_sig() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>> *>(VT_UNL_SIG);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>> *mutable_unl_sig() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>> *>(VT_UNL_SIG);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_LEDGER_SEQ_NO) &&
+           VerifyOffset(verifier, VT_LEDGER_HASH) &&
+           verifier.VerifyVector(ledger_hash()) &&
+           VerifyOffset(verifier, VT_OUTPUTS) &&
+           verifier.VerifyVector(outputs()) &&
+           verifier.VerifyVectorOfTables(outputs()) &&
+           VerifyOffset(verifier, VT_OUTPUT_HASH) &&
+           verifier.VerifyVector(output_hash()) &&
+           VerifyOffset(verifier, VT_HASH_TREE) &&
+           verifier.VerifyTable(hash_tree()) &&
+           VerifyOffset(verifier, VT_UNL_SIG) &&
+           verifier.VerifyVector(unl_sig()) &&
+           verifier.VerifyVectorOfTables(unl_sig()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ContractOutputBuilder {
+  typedef ContractOutput Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_ledger_seq_no(uint64_t ledger_seq_no) {
+    fbb_.AddElement<uint64_t>(ContractOutput::VT_LEDGER_SEQ_NO, ledger_seq_no, 0);
+  }
+  void add_ledger_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash) {
+    fbb_.AddOffset(ContractOutput::VT_LEDGER_HASH, ledger_hash);
+  }
+  void add_outputs(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> outputs) {
+    fbb_.AddOffset(ContractOutput::VT_OUTPUTS, outputs);
+  }
+  void add_output_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> output_hash) {
+    fbb_.AddOffset(ContractOutput::VT_OUTPUT_HASH, output_hash);
+  }
+  void add_hash_tree(flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode> hash_tree) {
+    fbb_.AddOffset(ContractOutput::VT_HASH_TREE, hash_tree);
+  }
+  void add_unl_sig(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>>> unl_sig) {
+    fbb_.AddOffset(ContractOutput::VT_UNL_SIG, unl_sig);
+  }
+  explicit ContractOutputBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ContractOutputBuilder &operator=(const ContractOutputBuilder &);
+  flatbuffers::Offset<ContractOutput> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ContractOutput>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ContractOutput> CreateContractOutput(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t ledger_seq_no = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> ledger_hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> outputs = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> output_hash = 0,
+    flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode> hash_tree = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>>> unl_sig = 0) {
+  ContractOutputBuilder builder_(_fbb);
+  builder_.add_ledger_seq_no(ledger_seq_no);
+  builder_.add_unl_sig(unl_sig);
+  builder_.add_hash_tree(hash_tree);
+  builder_.add_output_hash(output_hash);
+  builder_.add_outputs(outputs);
+  builder_.add_ledger_hash(ledger_hash);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ContractOutput> CreateContractOutputDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t ledger_seq_no = 0,
+    const std::vector<uint8_t> *ledger_hash = nullptr,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *outputs = nullptr,
+    const std::vector<uint8_t> *output_hash = nullptr,
+    flatbuffers::Offset<msg::fbuf::usrmsg::HashTreeNode> hash_tree = 0,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>> *unl_sig = nullptr) {
+  auto ledger_hash__ = ledger_hash ? _fbb.CreateVector<uint8_t>(*ledger_hash) : 0;
+  auto outputs__ = outputs ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>(*outputs) : 0;
+  auto output_hash__ = output_hash ? _fbb.CreateVector<uint8_t>(*output_hash) : 0;
+  auto unl_sig__ = unl_sig ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::UnlSig>>(*unl_sig) : 0;
+  return msg::fbuf::usrmsg::CreateContractOutput(
+      _fbb,
+      ledger_seq_no,
+      ledger_hash__,
+      outputs__,
+      output_hash__,
+      hash_tree,
+      unl_sig__);
+}
+
+struct UnlChange FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef UnlChangeBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_UNL = 4
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *unl() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_UNL);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *mutable_unl() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_UNL);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_UNL) &&
+           verifier.VerifyVector(unl()) &&
+           verifier.VerifyVectorOfTables(unl()) &&
+           verifier.EndTable();
+  }
+};
+
+struct UnlChangeBuilder {
+  typedef UnlChange Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_unl(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> unl) {
+    fbb_.AddOffset(UnlChange::VT_UNL, unl);
+  }
+  explicit UnlChangeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  UnlChangeBuilder &operator=(const UnlChangeBuilder &);
+  flatbuffers::Offset<UnlChange> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<UnlChange>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<UnlChange> CreateUnlChange(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> unl = 0) {
+  UnlChangeBuilder builder_(_fbb);
+  builder_.add_unl(unl);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<UnlChange> CreateUnlChangeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *unl = nullptr) {
+  auto unl__ = unl ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>(*unl) : 0;
+  return msg::fbuf::usrmsg::CreateUnlChange(
+      _fbb,
+      unl__);
+}
+
+struct LedgerInput FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LedgerInputBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PUBKEY = 4,
+    VT_HASH = 6,
+    VT_NONCE = 8,
+    VT_BLOB = 10
+  };
+  const flatbuffers::Vector<uint8_t> *pubkey() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PUBKEY);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_pubkey() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_PUBKEY);
+  }
+  const flatbuffers::Vector<uint8_t> *hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  uint64_t nonce() const {
+    return GetField<uint64_t>(VT_NONCE, 0);
+  }
+  bool mutate_nonce(uint64_t _nonce) {
+    return SetField<uint64_t>(VT_NONCE, _nonce, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *blob() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_BLOB);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_blob() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_BLOB);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_PUBKEY) &&
+           verifier.VerifyVector(pubkey()) &&
+           VerifyOffset(verifier, VT_HASH) &&
+           verifier.VerifyVector(hash()) &&
+           VerifyField<uint64_t>(verifier, VT_NONCE) &&
+           VerifyOffset(verifier, VT_BLOB) &&
+           verifier.VerifyVector(blob()) &&
+           verifier.EndTable();
+  }
+};
+
+struct LedgerInputBuilder {
+  typedef LedgerInput Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_pubkey(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> pubkey) {
+    fbb_.AddOffset(LedgerInput::VT_PUBKEY, pubkey);
+  }
+  void add_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash) {
+    fbb_.AddOffset(LedgerInput::VT_HASH, hash);
+  }
+  void add_nonce(uint64_t nonce) {
+    fbb_.AddElement<uint64_t>(LedgerInput::VT_NONCE, nonce, 0);
+  }
+  void add_blob(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> blob) {
+    fbb_.AddOffset(LedgerInput::VT_BLOB, blob);
+  }
+  explicit LedgerInputBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LedgerInputBuilder &operator=(const LedgerInputBuilder &);
+  flatbuffers::Offset<LedgerInput> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LedgerInput>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LedgerInput> CreateLedgerInput(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> pubkey = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash = 0,
+    uint64_t nonce = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> blob = 0) {
+  LedgerInputBuilder builder_(_fbb);
+  builder_.add_nonce(nonce);
+  builder_.add_blob(blob);
+  builder_.add_hash(hash);
+  builder_.add_pubkey(pubkey);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<LedgerInput> CreateLedgerInputDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *pubkey = nullptr,
+    const std::vector<uint8_t> *hash = nullptr,
+    uint64_t nonce = 0,
+    const std::vector<uint8_t> *blob = nullptr) {
+  auto pubkey__ = pubkey ? _fbb.CreateVector<uint8_t>(*pubkey) : 0;
+  auto hash__ = hash ? _fbb.CreateVector<uint8_t>(*hash) : 0;
+  auto blob__ = blob ? _fbb.CreateVector<uint8_t>(*blob) : 0;
+  return msg::fbuf::usrmsg::CreateLedgerInput(
+      _fbb,
+      pubkey__,
+      hash__,
+      nonce,
+      blob__);
+}
+
+struct LedgerOutput FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LedgerOutputBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PUBKEY = 4,
+    VT_HASH = 6,
+    VT_BLOBS = 8
+  };
+  const flatbuffers::Vector<uint8_t> *pubkey() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PUBKEY);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_pubkey() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_PUBKEY);
+  }
+  const flatbuffers::Vector<uint8_t> *hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *blobs() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_BLOBS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *mutable_blobs() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *>(VT_BLOBS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_PUBKEY) &&
+           verifier.VerifyVector(pubkey()) &&
+           VerifyOffset(verifier, VT_HASH) &&
+           verifier.VerifyVector(hash()) &&
+           VerifyOffset(verifier, VT_BLOBS) &&
+           verifier.VerifyVector(blobs()) &&
+           verifier.VerifyVectorOfTables(blobs()) &&
+           verifier.EndTable();
+  }
+};
+
+struct LedgerOutputBuilder {
+  typedef LedgerOutput Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_pubkey(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> pubkey) {
+    fbb_.AddOffset(LedgerOutput::VT_PUBKEY, pubkey);
+  }
+  void add_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash) {
+    fbb_.AddOffset(LedgerOutput::VT_HASH, hash);
+  }
+  void add_blobs(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> blobs) {
+    fbb_.AddOffset(LedgerOutput::VT_BLOBS, blobs);
+  }
+  explicit LedgerOutputBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LedgerOutputBuilder &operator=(const LedgerOutputBuilder &);
+  flatbuffers::Offset<LedgerOutput> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LedgerOutput>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LedgerOutput> CreateLedgerOutput(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> pubkey = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>> blobs = 0) {
+  LedgerOutputBuilder builder_(_fbb);
+  builder_.add_blobs(blobs);
+  builder_.add_hash(hash);
+  builder_.add_pubkey(pubkey);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<LedgerOutput> CreateLedgerOutputDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *pubkey = nullptr,
+    const std::vector<uint8_t> *hash = nullptr,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>> *blobs = nullptr) {
+  auto pubkey__ = pubkey ? _fbb.CreateVector<uint8_t>(*pubkey) : 0;
+  auto hash__ = hash ? _fbb.CreateVector<uint8_t>(*hash) : 0;
+  auto blobs__ = blobs ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::ByteArray>>(*blobs) : 0;
+  return msg::fbuf::usrmsg::CreateLedgerOutput(
+      _fbb,
+      pubkey__,
+      hash__,
+      blobs__);
+}
+
+struct Ledger FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LedgerBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SEQ_NO = 4,
+    VT_TIMESTAMP = 6,
+    VT_HASH = 8,
+    VT_PREV_HASH = 10,
+    VT_STATE_HASH = 12,
+    VT_CONFIG_HASH = 14,
+    VT_USER_HASH = 16,
+    VT_INPUT_HASH = 18,
+    VT_OUTPUT_HASH = 20,
+    VT_INPUTS = 22,
+    VT_OUTPUTS = 24
+  };
+  uint64_t seq_no() const {
+    return GetField<uint64_t>(VT_SEQ_NO, 0);
+  }
+  bool mutate_seq_no(uint64_t _seq_no) {
+    return SetField<uint64_t>(VT_SEQ_NO, _seq_no, 0);
+  }
+  uint64_t timestamp() const {
+    return GetField<uint64_t>(VT_TIMESTAMP, 0);
+  }
+  bool mutate_timestamp(uint64_t _timestamp) {
+    return SetField<uint64_t>(VT_TIMESTAMP, _timestamp, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_HASH);
+  }
+  const flatbuffers::Vector<uint8_t> *prev_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_PREV_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_prev_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_PREV_HASH);
+  }
+  const flatbuffers::Vector<uint8_t> *state_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_STATE_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_state_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_STATE_HASH);
+  }
+  const flatbuffers::Vector<uint8_t> *config_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_CONFIG_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_config_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_CONFIG_HASH);
+  }
+  const flatbuffers::Vector<uint8_t> *user_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_USER_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_user_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_USER_HASH);
+  }
+  const flatbuffers::Vector<uint8_t> *input_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INPUT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_input_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INPUT_HASH);
+  }
+  const flatbuffers::Vector<uint8_t> *output_hash() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_OUTPUT_HASH);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_output_hash() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_OUTPUT_HASH);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>> *inputs() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>> *>(VT_INPUTS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>> *mutable_inputs() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>> *>(VT_INPUTS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>> *outputs() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>> *>(VT_OUTPUTS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>> *mutable_outputs() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>> *>(VT_OUTPUTS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_SEQ_NO) &&
+           VerifyField<uint64_t>(verifier, VT_TIMESTAMP) &&
+           VerifyOffset(verifier, VT_HASH) &&
+           verifier.VerifyVector(hash()) &&
+           VerifyOffset(verifier, VT_PREV_HASH) &&
+           verifier.VerifyVector(prev_hash()) &&
+           VerifyOffset(verifier, VT_STATE_HASH) &&
+           verifier.VerifyVector(state_hash()) &&
+           VerifyOffset(verifier, VT_CONFIG_HASH) &&
+           verifier.VerifyVector(config_hash()) &&
+           VerifyOffset(verifier, VT_USER_HASH) &&
+           verifier.VerifyVector(user_hash()) &&
+           VerifyOffset(verifier, VT_INPUT_HASH) &&
+           verifier.VerifyVector(input_hash()) &&
+           VerifyOffset(verifier, VT_OUTPUT_HASH) &&
+           verifier.VerifyVector(output_hash()) &&
+           VerifyOffset(verifier, VT_INPUTS) &&
+           verifier.VerifyVector(inputs()) &&
+           verifier.VerifyVectorOfTables(inputs()) &&
+           VerifyOffset(verifier, VT_OUTPUTS) &&
+           verifier.VerifyVector(outputs()) &&
+           verifier.VerifyVectorOfTables(outputs()) &&
+           verifier.EndTable();
+  }
+};
+
+struct LedgerBuilder {
+  typedef Ledger Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_seq_no(uint64_t seq_no) {
+    fbb_.AddElement<uint64_t>(Ledger::VT_SEQ_NO, seq_no, 0);
+  }
+  void add_timestamp(uint64_t timestamp) {
+    fbb_.AddElement<uint64_t>(Ledger::VT_TIMESTAMP, timestamp, 0);
+  }
+  void add_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash) {
+    fbb_.AddOffset(Ledger::VT_HASH, hash);
+  }
+  void add_prev_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> prev_hash) {
+    fbb_.AddOffset(Ledger::VT_PREV_HASH, prev_hash);
+  }
+  void add_state_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> state_hash) {
+    fbb_.AddOffset(Ledger::VT_STATE_HASH, state_hash);
+  }
+  void add_config_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> config_hash) {
+    fbb_.AddOffset(Ledger::VT_CONFIG_HASH, config_hash);
+  }
+  void add_user_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> user_hash) {
+    fbb_.AddOffset(Ledger::VT_USER_HASH, user_hash);
+  }
+  void add_input_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_hash) {
+    fbb_.AddOffset(Ledger::VT_INPUT_HASH, input_hash);
+  }
+  void add_output_hash(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> output_hash) {
+    fbb_.AddOffset(Ledger::VT_OUTPUT_HASH, output_hash);
+  }
+  void add_inputs(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>>> inputs) {
+    fbb_.AddOffset(Ledger::VT_INPUTS, inputs);
+  }
+  void add_outputs(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>>> outputs) {
+    fbb_.AddOffset(Ledger::VT_OUTPUTS, outputs);
+  }
+  explicit LedgerBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LedgerBuilder &operator=(const LedgerBuilder &);
+  flatbuffers::Offset<Ledger> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Ledger>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Ledger> CreateLedger(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t seq_no = 0,
+    uint64_t timestamp = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> prev_hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> state_hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> config_hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> user_hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> input_hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> output_hash = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>>> inputs = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>>> outputs = 0) {
+  LedgerBuilder builder_(_fbb);
+  builder_.add_timestamp(timestamp);
+  builder_.add_seq_no(seq_no);
+  builder_.add_outputs(outputs);
+  builder_.add_inputs(inputs);
+  builder_.add_output_hash(output_hash);
+  builder_.add_input_hash(input_hash);
+  builder_.add_user_hash(user_hash);
+  builder_.add_config_hash(config_hash);
+  builder_.add_state_hash(state_hash);
+  builder_.add_prev_hash(prev_hash);
+  builder_.add_hash(hash);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Ledger> CreateLedgerDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t seq_no = 0,
+    uint64_t timestamp = 0,
+    const std::vector<uint8_t> *hash = nullptr,
+    const std::vector<uint8_t> *prev_hash = nullptr,
+    const std::vector<uint8_t> *state_hash = nullptr,
+    const std::vector<uint8_t> *config_hash = nullptr,
+    const std::vector<uint8_t> *user_hash = nullptr,
+    const std::vector<uint8_t> *input_hash = nullptr,
+    const std::vector<uint8_t> *output_hash = nullptr,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>> *inputs = nullptr,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>> *outputs = nullptr) {
+  auto hash__ = hash ? _fbb.CreateVector<uint8_t>(*hash) : 0;
+  auto prev_hash__ = prev_hash ? _fbb.CreateVector<uint8_t>(*prev_hash) : 0;
+  auto state_hash__ = state_hash ? _fbb.CreateVector<uint8_t>(*state_hash) : 0;
+  auto config_hash__ = config_hash ? _fbb.CreateVector<uint8_t>(*config_hash) : 0;
+  auto user_hash__ = user_hash ? _fbb.CreateVector<uint8_t>(*user_hash) : 0;
+  auto input_hash__ = input_hash ? _fbb.CreateVector<uint8_t>(*input_hash) : 0;
+  auto output_hash__ = output_hash ? _fbb.CreateVector<uint8_t>(*output_hash) : 0;
+  auto inputs__ = inputs ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerInput>>(*inputs) : 0;
+  auto outputs__ = outputs ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::LedgerOutput>>(*outputs) : 0;
+  return msg::fbuf::usrmsg::CreateLedger(
+      _fbb,
+      seq_no,
+      timestamp,
+      hash__,
+      prev_hash__,
+      state_hash__,
+      config_hash__,
+      user_hash__,
+      input_hash__,
+      output_hash__,
+      inputs__,
+      outputs__);
+}
+
+struct LedgerCreatedEvent FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LedgerCreatedEventBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_LEDGER = 4
+  };
+  const msg::fbuf::usrmsg::Ledger *ledger() const {
+    return GetPointer<const msg::fbuf::usrmsg::Ledger *>(VT_LEDGER);
+  }
+  msg::fbuf::usrmsg::Ledger *mutable_ledger() {
+    return GetPointer<msg::fbuf::usrmsg::Ledger *>(VT_LEDGER);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_LEDGER) &&
+           verifier.VerifyTable(ledger()) &&
+           verifier.EndTable();
+  }
+};
+
+struct LedgerCreatedEventBuilder {
+  typedef LedgerCreatedEvent Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_ledger(flatbuffers::Offset<msg::fbuf::usrmsg::Ledger> ledger) {
+    fbb_.AddOffset(LedgerCreatedEvent::VT_LEDGER, ledger);
+  }
+  explicit LedgerCreatedEventBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LedgerCreatedEventBuilder &operator=(const LedgerCreatedEventBuilder &);
+  flatbuffers::Offset<LedgerCreatedEvent> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LedgerCreatedEvent>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LedgerCreatedEvent> CreateLedgerCreatedEvent(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<msg::fbuf::usrmsg::Ledger> ledger = 0) {
+  LedgerCreatedEventBuilder builder_(_fbb);
+  builder_.add_ledger(ledger);
+  return builder_.Finish();
+}
+
+struct VoteStatusEvent FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef VoteStatusEventBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VOTE_STATUS = 4
+  };
+  const flatbuffers::String *vote_status() const {
+    return GetPointer<const flatbuffers::String *>(VT_VOTE_STATUS);
+  }
+  flatbuffers::String *mutable_vote_status() {
+    return GetPointer<flatbuffers::String *>(VT_VOTE_STATUS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_VOTE_STATUS) &&
+           verifier.VerifyString(vote_status()) &&
+           verifier.EndTable();
+  }
+};
+
+struct VoteStatusEventBuilder {
+  typedef VoteStatusEvent Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_vote_status(flatbuffers::Offset<flatbuffers::String> vote_status) {
+    fbb_.AddOffset(VoteStatusEvent::VT_VOTE_STATUS, vote_status);
+  }
+  explicit VoteStatusEventBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  VoteStatusEventBuilder &operator=(const VoteStatusEventBuilder &);
+  flatbuffers::Offset<VoteStatusEvent> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<VoteStatusEvent>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<VoteStatusEvent> CreateVoteStatusEvent(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> vote_status = 0) {
+  VoteStatusEventBuilder builder_(_fbb);
+  builder_.add_vote_status(vote_status);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<VoteStatusEvent> CreateVoteStatusEventDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *vote_status = nullptr) {
+  auto vote_status__ = vote_status ? _fbb.CreateString(vote_status) : 0;
+  return msg::fbuf::usrmsg::CreateVoteStatusEvent(
+      _fbb,
+      vote_status__);
+}
+
+struct LatencyStat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LatencyStatBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_MIN = 4,
+    VT_MAX = 6,
+    VT_AVG = 8
+  };
+  uint64_t min() const {
+    return GetField<uint64_t>(VT_MIN, 0);
+  }
+  bool mutate_min(uint64_t _min) {
+    return SetField<uint64_t>(VT_MIN, _min, 0);
+  }
+  uint64_t max() const {
+    return GetField<uint64_t>(VT_MAX, 0);
+  }
+  bool mutate_max(uint64_t _max) {
+    return SetField<uint64_t>(VT_MAX, _max, 0);
+  }
+  uint64_t avg() const {
+    return GetField<uint64_t>(VT_AVG, 0);
+  }
+  bool mutate_avg(uint64_t _avg) {
+    return SetField<uint64_t>(VT_AVG, _avg, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_MIN) &&
+           VerifyField<uint64_t>(verifier, VT_MAX) &&
+           VerifyField<uint64_t>(verifier, VT_AVG) &&
+           verifier.EndTable();
+  }
+};
+
+struct LatencyStatBuilder {
+  typedef LatencyStat Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_min(uint64_t min) {
+    fbb_.AddElement<uint64_t>(LatencyStat::VT_MIN, min, 0);
+  }
+  void add_max(uint64_t max) {
+    fbb_.AddElement<uint64_t>(LatencyStat::VT_MAX, max, 0);
+  }
+  void add_avg(uint64_t avg) {
+    fbb_.AddElement<uint64_t>(LatencyStat::VT_AVG, avg, 0);
+  }
+  explicit LatencyStatBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LatencyStatBuilder &operator=(const LatencyStatBuilder &);
+  flatbuffers::Offset<LatencyStat> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LatencyStat>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LatencyStat> CreateLatencyStat(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t min = 0,
+    uint64_t max = 0,
+    uint64_t avg = 0) {
+  LatencyStatBuilder builder_(_fbb);
+  builder_.add_avg(avg);
+  builder_.add_max(max);
+  builder_.add_min(min);
+  return builder_.Finish();
+}
+
+struct ProposalHealthEvent FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ProposalHealthEventBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_COMM_LATENCY = 4,
+    VT_READ_LATENCY = 6,
+    VT_BATCH_SIZE = 8
+  };
+  const msg::fbuf::usrmsg::LatencyStat *comm_latency() const {
+    return GetPointer<const msg::fbuf::usrmsg::LatencyStat *>(VT_COMM_LATENCY);
+  }
+  msg::fbuf::usrmsg::LatencyStat *mutable_comm_latency() {
+    return GetPointer<msg::fbuf::usrmsg::LatencyStat *>(VT_COMM_LATENCY);
+  }
+  const msg::fbuf::usrmsg::LatencyStat *read_latency() const {
+    return GetPointer<const msg::fbuf::usrmsg::LatencyStat *>(VT_READ_LATENCY);
+  }
+  msg::fbuf::usrmsg::LatencyStat *mutable_read_latency() {
+    return GetPointer<msg::fbuf::usrmsg::LatencyStat *>(VT_READ_LATENCY);
+  }
+  uint64_t batch_size() const {
+    return GetField<uint64_t>(VT_BATCH_SIZE, 0);
+  }
+  bool mutate_batch_size(uint64_t _batch_size) {
+    return SetField<uint64_t>(VT_BATCH_SIZE, _batch_size, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_COMM_LATENCY) &&
+           verifier.VerifyTable(comm_latency()) &&
+           VerifyOffset(verifier, VT_READ_LATENCY) &&
+           verifier.VerifyTable(read_latency()) &&
+           VerifyField<uint64_t>(verifier, VT_BATCH_SIZE) &&
+           verifier.EndTable();
+  }
+};
+
+struct ProposalHealthEventBuilder {
+  typedef ProposalHealthEvent Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_comm_latency(flatbuffers::Offset<msg::fbuf::usrmsg::LatencyStat> comm_latency) {
+    fbb_.AddOffset(ProposalHealthEvent::VT_COMM_LATENCY, comm_latency);
+  }
+  void add_read_latency(flatbuffers::Offset<msg::fbuf::usrmsg::LatencyStat> read_latency) {
+    fbb_.AddOffset(ProposalHealthEvent::VT_READ_LATENCY, read_latency);
+  }
+  void add_batch_size(uint64_t batch_size) {
+    fbb_.AddElement<uint64_t>(ProposalHealthEvent::VT_BATCH_SIZE, batch_size, 0);
+  }
+  explicit ProposalHealthEventBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ProposalHealthEventBuilder &operator=(const ProposalHealthEventBuilder &);
+  flatbuffers::Offset<ProposalHealthEvent> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ProposalHealthEvent>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ProposalHealthEvent> CreateProposalHealthEvent(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<msg::fbuf::usrmsg::LatencyStat> comm_latency = 0,
+    flatbuffers::Offset<msg::fbuf::usrmsg::LatencyStat> read_latency = 0,
+    uint64_t batch_size = 0) {
+  ProposalHealthEventBuilder builder_(_fbb);
+  builder_.add_batch_size(batch_size);
+  builder_.add_read_latency(read_latency);
+  builder_.add_comm_latency(comm_latency);
+  return builder_.Finish();
+}
+
+struct ConnectivityHealthEvent FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ConnectivityHealthEventBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_PEER_COUNT = 4,
+    VT_WEAKLY_CONNECTED = 6
+  };
+  uint64_t peer_count() const {
+    return GetField<uint64_t>(VT_PEER_COUNT, 0);
+  }
+  bool mutate_peer_count(uint64_t _peer_count) {
+    return SetField<uint64_t>(VT_PEER_COUNT, _peer_count, 0);
+  }
+  bool weakly_connected() const {
+    return GetField<uint8_t>(VT_WEAKLY_CONNECTED, 0) != 0;
+  }
+  bool mutate_weakly_connected(bool _weakly_connected) {
+    return SetField<uint8_t>(VT_WEAKLY_CONNECTED, static_cast<uint8_t>(_weakly_connected), 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint64_t>(verifier, VT_PEER_COUNT) &&
+           VerifyField<uint8_t>(verifier, VT_WEAKLY_CONNECTED) &&
+           verifier.EndTable();
+  }
+};
+
+struct ConnectivityHealthEventBuilder {
+  typedef ConnectivityHealthEvent Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_peer_count(uint64_t peer_count) {
+    fbb_.AddElement<uint64_t>(ConnectivityHealthEvent::VT_PEER_COUNT, peer_count, 0);
+  }
+  void add_weakly_connected(bool weakly_connected) {
+    fbb_.AddElement<uint8_t>(ConnectivityHealthEvent::VT_WEAKLY_CONNECTED, static_cast<uint8_t>(weakly_connected), 0);
+  }
+  explicit ConnectivityHealthEventBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ConnectivityHealthEventBuilder &operator=(const ConnectivityHealthEventBuilder &);
+  flatbuffers::Offset<ConnectivityHealthEvent> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ConnectivityHealthEvent>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ConnectivityHealthEvent> CreateConnectivityHealthEvent(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    uint64_t peer_count = 0,
+    bool weakly_connected = false) {
+  ConnectivityHealthEventBuilder builder_(_fbb);
+  builder_.add_peer_count(peer_count);
+  builder_.add_weakly_connected(weakly_connected);
+  return builder_.Finish();
+}
+
+struct LedgerQueryResult FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LedgerQueryResultBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_REPLY_FOR = 4,
+    VT_ERROR = 6,
+    VT_RESULTS = 8
+  };
+  const flatbuffers::String *reply_for() const {
+    return GetPointer<const flatbuffers::String *>(VT_REPLY_FOR);
+  }
+  flatbuffers::String *mutable_reply_for() {
+    return GetPointer<flatbuffers::String *>(VT_REPLY_FOR);
+  }
+  const flatbuffers::String *error() const {
+    return GetPointer<const flatbuffers::String *>(VT_ERROR);
+  }
+  flatbuffers::String *mutable_error() {
+    return GetPointer<flatbuffers::String *>(VT_ERROR);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>> *results() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>> *>(VT_RESULTS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>> *mutable_results() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>> *>(VT_RESULTS);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_REPLY_FOR) &&
+           verifier.VerifyString(reply_for()) &&
+           VerifyOffset(verifier, VT_ERROR) &&
+           verifier.VerifyString(error()) &&
+           VerifyOffset(verifier, VT_RESULTS) &&
+           verifier.VerifyVector(results()) &&
+           verifier.VerifyVectorOfTables(results()) &&
+           verifier.EndTable();
+  }
+};
+
+struct LedgerQueryResultBuilder {
+  typedef LedgerQueryResult Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_reply_for(flatbuffers::Offset<flatbuffers::String> reply_for) {
+    fbb_.AddOffset(LedgerQueryResult::VT_REPLY_FOR, reply_for);
+  }
+  void add_error(flatbuffers::Offset<flatbuffers::String> error) {
+    fbb_.AddOffset(LedgerQueryResult::VT_ERROR, error);
+  }
+  void add_results(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>>> results) {
+    fbb_.AddOffset(LedgerQueryResult::VT_RESULTS, results);
+  }
+  explicit LedgerQueryResultBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LedgerQueryResultBuilder &operator=(const LedgerQueryResultBuilder &);
+  flatbuffers::Offset<LedgerQueryResult> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<LedgerQueryResult>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<LedgerQueryResult> CreateLedgerQueryResult(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> reply_for = 0,
+    flatbuffers::Offset<flatbuffers::String> error = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>>> results = 0) {
+  LedgerQueryResultBuilder builder_(_fbb);
+  builder_.add_results(results);
+  builder_.add_error(error);
+  builder_.add_reply_for(reply_for);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<LedgerQueryResult> CreateLedgerQueryResultDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *reply_for = nullptr,
+    const char *error = nullptr,
+    const std::vector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>> *results = nullptr) {
+  auto reply_for__ = reply_for ? _fbb.CreateString(reply_for) : 0;
+  auto error__ = error ? _fbb.CreateString(error) : 0;
+  auto results__ = results ? _fbb.CreateVector<flatbuffers::Offset<msg::fbuf::usrmsg::Ledger>>(*results) : 0;
+  return msg::fbuf::usrmsg::CreateLedgerQueryResult(
+      _fbb,
+      reply_for__,
+      error__,
+      results__);
+}
+
+struct ByteArray FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ByteArrayBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ARRAY = 4
+  };
+  const flatbuffers::Vector<uint8_t> *array() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_ARRAY);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_array() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_ARRAY);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_ARRAY) &&
+           verifier.VerifyVector(array()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ByteArrayBuilder {
+  typedef ByteArray Table;
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_array(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> array) {
+    fbb_.AddOffset(ByteArray::VT_ARRAY, array);
+  }
+  explicit ByteArrayBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ByteArrayBuilder &operator=(const ByteArrayBuilder &);
+  flatbuffers::Offset<ByteArray> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<ByteArray>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<ByteArray> CreateByteArray(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> array = 0) {
+  ByteArrayBuilder builder_(_fbb);
+  builder_.add_array(array);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<ByteArray> CreateByteArrayDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<uint8_t> *array = nullptr) {
+  auto array__ = array ? _fbb.CreateVector<uint8_t>(*array) : 0;
+  return msg::fbuf::usrmsg::CreateByteArray(
+      _fbb,
+      array__);
+}
+
+inline bool VerifyUserMsgContent(flatbuffers::Verifier &verifier, const void *obj, UserMsgContent type) {
+  switch (type) {
+    case UserMsgContent_NONE: {
+      return true;
+    }
+    case UserMsgContent_StatRequest: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::StatRequest *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_LclRequest: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::LclRequest *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractReadRequest: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractReadRequest *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractInput: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractInput *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_SubscriptionRequest: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::SubscriptionRequest *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_LedgerQuery: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::LedgerQuery *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_StatResponse: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::StatResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_LclResponse: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::LclResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractReadResponse: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractReadResponse *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractInputStatus: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractInputStatus *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractOutput: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractOutput *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_UnlChange: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::UnlChange *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_LedgerCreatedEvent: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::LedgerCreatedEvent *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_VoteStatusEvent: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::VoteStatusEvent *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ProposalHealthEvent: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ProposalHealthEvent *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ConnectivityHealthEvent: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ConnectivityHealthEvent *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_LedgerQueryResult: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::LedgerQueryResult *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractInputBegin: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractInputBegin *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractInputChunk: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractInputChunk *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractInputEnd: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractInputEnd *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    case UserMsgContent_ContractReadCancel: {
+      auto ptr = reinterpret_cast<const msg::fbuf::usrmsg::ContractReadCancel *>(obj);
+      return verifier.VerifyTable(ptr);
+    }
+    default: return true;
+  }
+}
+
+inline bool VerifyUserMsgContentVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types) {
+  if (!values || !types) return !values && !types;
+  if (values->size() != types->size()) return false;
+  for (flatbuffers::uoffset_t i = 0; i < values->size(); ++i) {
+    if (!VerifyUserMsgContent(
+        verifier,  values->Get(i), types->GetEnum<UserMsgContent>(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+inline const msg::fbuf::usrmsg::UserMsg *GetUserMsg(const void *buf) {
+  return flatbuffers::GetRoot<msg::fbuf::usrmsg::UserMsg>(buf);
+}
+
+inline const msg::fbuf::usrmsg::UserMsg *GetSizePrefixedUserMsg(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<msg::fbuf::usrmsg::UserMsg>(buf);
+}
+
+inline UserMsg *GetMutableUserMsg(void *buf) {
+  return flatbuffers::GetMutableRoot<UserMsg>(buf);
+}
+
+inline bool VerifyUserMsgBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<msg::fbuf::usrmsg::UserMsg>(nullptr);
+}
+
+inline bool VerifySizePrefixedUserMsgBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<msg::fbuf::usrmsg::UserMsg>(nullptr);
+}
+
+inline void FinishUserMsgBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<msg::fbuf::usrmsg::UserMsg> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedUserMsgBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<msg::fbuf::usrmsg::UserMsg> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+}  // namespace usrmsg
+}  // namespace fbuf
+}  // namespace msg
+
+#endif  // FLATBUFFERS_GENERATED_USRMSG_MSG_FBUF_USRMSG_H_
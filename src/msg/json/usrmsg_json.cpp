@@ -152,7 +152,8 @@ namespace msg::usrmsg::json
     void create_status_response(std::vector<uint8_t> &msg)
     {
         const util::sequence_hash lcl_id = status::get_lcl_id();
-        const std::set<std::string> unl = status::get_unl();
+        const std::shared_ptr<const std::set<std::string>> unl_snapshot = status::get_unl();
+        const std::set<std::string> &unl = *unl_snapshot;
         const status::VOTE_STATUS vote_status = status::get_vote_status();
         const bool weakly_connected = status::get_weakly_connected();
 
@@ -218,7 +219,8 @@ namespace msg::usrmsg::json
         msg += OPEN_SQR_BRACKET;
 
         {
-            const std::set<conf::peer_ip_port> peers = status::get_peers();
+            const std::shared_ptr<const std::set<conf::peer_ip_port>> peers_snapshot = status::get_peers();
+            const std::set<conf::peer_ip_port> &peers = *peers_snapshot;
             const size_t max_peers_count = MIN(MAX_KNOWN_PEERS_INFO, peers.size());
             size_t count = 1;
 
@@ -372,9 +374,8 @@ namespace msg::usrmsg::json
     }
 
     /**
-     * Constructs a contract output container message.
-     * @param msg Buffer to construct the generated json message string into.
-     *            Message format:
+     * Constructs the round-common parts of contract output container messages.
+     * The complete message format is:
      *            {
      *              "type": "contract_output",
      *              "ledger_seq_no": <integer>,
@@ -384,33 +385,65 @@ namespace msg::usrmsg::json
      *              "hash_tree": [<hex merkle hash tree>], // Collapsed merkle tree with user's hash element marked as null. 
      *              "unl_sig": [["<pubkey hex>", "<sig hex>"], ...] // UNL pubkeys and signatures of root hash.
      *            }
-     * @param hash This user's combined output hash. [output hash = hash(pubkey+all outputs for the user)]
-     * @param outputs List of outputs for the user.
-     * @param hash_root Root node of the collapsed merkle hash tree.
+     * @param fragments The fragments to populate.
      * @param unl_sig List of unl signatures issued on the root hash. (root hash = combined merkle hash of hashes of all users)
      * @param lcl_seq_no Current ledger seq no.
      * @param lcl_hash Current ledger hash.
      */
-    void create_contract_output_container(std::vector<uint8_t> &msg, std::string_view hash, const ::std::vector<std::string> &outputs,
-                                          const util::merkle_hash_node &hash_root, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+    void create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
                                           const uint64_t lcl_seq_no, std::string_view lcl_hash)
     {
-        msg.reserve(1024);
-        msg += "{\"";
-        msg += msg::usrmsg::FLD_TYPE;
-        msg += SEP_COLON;
-        msg += msg::usrmsg::MSGTYPE_CONTRACT_OUTPUT;
-        msg += SEP_COMMA;
-        msg += msg::usrmsg::FLD_LEDGER_SEQ_NO;
-        msg += SEP_COLON_NOQUOTE;
-        msg += std::to_string(lcl_seq_no);
-        msg += SEP_COMMA_NOQUOTE;
-        msg += msg::usrmsg::FLD_LEDGER_HASH;
-        msg += SEP_COLON;
-        msg += util::to_hex(lcl_hash);
-        msg += SEP_COMMA;
-        msg += msg::usrmsg::FLD_OUTPUTS;
-        msg += "\":[";
+        std::vector<uint8_t> &head = fragments.head;
+        head.reserve(256);
+        head += "{\"";
+        head += msg::usrmsg::FLD_TYPE;
+        head += SEP_COLON;
+        head += msg::usrmsg::MSGTYPE_CONTRACT_OUTPUT;
+        head += SEP_COMMA;
+        head += msg::usrmsg::FLD_LEDGER_SEQ_NO;
+        head += SEP_COLON_NOQUOTE;
+        head += std::to_string(lcl_seq_no);
+        head += SEP_COMMA_NOQUOTE;
+        head += msg::usrmsg::FLD_LEDGER_HASH;
+        head += SEP_COLON;
+        head += util::to_hex(lcl_hash);
+        head += SEP_COMMA;
+        head += msg::usrmsg::FLD_OUTPUTS;
+        head += "\":[";
+
+        std::vector<uint8_t> &tail = fragments.tail;
+        tail.reserve(64 + unl_sig.size() * 200);
+        tail += SEP_COMMA_NOQUOTE;
+        tail += msg::usrmsg::FLD_UNL_SIG;
+        tail += "\":[";
+        for (size_t i = 0; i < unl_sig.size(); i++)
+        {
+            const auto &sig = unl_sig[i]; // Pubkey and Signature pair.
+            tail += "[\"";
+            tail += util::to_hex(sig.first);
+            tail += SEP_COMMA;
+            tail += util::to_hex(sig.second);
+            tail += "\"]";
+
+            if (i < unl_sig.size() - 1)
+                tail += ",";
+        }
+        tail += "]}";
+    }
+
+    /**
+     * Constructs a contract output container message by placing the user's fields between the round-common fragments.
+     * @param msg Buffer to construct the generated json message string into.
+     * @param fragments Round-common message parts created with create_contract_output_fragments().
+     * @param hash This user's combined output hash. [output hash = hash(pubkey+all outputs for the user)]
+     * @param outputs List of outputs for the user.
+     * @param hash_root Root node of the collapsed merkle hash tree.
+     */
+    void create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                          std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root)
+    {
+        msg.reserve(fragments.head.size() + fragments.tail.size() + 1024);
+        msg.insert(msg.end(), fragments.head.begin(), fragments.head.end());
 
         for (size_t i = 0; i < outputs.size(); i++)
         {
@@ -447,23 +480,8 @@ namespace msg::usrmsg::json
         msg += msg::usrmsg::FLD_HASH_TREE;
         msg += SEP_COLON_NOQUOTE;
         populate_output_hash_array(msg, hash_root);
-        msg += SEP_COMMA_NOQUOTE;
-
-        msg += msg::usrmsg::FLD_UNL_SIG;
-        msg += "\":[";
-        for (size_t i = 0; i < unl_sig.size(); i++)
-        {
-            const auto &sig = unl_sig[i]; // Pubkey and Signature pair.
-            msg += "[\"";
-            msg += util::to_hex(sig.first);
-            msg += SEP_COMMA;
-            msg += util::to_hex(sig.second);
-            msg += "\"]";
 
-            if (i < unl_sig.size() - 1)
-                msg += ",";
-        }
-        msg += "]}";
+        msg.insert(msg.end(), fragments.tail.begin(), fragments.tail.end());
     }
 
     /**
@@ -708,7 +726,7 @@ namespace msg::usrmsg::json
      *                   "sig": "<hex signature of the challenge>",
      *                   "pubkey": "<hex public key of the user>",
      *                   "server_challenge": "<hex encoded challenge issued to server>", (max 16 bytes/32 chars)
-     *                   "protocol": "<json | bson>"
+     *                   "protocol": "<json | bson | flatbuf>"
      *                 }
      * @param original_challenge The original challenge string we issued to the user.
      * @return 0 if challenge response is verified. -1 if challenge not met or an error occurs.
@@ -772,7 +790,7 @@ namespace msg::usrmsg::json
         }
 
         std::string_view protocolsv = d[msg::usrmsg::FLD_PROTOCOL].as<std::string_view>();
-        if (protocolsv != "json" && protocolsv != "bson")
+        if (protocolsv != "json" && protocolsv != "bson" && protocolsv != "flatbuf")
         {
             LOG_DEBUG << "User challenge response 'protocol' type invalid.";
             return -1;
@@ -872,6 +890,30 @@ namespace msg::usrmsg::json
         return 0;
     }
 
+    /**
+     * Extracts a contract read cancel message sent by user.
+     * 
+     * @param extracted_id The id of the read request to cancel.
+     * @param d The json document holding the read cancel message.
+     *          Accepted read cancel format:
+     *          {
+     *            "type": "contract_read_cancel",
+     *            "id": "<read request id>"
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_read_cancel(std::string &extracted_id, const jsoncons::json &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d[msg::usrmsg::FLD_ID].is<std::string>())
+        {
+            LOG_DEBUG << "Read cancel 'id' field missing or invalid.";
+            return -1;
+        }
+
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        return 0;
+    }
+
     /**
      * Extracts a signed input container message sent by user.
      * 
@@ -917,15 +959,17 @@ namespace msg::usrmsg::json
      * @param input The extracted input.
      * @param nonce The extracted nonce.
      * @param max_ledger_seq_no The extracted max ledger sequence no.
+     * @param streamed Whether the input is the hash of bytes uploaded in chunks.
      * @param contentjson The json string containing the input container message.
      *                    {
-     *                      "input": "<any string>",
+     *                      "input": "<any string>", // Hex hash of the uploaded bytes if streamed.
      *                      "nonce": <integer>, // Indicates input ordering.
-     *                      "max_ledger_seq_no": <integer>
+     *                      "max_ledger_seq_no": <integer>,
+     *                      "streamed": <bool> // Optional. Defaults to false.
      *                    }
      * @return 0 on succesful extraction. -1 on failure.
      */
-    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no, std::string_view contentjson)
+    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no, bool &streamed, std::string_view contentjson)
     {
         jsoncons::json d;
         try
@@ -944,7 +988,8 @@ namespace msg::usrmsg::json
             return -1;
         }
 
-        if (!d[msg::usrmsg::FLD_INPUT].is<std::string>() || !d[msg::usrmsg::FLD_NONCE].is<uint64_t>() || !d[msg::usrmsg::FLD_MAX_LEDGER_SEQ_NO].is<uint64_t>())
+        if (!d[msg::usrmsg::FLD_INPUT].is<std::string>() || !d[msg::usrmsg::FLD_NONCE].is<uint64_t>() || !d[msg::usrmsg::FLD_MAX_LEDGER_SEQ_NO].is<uint64_t>() ||
+            (d.contains(msg::usrmsg::FLD_STREAMED) && !d[msg::usrmsg::FLD_STREAMED].is_bool()))
         {
             LOG_DEBUG << "User input container invalid field values.";
             return -1;
@@ -959,10 +1004,93 @@ namespace msg::usrmsg::json
 
         input = d[msg::usrmsg::FLD_INPUT].as<std::string>();
         max_ledger_seq_no = d[msg::usrmsg::FLD_MAX_LEDGER_SEQ_NO].as<uint64_t>();
+        streamed = d.contains(msg::usrmsg::FLD_STREAMED) && d[msg::usrmsg::FLD_STREAMED].as<bool>();
+
+        return 0;
+    }
+
+    /**
+     * Extracts the message which starts a chunked contract input upload.
+     * @param extracted_id The user-assigned upload id.
+     * @param extracted_size The total input size the user is going to upload.
+     * @param d The json document holding the message.
+     *          Accepted message format:
+     *          {
+     *            "type": "contract_input_begin",
+     *            "id": "<any string>",
+     *            "size": <integer> // Total input size in bytes.
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size, const jsoncons::json &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d.contains(msg::usrmsg::FLD_SIZE) ||
+            !d[msg::usrmsg::FLD_ID].is<std::string>() || !d[msg::usrmsg::FLD_SIZE].is<uint64_t>())
+        {
+            LOG_DEBUG << "Input upload begin required fields missing or invalid.";
+            return -1;
+        }
+
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        extracted_size = d[msg::usrmsg::FLD_SIZE].as<uint64_t>();
+        return 0;
+    }
+
+    /**
+     * Extracts a chunk of a contract input upload.
+     * @param extracted_id The upload id the chunk belongs to.
+     * @param extracted_data The chunk data. This points into the json document and is valid as long as the document.
+     * @param d The json document holding the message.
+     *          Accepted message format:
+     *          {
+     *            "type": "contract_input_chunk",
+     *            "id": "<any string>",
+     *            "data": "<any string>"
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data, const jsoncons::json &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d.contains(msg::usrmsg::FLD_DATA) ||
+            !d[msg::usrmsg::FLD_ID].is<std::string>() || !d[msg::usrmsg::FLD_DATA].is<std::string>())
+        {
+            LOG_DEBUG << "Input upload chunk required fields missing or invalid.";
+            return -1;
+        }
 
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        extracted_data = d[msg::usrmsg::FLD_DATA].as<std::string_view>();
         return 0;
     }
 
+    /**
+     * Extracts the message which completes a chunked contract input upload.
+     * @param extracted_id The upload id.
+     * @param extracted_input_container The input container extracted from the message.
+     * @param extracted_sig The binary signature extracted from the message.
+     * @param d The json document holding the message.
+     *          Accepted message format:
+     *          {
+     *            "type": "contract_input_end",
+     *            "id": "<any string>",
+     *            "input_container": "<stringified json input container>", // 'input' holds the hex hash of the uploaded bytes and 'streamed' is true.
+     *            "sig": "<hex encoded signature of stringified input container>"
+     *          }
+     * @return 0 on successful extraction. -1 for failure.
+     */
+    int extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig,
+                                 const jsoncons::json &d)
+    {
+        if (!d.contains(msg::usrmsg::FLD_ID) || !d[msg::usrmsg::FLD_ID].is<std::string>())
+        {
+            LOG_DEBUG << "Input upload end 'id' field missing or invalid.";
+            return -1;
+        }
+
+        extracted_id = d[msg::usrmsg::FLD_ID].as<std::string>();
+        return extract_signed_input_container(extracted_input_container, extracted_sig, d);
+    }
+
     /**
      * Extract ledger event subscription request.
      * @param channel Extracted subscription channel.
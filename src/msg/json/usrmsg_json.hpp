@@ -6,6 +6,7 @@
 #include "../../ledger/ledger_query.hpp"
 #include "../../usr/user_common.hpp"
 #include "../../status.hpp"
+#include "../usrmsg_common.hpp"
 
 namespace msg::usrmsg::json
 {
@@ -23,10 +24,12 @@ namespace msg::usrmsg::json
 
     void create_contract_read_response_container(std::vector<uint8_t> &msg, std::string_view reply_for, std::string_view content);
 
-    void create_contract_output_container(std::vector<uint8_t> &msg, std::string_view hash, const ::std::vector<std::string> &outputs,
-                                          const util::merkle_hash_node &hash_root, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+    void create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
                                           const uint64_t lcl_seq_no, std::string_view lcl_hash);
 
+    void create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                          std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root);
+
     void create_unl_notification(std::vector<uint8_t> &msg, const ::std::set<std::string> &unl_list);
 
     void create_ledger_created_notification(std::vector<uint8_t> &msg, const ledger::ledger_record &ledger);
@@ -47,11 +50,20 @@ namespace msg::usrmsg::json
 
     int extract_read_request(std::string &extracted_id, std::string &extracted_content, const jsoncons::json &d);
 
+    int extract_read_cancel(std::string &extracted_id, const jsoncons::json &d);
+
     int extract_signed_input_container(std::string &extracted_input_container, std::string &extracted_sig,
                                        const jsoncons::json &d);
 
-    int extract_input_container(std::string &input, uint64_t &nonce,
-                                uint64_t &max_ledger_seq_no, std::string_view contentjson);
+    int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no,
+                                bool &streamed, std::string_view contentjson);
+
+    int extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size, const jsoncons::json &d);
+
+    int extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data, const jsoncons::json &d);
+
+    int extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig,
+                                 const jsoncons::json &d);
 
     int extract_subscription_request(usr::NOTIFICATION_CHANNEL &channel, bool &enabled, const jsoncons::json &d);
 
@@ -29,6 +29,7 @@ namespace msg::usrmsg
     constexpr const char *FLD_LEDGER_SEQ_NO = "ledger_seq_no";
     constexpr const char *FLD_LEDGER_HASH = "ledger_hash";
     constexpr const char *FLD_MAX_LEDGER_SEQ_NO = "max_ledger_seq_no";
+    constexpr const char *FLD_STREAMED = "streamed";
     constexpr const char *FLD_CONTENT = "content";
     constexpr const char *FLD_OUTPUTS = "outputs";
     constexpr const char *FLD_OUTPUT_HASH = "output_hash";
@@ -73,6 +74,8 @@ namespace msg::usrmsg
     constexpr const char *FLD_AVG = "avg";
     constexpr const char *FLD_PEER_COUNT = "peer_count";
     constexpr const char *FLD_WEAKLY_CONNECTED = "weakly_connected";
+    constexpr const char *FLD_SIZE = "size";
+    constexpr const char *FLD_DATA = "data";
 
     // Message types
     constexpr const char *MSGTYPE_USER_CHALLENGE = "user_challenge";
@@ -80,8 +83,12 @@ namespace msg::usrmsg
     constexpr const char *MSGTYPE_SERVER_CHALLENGE_RESPONSE = "server_challenge_response";
     constexpr const char *MSGTYPE_CONTRACT_READ_REQUEST = "contract_read_request";
     constexpr const char *MSGTYPE_CONTRACT_READ_RESPONSE = "contract_read_response";
+    constexpr const char *MSGTYPE_CONTRACT_READ_CANCEL = "contract_read_cancel";
     constexpr const char *MSGTYPE_CONTRACT_INPUT = "contract_input";
     constexpr const char *MSGTYPE_CONTRACT_INPUT_STATUS = "contract_input_status";
+    constexpr const char *MSGTYPE_CONTRACT_INPUT_BEGIN = "contract_input_begin";
+    constexpr const char *MSGTYPE_CONTRACT_INPUT_CHUNK = "contract_input_chunk";
+    constexpr const char *MSGTYPE_CONTRACT_INPUT_END = "contract_input_end";
     constexpr const char *MSGTYPE_CONTRACT_OUTPUT = "contract_output";
     constexpr const char *MSGTYPE_STAT = "stat";
     constexpr const char *MSGTYPE_STAT_RESPONSE = "stat_response";
@@ -106,6 +113,12 @@ namespace msg::usrmsg
     constexpr const char *REASON_NONCE_EXPIRED = "nonce_expired";
     constexpr const char *REASON_ALREADY_SUBMITTED = "already_submitted";
     constexpr const char *REASON_ROUND_INPUTS_OVERFLOW = "round_inputs_overflow";
+    constexpr const char *REASON_UPLOAD_TOO_LARGE = "upload_too_large";
+    constexpr const char *REASON_UPLOAD_LIMIT_EXCEEDED = "upload_limit_exceeded";
+    constexpr const char *REASON_UPLOAD_NOT_FOUND = "upload_not_found";
+    constexpr const char *REASON_UPLOAD_SIZE_MISMATCH = "upload_size_mismatch";
+    constexpr const char *REASON_INPUT_HASH_MISMATCH = "input_hash_mismatch";
+    constexpr const char *REASON_RATE_LIMITED = "rate_limited";
     constexpr const char *QUERY_FILTER_BY_SEQ_NO = "seq_no";
     constexpr const char *STR_TRUE = "true";
     constexpr const char *STR_FALSE = "false";
@@ -115,6 +128,21 @@ namespace msg::usrmsg
     constexpr const char *HEALTH_EVENT_PROPOSAL = "proposal";
     constexpr const char *HEALTH_EVENT_CONNECTIVITY = "connectivity";
 
+    /**
+     * Parts of a contract output message which are the same for all users of a ledger. These are serialized once per
+     * protocol and each user's message is assembled around the user's own fields.
+     */
+    struct contract_output_fragments
+    {
+        std::vector<uint8_t> head; // Serialized fields preceding the user's fields.
+        std::vector<uint8_t> tail; // Serialized fields following the user's fields.
+
+        // Round values for protocols which encode them along with each user's fields.
+        uint64_t lcl_seq_no = 0;
+        std::string lcl_hash;
+        const std::vector<std::pair<std::string, std::string>> *unl_sig = NULL;
+    };
+
 } // namespace msg::usrmsg
 
 #endif
\ No newline at end of file
@@ -2,10 +2,12 @@
 #include "../util/util.hpp"
 #include "json/usrmsg_json.hpp"
 #include "bson/usrmsg_bson.hpp"
+#include "fbuf/usrmsg_fbuf.hpp"
 #include "usrmsg_parser.hpp"
 
 namespace jusrmsg = msg::usrmsg::json;
 namespace busrmsg = msg::usrmsg::bson;
+namespace fusrmsg = msg::fbuf::usrmsg;
 
 namespace msg::usrmsg
 {
@@ -17,16 +19,20 @@ namespace msg::usrmsg
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_status_response(msg);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_status_response(msg);
+        else
+            fusrmsg::create_status_response(msg);
     }
 
     void usrmsg_parser::create_lcl_response(std::vector<uint8_t> &msg) const
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_lcl_response(msg);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_lcl_response(msg);
+        else
+            fusrmsg::create_lcl_response(msg);
     }
 
     void usrmsg_parser::create_contract_input_status(std::vector<uint8_t> &msg, std::string_view status, std::string_view reason,
@@ -34,58 +40,82 @@ namespace msg::usrmsg
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_contract_input_status(msg, status, reason, input_hash, ledger_seq_no, ledger_hash);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_contract_input_status(msg, status, reason, input_hash, ledger_seq_no, ledger_hash);
+        else
+            fusrmsg::create_contract_input_status(msg, status, reason, input_hash, ledger_seq_no, ledger_hash);
     }
 
     void usrmsg_parser::create_contract_read_response_container(std::vector<uint8_t> &msg, std::string_view reply_for, std::string_view content) const
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_contract_read_response_container(msg, reply_for, content);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_contract_read_response_container(msg, reply_for, content);
+        else
+            fusrmsg::create_contract_read_response_container(msg, reply_for, content);
     }
 
-    void usrmsg_parser::create_contract_output_container(std::vector<uint8_t> &msg, std::string_view hash, const ::std::vector<std::string> &outputs,
-                                                         const util::merkle_hash_node &hash_root, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+    void usrmsg_parser::create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
                                                          const uint64_t lcl_seq_no, std::string_view lcl_hash) const
     {
         if (protocol == util::PROTOCOL::JSON)
-            jusrmsg::create_contract_output_container(msg, hash, outputs, hash_root, unl_sig, lcl_seq_no, lcl_hash);
+            jusrmsg::create_contract_output_fragments(fragments, unl_sig, lcl_seq_no, lcl_hash);
+        else if (protocol == util::PROTOCOL::BSON)
+            busrmsg::create_contract_output_fragments(fragments, unl_sig, lcl_seq_no, lcl_hash);
         else
-            busrmsg::create_contract_output_container(msg, hash, outputs, hash_root, unl_sig, lcl_seq_no, lcl_hash);
+            fusrmsg::create_contract_output_fragments(fragments, unl_sig, lcl_seq_no, lcl_hash);
+    }
+
+    void usrmsg_parser::create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                                         std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root) const
+    {
+        if (protocol == util::PROTOCOL::JSON)
+            jusrmsg::create_contract_output_container(msg, fragments, hash, outputs, hash_root);
+        else if (protocol == util::PROTOCOL::BSON)
+            busrmsg::create_contract_output_container(msg, fragments, hash, outputs, hash_root);
+        else
+            fusrmsg::create_contract_output_container(msg, fragments, hash, outputs, hash_root);
     }
 
     void usrmsg_parser::create_unl_notification(std::vector<uint8_t> &msg, const std::set<std::string> &unl_list) const
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_unl_notification(msg, unl_list);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_unl_notification(msg, unl_list);
+        else
+            fusrmsg::create_unl_notification(msg, unl_list);
     }
 
     void usrmsg_parser::create_ledger_created_notification(std::vector<uint8_t> &msg, const ledger::ledger_record &ledger) const
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_ledger_created_notification(msg, ledger);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_ledger_created_notification(msg, ledger);
+        else
+            fusrmsg::create_ledger_created_notification(msg, ledger);
     }
 
     void usrmsg_parser::create_vote_status_notification(std::vector<uint8_t> &msg, const status::VOTE_STATUS vote_status) const
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_vote_status_notification(msg, vote_status);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_vote_status_notification(msg, vote_status);
+        else
+            fusrmsg::create_vote_status_notification(msg, vote_status);
     }
 
     void usrmsg_parser::create_health_notification(std::vector<uint8_t> &msg, const status::health_event &ev) const
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_health_notification(msg, ev);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_health_notification(msg, ev);
+        else
+            fusrmsg::create_health_notification(msg, ev);
     }
 
     void usrmsg_parser::create_ledger_query_response(std::vector<uint8_t> &msg, std::string_view reply_for,
@@ -93,65 +123,121 @@ namespace msg::usrmsg
     {
         if (protocol == util::PROTOCOL::JSON)
             jusrmsg::create_ledger_query_response(msg, reply_for, result);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             busrmsg::create_ledger_query_response(msg, reply_for, result);
+        else
+            fusrmsg::create_ledger_query_response(msg, reply_for, result);
     }
 
     int usrmsg_parser::parse(std::string_view message)
     {
         if (protocol == util::PROTOCOL::JSON)
             return jusrmsg::parse_user_message(jdoc, message);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             return busrmsg::parse_user_message(bdoc, message);
+        else
+            return fusrmsg::parse_user_message(fdoc, message);
     }
 
     int usrmsg_parser::extract_type(std::string &extracted_type) const
     {
         if (protocol == util::PROTOCOL::JSON)
             return jusrmsg::extract_type(extracted_type, jdoc);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             return busrmsg::extract_type(extracted_type, bdoc);
+        else
+            return fusrmsg::extract_type(extracted_type, fdoc);
     }
 
     int usrmsg_parser::extract_read_request(std::string &extracted_id, std::string &extracted_content) const
     {
         if (protocol == util::PROTOCOL::JSON)
             return jusrmsg::extract_read_request(extracted_id, extracted_content, jdoc);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             return busrmsg::extract_read_request(extracted_id, extracted_content, bdoc);
+        else
+            return fusrmsg::extract_read_request(extracted_id, extracted_content, fdoc);
+    }
+
+    int usrmsg_parser::extract_read_cancel(std::string &extracted_id) const
+    {
+        if (protocol == util::PROTOCOL::JSON)
+            return jusrmsg::extract_read_cancel(extracted_id, jdoc);
+        else if (protocol == util::PROTOCOL::BSON)
+            return busrmsg::extract_read_cancel(extracted_id, bdoc);
+        else
+            return fusrmsg::extract_read_cancel(extracted_id, fdoc);
     }
 
     int usrmsg_parser::extract_signed_input_container(std::string &extracted_input_container, std::string &extracted_sig) const
     {
         if (protocol == util::PROTOCOL::JSON)
             return jusrmsg::extract_signed_input_container(extracted_input_container, extracted_sig, jdoc);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             return busrmsg::extract_signed_input_container(extracted_input_container, extracted_sig, bdoc);
+        else
+            return fusrmsg::extract_signed_input_container(extracted_input_container, extracted_sig, fdoc);
     }
 
-    int usrmsg_parser::extract_input_container(std::string &input, uint64_t &nonce,
-                                               uint64_t &max_ledger_seq_no, std::string_view encoded_content) const
+    int usrmsg_parser::extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no,
+                                               bool &streamed, std::string_view encoded_content) const
     {
         if (protocol == util::PROTOCOL::JSON)
-            return jusrmsg::extract_input_container(input, nonce, max_ledger_seq_no, encoded_content);
+            return jusrmsg::extract_input_container(input, nonce, max_ledger_seq_no, streamed, encoded_content);
+        else if (protocol == util::PROTOCOL::BSON)
+            return busrmsg::extract_input_container(input, nonce, max_ledger_seq_no, streamed, encoded_content);
         else
-            return busrmsg::extract_input_container(input, nonce, max_ledger_seq_no, encoded_content);
+            return fusrmsg::extract_input_container(input, nonce, max_ledger_seq_no, streamed, encoded_content);
+    }
+
+    int usrmsg_parser::extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size) const
+    {
+        if (protocol == util::PROTOCOL::JSON)
+            return jusrmsg::extract_input_upload_begin(extracted_id, extracted_size, jdoc);
+        else if (protocol == util::PROTOCOL::BSON)
+            return busrmsg::extract_input_upload_begin(extracted_id, extracted_size, bdoc);
+        else
+            return fusrmsg::extract_input_upload_begin(extracted_id, extracted_size, fdoc);
+    }
+
+    int usrmsg_parser::extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data) const
+    {
+        if (protocol == util::PROTOCOL::JSON)
+            return jusrmsg::extract_input_upload_chunk(extracted_id, extracted_data, jdoc);
+        else if (protocol == util::PROTOCOL::BSON)
+            return busrmsg::extract_input_upload_chunk(extracted_id, extracted_data, bdoc);
+        else
+            return fusrmsg::extract_input_upload_chunk(extracted_id, extracted_data, fdoc);
+    }
+
+    int usrmsg_parser::extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig) const
+    {
+        if (protocol == util::PROTOCOL::JSON)
+            return jusrmsg::extract_input_upload_end(extracted_id, extracted_input_container, extracted_sig, jdoc);
+        else if (protocol == util::PROTOCOL::BSON)
+            return busrmsg::extract_input_upload_end(extracted_id, extracted_input_container, extracted_sig, bdoc);
+        else
+            return fusrmsg::extract_input_upload_end(extracted_id, extracted_input_container, extracted_sig, fdoc);
     }
 
     int usrmsg_parser::extract_subscription_request(usr::NOTIFICATION_CHANNEL &channel, bool &enabled)
     {
         if (protocol == util::PROTOCOL::JSON)
             return jusrmsg::extract_subscription_request(channel, enabled, jdoc);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             return busrmsg::extract_subscription_request(channel, enabled, bdoc);
+        else
+            return fusrmsg::extract_subscription_request(channel, enabled, fdoc);
     }
 
     int usrmsg_parser::extract_ledger_query(ledger::query::query_request &extracted_query, std::string &extracted_id) const
     {
         if (protocol == util::PROTOCOL::JSON)
             return jusrmsg::extract_ledger_query(extracted_query, extracted_id, jdoc);
-        else
+        else if (protocol == util::PROTOCOL::BSON)
             return busrmsg::extract_ledger_query(extracted_query, extracted_id, bdoc);
+        else
+            return fusrmsg::extract_ledger_query(extracted_query, extracted_id, fdoc);
     }
 
 } // namespace msg::usrmsg
\ No newline at end of file
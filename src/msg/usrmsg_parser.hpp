@@ -7,6 +7,12 @@
 #include "../ledger/ledger_query.hpp"
 #include "../usr/user_common.hpp"
 #include "../status.hpp"
+#include "usrmsg_common.hpp"
+
+namespace msg::fbuf::usrmsg
+{
+    struct UserMsg;
+}
 
 namespace msg::usrmsg
 {
@@ -15,6 +21,7 @@ namespace msg::usrmsg
         const util::PROTOCOL protocol;
         jsoncons::json jdoc;
         jsoncons::ojson bdoc;
+        const msg::fbuf::usrmsg::UserMsg *fdoc = NULL; // Points into the parsed message buffer (not copied).
 
     public:
         usrmsg_parser(const util::PROTOCOL protocol);
@@ -28,10 +35,12 @@ namespace msg::usrmsg
 
         void create_contract_read_response_container(std::vector<uint8_t> &msg, std::string_view reply_for, std::string_view content) const;
 
-        void create_contract_output_container(std::vector<uint8_t> &msg, std::string_view hash, const ::std::vector<std::string> &outputs,
-                                              const util::merkle_hash_node &hash_root, const std::vector<std::pair<std::string, std::string>> &unl_sig,
+        void create_contract_output_fragments(msg::usrmsg::contract_output_fragments &fragments, const std::vector<std::pair<std::string, std::string>> &unl_sig,
                                               const uint64_t lcl_seq_no, std::string_view lcl_hash) const;
 
+        void create_contract_output_container(std::vector<uint8_t> &msg, const msg::usrmsg::contract_output_fragments &fragments,
+                                              std::string_view hash, const ::std::vector<std::string> &outputs, const util::merkle_hash_node &hash_root) const;
+
         void create_unl_notification(std::vector<uint8_t> &msg, const std::set<std::string> &unl_list) const;
 
         void create_ledger_created_notification(std::vector<uint8_t> &msg, const ledger::ledger_record &ledger) const;
@@ -49,10 +58,18 @@ namespace msg::usrmsg
 
         int extract_read_request(std::string &extracted_id, std::string &extracted_content) const;
 
+        int extract_read_cancel(std::string &extracted_id) const;
+
         int extract_signed_input_container(std::string &extracted_input_container, std::string &extracted_sig) const;
 
-        int extract_input_container(std::string &input, uint64_t &nonce,
-                                    uint64_t &max_ledger_seq_no, std::string_view encoded_content) const;
+        int extract_input_container(std::string &input, uint64_t &nonce, uint64_t &max_ledger_seq_no,
+                                    bool &streamed, std::string_view encoded_content) const;
+
+        int extract_input_upload_begin(std::string &extracted_id, uint64_t &extracted_size) const;
+
+        int extract_input_upload_chunk(std::string &extracted_id, std::string_view &extracted_data) const;
+
+        int extract_input_upload_end(std::string &extracted_id, std::string &extracted_input_container, std::string &extracted_sig) const;
 
         int extract_subscription_request(usr::NOTIFICATION_CHANNEL &channel, bool &enabled);
 
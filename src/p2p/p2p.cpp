@@ -7,9 +7,13 @@
 #include "../msg/fbuf/common_helpers.hpp"
 #include "../msg/fbuf/p2pmsg_conversion.hpp"
 #include "../ledger/ledger.hpp"
+#include "../usr/usr.hpp"
 #include "p2p.hpp"
 #include "self_node.hpp"
+#include "peer_compression.hpp"
 #include "../unl.hpp"
+#include "../status.hpp"
+#include "../metrics.hpp"
 
 namespace p2pmsg = msg::fbuf::p2pmsg;
 
@@ -37,6 +41,9 @@ namespace p2p
         metric_thresholds[3] = conf::cfg.mesh.max_bad_msgs_per_min;
         metric_thresholds[4] = conf::cfg.mesh.idle_timeout;
 
+        metrics::register_gauge_callback("hp_peers_connected", "No. of connected peers.", []() { return (int64_t)status::get_peers_count(); });
+        init_compression_metrics();
+
         // Entry point for p2p which will start peer connections to other nodes
         if (start_peer_connections() == -1)
             return -1;
@@ -225,6 +232,9 @@ namespace p2p
         if (send_to_self)
             self::send(message);
 
+        // Compress (if applicable) before locking the peer connections.
+        const outbound_message outbound(message);
+
         // Broadcast while locking the peer_connections.
         std::scoped_lock<std::mutex> lock(ctx.peer_connections_mutex);
 
@@ -237,7 +247,7 @@ namespace p2p
                 (unl_only && !session->is_unl))
                 continue;
 
-            session->send(message, priority);
+            session->send(outbound.for_session(*session), priority);
         }
     }
 
@@ -293,6 +303,8 @@ namespace p2p
      */
     void send_message_to_random_peer(const flatbuffers::FlatBufferBuilder &fbuf, std::string &target_pubkey, const bool full_history_only)
     {
+        const outbound_message outbound(fbuf);
+
         // Send while locking the peer_connections.
         std::scoped_lock<std::mutex> lock(ctx.peer_connections_mutex);
 
@@ -336,14 +348,14 @@ namespace p2p
         }
 
         // send message to selected peer.
-        session->send(msg::fbuf::builder_to_string_view(fbuf));
+        session->send(outbound.for_session(*session));
         target_pubkey = session->uniqueid;
     }
 
     /**
-     * Handle proposal message. This is called from peer and self message handlers.
+     * Handle proposal message. This is called from peer and self message handlers and when delivering our own proposal.
      */
-    void handle_proposal_message(const p2p::proposal &p)
+    void handle_proposal_message(p2p::proposal p)
     {
         // Check the cap and insert proposal with lock.
         std::scoped_lock<std::mutex> lock(ctx.collected_msgs.proposals_mutex);
@@ -356,18 +368,81 @@ namespace p2p
     }
 
     /**
-     * Handle nonunl proposal message. This is called from peer and self message handlers.
+     * Handle nonunl proposal message. This is called from peer message handler and when delivering our own NUP.
+     * NUPs are merged per sender since the input relay sends many NUPs per round.
+     * @param nup The received NUP.
+     * @param sender Id of the session the NUP was received from. Empty for our own NUPs.
      */
-    void handle_nonunl_proposal_message(const p2p::nonunl_proposal &nup)
+    void handle_nonunl_proposal_message(p2p::nonunl_proposal nup, const std::string &sender)
     {
-        // Check the cap and insert proposal with lock.
+        static metrics::counter &dropped_nups = metrics::get_counter("hp_nonunl_proposals_dropped_total", "NUPs dropped due to the sender cap. Their inputs are lost.");
+        static metrics::counter &dropped_inputs = metrics::get_counter("hp_nonunl_inputs_dropped_total", "NUP inputs dropped due to the per sender input cap.");
+
+        // Check the caps and merge proposal with lock.
         std::scoped_lock<std::mutex> lock(ctx.collected_msgs.nonunl_proposals_mutex);
 
-        // If max number of nonunl proposals reached skip the rest.
-        if (ctx.collected_msgs.nonunl_proposals.size() == p2p::NONUNL_PROPOSAL_LIST_CAP)
-            LOG_DEBUG << "Nonunl proposal rejected. Maximum nonunl proposal count reached. self";
-        else
-            ctx.collected_msgs.nonunl_proposals.push_back(std::move(nup));
+        auto itr = ctx.collected_msgs.nonunl_proposals.find(sender);
+        if (itr == ctx.collected_msgs.nonunl_proposals.end())
+        {
+            if (ctx.collected_msgs.nonunl_proposals.size() == p2p::NONUNL_PROPOSAL_LIST_CAP)
+            {
+                // If max number of nonunl proposal senders reached skip the rest.
+                dropped_nups.inc();
+                LOG_WARNING << "Nonunl proposal rejected. Maximum nonunl proposal sender count reached. users:" << nup.user_inputs.size();
+
+                // Release the input store space held by any inputs uploaded to us since they won't be processed.
+                for (const auto &[pubkey, inputs] : nup.user_inputs)
+                {
+                    for (const usr::submitted_user_input &input : inputs)
+                        purge_stored_input(input);
+                }
+                return;
+            }
+
+            itr = ctx.collected_msgs.nonunl_proposals.try_emplace(sender).first;
+        }
+
+        // Merge the inputs in order while they fit in the sender's input cap for the round.
+        const uint64_t max_input_bytes = conf::cfg.user.max_round_input_bytes > 0
+                                             ? conf::cfg.user.max_round_input_bytes * NONUNL_PROPOSAL_SENDER_INPUT_FACTOR
+                                             : NONUNL_PROPOSAL_SENDER_MAX_INPUT_BYTES;
+        p2p::nonunl_proposal &collected = itr->second;
+        size_t dropped_count = 0;
+
+        for (auto &[pubkey, inputs] : nup.user_inputs)
+        {
+            // Users without inputs are merged as well since the user list tracks connected users.
+            std::list<usr::submitted_user_input> &merged_inputs = collected.user_inputs[pubkey];
+            while (!inputs.empty())
+            {
+                const size_t input_size = inputs.front().input_size();
+                if (collected.collected_input_bytes + input_size > max_input_bytes)
+                {
+                    purge_stored_input(inputs.front());
+                    inputs.pop_front();
+                    dropped_count++;
+                    continue;
+                }
+
+                collected.collected_input_bytes += input_size;
+                merged_inputs.splice(merged_inputs.end(), inputs, inputs.begin());
+            }
+        }
+
+        if (dropped_count > 0)
+        {
+            dropped_inputs.inc(dropped_count);
+            LOG_WARNING << "Nonunl proposal inputs dropped. Sender input cap reached. dropped:" << dropped_count;
+        }
+    }
+
+    /**
+     * Releases the input store space held by an input uploaded to us which won't be processed.
+     */
+    void purge_stored_input(const usr::submitted_user_input &input)
+    {
+        if (!input.stored_input.is_null())
+            usr::input_store.purge(input.stored_input);
     }
 
     /**
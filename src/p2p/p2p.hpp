@@ -5,6 +5,9 @@
 #include "../usr/user_input.hpp"
 #include "../util/h32.hpp"
 #include "../util/sequence_hash.hpp"
+#include "../util/fixed_bytes.hpp"
+#include "../util/flat_set.hpp"
+#include "proposal_set.hpp"
 #include "../conf.hpp"
 #include "../hpfs/hpfs_mount.hpp"
 #include "../msg/fbuf/p2pmsg_generated.h"
@@ -14,7 +17,13 @@
 namespace p2p
 {
     constexpr uint16_t PROPOSAL_LIST_CAP = 255;        // Maximum proposal count.
-    constexpr uint16_t NONUNL_PROPOSAL_LIST_CAP = 255; // Maximum nonunl proposal count.
+    constexpr uint16_t NONUNL_PROPOSAL_LIST_CAP = 255; // Maximum nonunl proposal sender count.
+
+    // Max user input bytes merged from a single NUP sender per round. A node relays up to max_round_input_bytes per
+    // round over its sealing and relay NUPs, and a forwarding neighbour carries NUPs of other nodes as well. So the cap
+    // is a multiple of our own max_round_input_bytes, or a fixed size when that is unlimited.
+    constexpr uint64_t NONUNL_PROPOSAL_SENDER_INPUT_FACTOR = 8;
+    constexpr uint64_t NONUNL_PROPOSAL_SENDER_MAX_INPUT_BYTES = 256 * 1024 * 1024;
     constexpr uint16_t HPFS_REQ_LIST_CAP = 255;        // Maximum state request count.
     constexpr uint16_t HPFS_RES_LIST_CAP = 255;        // Maximum state response count.
     constexpr uint16_t LOG_RECORD_REQ_LIST_CAP = 255;  // Maximum log record request count.
@@ -44,8 +53,8 @@ namespace p2p
     struct proposal
     {
         std::string pubkey;
-        util::h32 root_hash; // The proposal root hash (hash of all the proposal consensus fields). Only populated for incoming proposals.
-        bool from_self;      // Whether the proposal was sent by this node itself. Only populated for incoming proposals.
+        util::h32 root_hash; // The proposal root hash (hash of all the proposal consensus fields). Populated when received or broadcasted.
+        bool from_self;      // Whether the proposal was sent by this node itself. Populated when received or broadcasted.
 
         uint64_t sent_timestamp = 0; // The timestamp of the sender when this proposal was sent.
         uint64_t recv_timestamp = 0; // The timestamp when we received the proposal. (used for network statistics)
@@ -58,15 +67,16 @@ namespace p2p
         util::sequence_hash last_raw_shard_id;
         util::h32 state_hash; // Contract state hash.
         util::h32 patch_hash; // Patch file hash.
-        std::set<std::string> users;
-        std::set<std::string> input_ordered_hashes;
-        std::string output_hash;
+        proposal_set<sizeof(util::pk33)> users;
+        proposal_set<sizeof(util::h40)> input_ordered_hashes;
+        util::h32 output_hash; // Merkle root hash of user outputs.
         std::string output_sig;
     };
 
     struct nonunl_proposal
     {
         std::unordered_map<std::string, std::list<usr::submitted_user_input>> user_inputs;
+        uint64_t collected_input_bytes = 0; // Input bytes merged into a collected NUP during the round. Not serialized.
     };
 
     struct peer_challenge
@@ -75,6 +85,7 @@ namespace p2p
         uint32_t time_config = 0; // Contains unified value derived from (roundtime*100 + stage_slice)
         bool is_full_history = false;
         std::string challenge;
+        msg::fbuf::p2pmsg::CompressionType compression = msg::fbuf::p2pmsg::CompressionType_None; // Compression accepted by the peer.
     };
 
     struct peer_challenge_response
@@ -182,7 +193,8 @@ namespace p2p
         std::list<proposal> proposals;
         std::mutex proposals_mutex; // Mutex for proposals access race conditions.
 
-        std::list<nonunl_proposal> nonunl_proposals;
+        // NUPs received during the round merged per sender. Key: sender session id (empty for self).
+        std::unordered_map<std::string, nonunl_proposal> nonunl_proposals;
         std::mutex nonunl_proposals_mutex; // Mutex for non-unl proposals access race conditions.
 
         // List of pairs indicating the session pubkey hex and the contract fs hpfs requests.
@@ -240,9 +252,11 @@ namespace p2p
 
     void send_message_to_random_peer(const flatbuffers::FlatBufferBuilder &fbuf, std::string &target_pubkey, const bool full_history_only = false);
 
-    void handle_proposal_message(const p2p::proposal &p);
+    void handle_proposal_message(p2p::proposal p);
+
+    void handle_nonunl_proposal_message(p2p::nonunl_proposal nup, const std::string &sender = "");
 
-    void handle_nonunl_proposal_message(const p2p::nonunl_proposal &nup);
+    void purge_stored_input(const usr::submitted_user_input &input);
 
     void handle_npl_message(const p2p::npl_message &npl);
 
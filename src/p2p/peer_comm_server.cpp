@@ -7,6 +7,7 @@
 #include "peer_comm_session.hpp"
 #include "self_node.hpp"
 #include "../status.hpp"
+#include "../thread_placement.hpp"
 
 namespace p2p
 {
@@ -41,6 +42,7 @@ namespace p2p
     void peer_comm_server::peer_managing_loop()
     {
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::NETWORK, "hp-peer-mgr");
 
         LOG_INFO << "Started peer managing thread.";
 
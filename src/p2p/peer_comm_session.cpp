@@ -8,13 +8,15 @@
 #include "../sc/sc.hpp"
 #include "../ledger/ledger.hpp"
 #include "peer_comm_session.hpp"
+#include "peer_compression.hpp"
 
 namespace p2pmsg = msg::fbuf::p2pmsg;
 
 namespace p2p
 {
-    // The set of recent peer message hashes used for duplicate detection.
+    // The set of recent peer message hashes used for duplicate detection. Shared by the reader threads of all peer sessions.
     util::rollover_hashset recent_peermsg_hashes(200);
+    std::mutex recent_peermsg_hashes_mutex;
 
     /**
      * This gets hit every time a peer connects to HP via the peer port (configured in config).
@@ -41,49 +43,77 @@ namespace p2p
     }
 
     /**
-     * Returns the priority that should be assigned to the message.
-     * @return 0 if bad message. 1 or 2 if correct priority was assigned.
+     * Verifies, classifies and duplicate-checks the message on the session reader thread. So the message processor
+     * only receives structurally valid and unique messages along with their type and origin timestamp.
+     * @return MSG_BAD if bad message. MSG_DROP if the message is too old or a duplicate. Otherwise the priority class.
      */
-    int peer_comm_session::get_message_priority(std::string_view msg)
+    comm::MSG_CLASS peer_comm_session::classify_message(std::string_view data, comm::inbound_message &msg)
     {
-        if (!p2pmsg::verify_peer_message(msg))
+        if (!p2pmsg::verify_peer_message(data))
         {
             LOG_DEBUG << "Flatbuffer verify: Bad peer message.";
-            return 0;
+            return comm::MSG_CLASS::MSG_BAD;
         }
 
-        const auto p2p_msg = p2pmsg::GetP2PMsg(msg.data());
-        const msg::fbuf::p2pmsg::P2PMsgContent type = p2p_msg->content_type();
-
-        if (type == p2pmsg::P2PMsgContent_ProposalMsg || type == p2pmsg::P2PMsgContent_NonUnlProposalMsg)
-            return 1; // High priority
-        else
-            return 2; // Low priority
-    }
+        // Compressed messages are restored here so the rest of the pipeline only deals with the original message.
+        const p2pmsg::CompressedMsg *compressed_msg = p2pmsg::GetP2PMsg(data.data())->content_as_CompressedMsg();
+        if (compressed_msg)
+        {
+            if (p2p::decompress_message(msg.data, *compressed_msg) == -1 || !p2pmsg::verify_peer_message(msg.data) ||
+                p2pmsg::GetP2PMsg(msg.data.data())->content_type() == p2pmsg::P2PMsgContent_CompressedMsg)
+            {
+                LOG_DEBUG << "Bad compressed peer message. from:" << display_name();
+                return comm::MSG_CLASS::MSG_BAD;
+            }
+            data = msg.data;
+        }
 
-    /**
-     * Peer session on message callback method. Validate and handle each type of peer messages.
-     * @return 0 on normal execution. -1 when session needs to be closed as a result of message handling.
-     */
-    int peer_comm_session::handle_message(std::string_view msg)
-    {
-        const size_t message_size = msg.size();
-        // Adding message size to peer message characters(bytes) per minute counter.
-        increment_metric(comm::SESSION_THRESHOLDS::MAX_RAWBYTES_PER_MINUTE, message_size);
+        // Adding message size to peer message characters(bytes) per minute counter. Compressed messages are
+        // counted by their original size.
+        increment_metric(comm::SESSION_THRESHOLDS::MAX_RAWBYTES_PER_MINUTE, data.size());
 
-        const peer_message_info mi = p2pmsg::get_peer_message_info(msg, this);
+        const peer_message_info mi = p2pmsg::get_peer_message_info(data, this);
         if (!mi.p2p_msg) // Message buffer will be null if peer message was too old.
-            return 0;
+            return comm::MSG_CLASS::MSG_DROP;
+
+        if (mi.type == p2pmsg::P2PMsgContent_ProposalMsg && !p2pmsg::verify_proposal_msg_structure(mi))
+        {
+            LOG_DEBUG << "Malformed peer proposal. from:" << display_name();
+            return comm::MSG_CLASS::MSG_BAD;
+        }
 
         // Messages larger than the duplicate message threshold is ignored from the duplicate message check
         // due to the overhead in hash generation for larger messages.
-        if (message_size <= conf::MAX_SIZE_FOR_DUP_CHECK && !recent_peermsg_hashes.try_emplace(crypto::get_hash(msg)))
+        if (data.size() <= conf::MAX_SIZE_FOR_DUP_CHECK)
         {
-            increment_metric(comm::SESSION_THRESHOLDS::MAX_DUPMSGS_PER_MINUTE, 1);
-            LOG_DEBUG << "Duplicate peer message. type:" << mi.type << " from:" << display_name();
-            return 0;
+            std::string hash = crypto::get_hash(data);
+            std::scoped_lock<std::mutex> lock(recent_peermsg_hashes_mutex);
+            if (!recent_peermsg_hashes.try_emplace(std::move(hash)))
+            {
+                increment_metric(comm::SESSION_THRESHOLDS::MAX_DUPMSGS_PER_MINUTE, 1);
+                LOG_DEBUG << "Duplicate peer message. type:" << mi.type << " from:" << display_name();
+                return comm::MSG_CLASS::MSG_DROP;
+            }
         }
 
+        msg.type = mi.type;
+        msg.originated_on = mi.originated_on;
+
+        if (mi.type == p2pmsg::P2PMsgContent_ProposalMsg || mi.type == p2pmsg::P2PMsgContent_NonUnlProposalMsg)
+            return comm::MSG_CLASS::MSG_HIGH_PRIORITY;
+        else
+            return comm::MSG_CLASS::MSG_LOW_PRIORITY;
+    }
+
+    /**
+     * Peer session on message callback method. Handle each type of peer messages. The message has already been
+     * verified, classified and duplicate-checked by classify_message().
+     * @return 0 on normal execution. -1 when session needs to be closed as a result of message handling.
+     */
+    int peer_comm_session::handle_message(comm::inbound_message &msg)
+    {
+        const peer_message_info mi{p2pmsg::GetP2PMsg(msg.data.data()), (p2pmsg::P2PMsgContent)msg.type, msg.originated_on};
+
         // Check whether the message is qualified for message forwarding.
         if (p2p::validate_for_peer_msg_forwarding(*this, mi.type, mi.originated_on))
         {
@@ -94,12 +124,12 @@ namespace p2p
             if (need_consensus_msg_forwarding)
             {
                 // Forward messages received by weakly connected nodes to other peers.
-                p2p::broadcast_message(msg, false, false, unl_only, this);
+                p2p::broadcast_message(msg.data, false, false, unl_only, this);
             }
             else
             {
                 // Forward message received from other nodes to weakly connected peers.
-                p2p::broadcast_message(msg, false, true, unl_only, this);
+                p2p::broadcast_message(msg.data, false, true, unl_only, this);
             }
         }
 
@@ -136,6 +166,9 @@ namespace p2p
             // Whether this node is a full history node or not.
             is_full_history = chall.is_full_history;
 
+            // Bulk messages are compressed for this peer only if it accepts our compression.
+            accepted_compression = chall.compression;
+
             // Sending the challenge response to the sender.
             p2pmsg::create_peer_challenge_response_from_challenge(fbuf, chall.challenge);
             return send(msg::fbuf::builder_to_string_view(fbuf));
@@ -186,7 +219,7 @@ namespace p2p
         }
         else if (mi.type == p2pmsg::P2PMsgContent_NonUnlProposalMsg)
         {
-            handle_nonunl_proposal_message(p2pmsg::create_nonunl_proposal_from_msg(mi));
+            handle_nonunl_proposal_message(p2pmsg::create_nonunl_proposal_from_msg(mi), uniqueid);
         }
         else if (mi.type == p2pmsg::P2PMsgContent_ProposalMsg)
         {
@@ -198,7 +231,10 @@ namespace p2p
                 return 0;
             }
 
-            handle_proposal_message(p2pmsg::create_proposal_from_msg(mi, hash));
+            // The proposal keeps the message buffer and reads its user and input lists in place.
+            std::shared_ptr<const std::string> buffer = std::make_shared<const std::string>(std::move(msg.data));
+            const peer_message_info buffer_mi{p2pmsg::GetP2PMsg(buffer->data()), mi.type, mi.originated_on};
+            handle_proposal_message(p2pmsg::create_proposal_from_msg(buffer_mi, hash, std::move(buffer)));
         }
         else if (mi.type == p2pmsg::P2PMsgContent_NplMsg)
         {
@@ -249,7 +285,7 @@ namespace p2p
 
                 // If max number of state responses reached skip the rest.
                 if (ctx.collected_msgs.contract_hpfs_responses.size() < p2p::HPFS_RES_LIST_CAP)
-                    ctx.collected_msgs.contract_hpfs_responses.push_back(std::make_pair(uniqueid, std::string(msg)));
+                    ctx.collected_msgs.contract_hpfs_responses.push_back(std::make_pair(uniqueid, std::move(msg.data)));
                 else
                     LOG_DEBUG << "Contract hpfs response rejected. Maximum response count reached. " << display_name();
             }
@@ -260,7 +296,7 @@ namespace p2p
 
                 // If max number of state responses reached skip the rest.
                 if (ctx.collected_msgs.ledger_hpfs_responses.size() < p2p::HPFS_RES_LIST_CAP)
-                    ctx.collected_msgs.ledger_hpfs_responses.push_back(std::make_pair(uniqueid, std::string(msg)));
+                    ctx.collected_msgs.ledger_hpfs_responses.push_back(std::make_pair(uniqueid, std::move(msg.data)));
                 else
                     LOG_DEBUG << "Ledger hpfs response rejected. Maximum response count reached. " << display_name();
             }
@@ -307,6 +343,20 @@ namespace p2p
         return 0;
     }
 
+    /**
+     * Forgets the duplicate check hash of a message which could not be queued. Otherwise the same message arriving
+     * from other peers would be dropped as a duplicate although it was never processed.
+     */
+    void peer_comm_session::handle_enqueue_failure(const comm::inbound_message &msg)
+    {
+        if (msg.data.size() <= conf::MAX_SIZE_FOR_DUP_CHECK)
+        {
+            const std::string hash = crypto::get_hash(msg.data);
+            std::scoped_lock<std::mutex> lock(recent_peermsg_hashes_mutex);
+            recent_peermsg_hashes.erase(hash);
+        }
+    }
+
     void peer_comm_session::handle_close()
     {
         {
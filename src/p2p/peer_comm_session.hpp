@@ -4,6 +4,7 @@
 #include "../pchheader.hpp"
 #include "../conf.hpp"
 #include "../comm/comm_session.hpp"
+#include "../msg/fbuf/p2pmsg_generated.h"
 
 namespace p2p
 {
@@ -16,8 +17,9 @@ namespace p2p
 
     private:
         int handle_connect();
-        int get_message_priority(std::string_view msg);
-        int handle_message(std::string_view msg);
+        comm::MSG_CLASS classify_message(std::string_view data, comm::inbound_message &msg);
+        int handle_message(comm::inbound_message &msg);
+        void handle_enqueue_failure(const comm::inbound_message &msg);
         void handle_close();
         void handle_on_verified();
 
@@ -27,6 +29,7 @@ namespace p2p
         bool is_unl = false;                            // Whether this session's pubkey is in unl list.
         uint32_t reported_time_config = 0;              // Initial time config reported by this peer on peer challenge.
         bool is_full_history;                           // Stores whether the connection is to a full history node or not.
+        msg::fbuf::p2pmsg::CompressionType accepted_compression = msg::fbuf::p2pmsg::CompressionType_None; // Compression this peer accepts for bulk messages.
     };
 
 } // namespace p2p
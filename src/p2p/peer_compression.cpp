@@ -0,0 +1,145 @@
+#include "../pchheader.hpp"
+#include "../conf.hpp"
+#include "../hplog.hpp"
+#include "../metrics.hpp"
+#include "../msg/fbuf/p2pmsg_conversion.hpp"
+#include "../msg/fbuf/common_helpers.hpp"
+#include "peer_compression.hpp"
+#include <zlib.h>
+
+namespace p2pmsg = msg::fbuf::p2pmsg;
+
+namespace p2p
+{
+    constexpr int DEFLATE_LEVEL = 1;                             // Fastest deflate level. Higher levels gain little on hpfs blocks.
+    constexpr uint64_t MAX_DECOMPRESSED_SIZE = 64 * 1024 * 1024; // Decompressed size limit when peer message size is unlimited.
+
+    struct compression_metrics
+    {
+        metrics::counter &compressed_msgs = metrics::get_counter("hp_peer_compressed_msgs_total", "Bulk peer messages sent compressed.");
+        metrics::counter &skipped_msgs = metrics::get_counter("hp_peer_compress_skipped_total", "Bulk peer messages sent uncompressed as they did not compress well.");
+        metrics::counter &compress_in_bytes = metrics::get_counter("hp_peer_compress_in_bytes_total", "Original bytes of peer messages sent compressed.");
+        metrics::counter &compress_out_bytes = metrics::get_counter("hp_peer_compress_out_bytes_total", "Compressed bytes of peer messages sent compressed.");
+        metrics::counter &compress_cpu_us = metrics::get_counter("hp_peer_compress_cpu_us_total", "Microseconds spent compressing peer messages.");
+        metrics::counter &decompress_in_bytes = metrics::get_counter("hp_peer_decompress_in_bytes_total", "Compressed bytes of received peer messages.");
+        metrics::counter &decompress_out_bytes = metrics::get_counter("hp_peer_decompress_out_bytes_total", "Decompressed bytes of received peer messages.");
+        metrics::counter &decompress_cpu_us = metrics::get_counter("hp_peer_decompress_cpu_us_total", "Microseconds spent decompressing peer messages.");
+    };
+
+    compression_metrics &get_metrics()
+    {
+        static compression_metrics m;
+        return m;
+    }
+
+    uint64_t elapsed_microseconds(const std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * Registers the compression metrics along with the overall compression ratio.
+     */
+    void init_compression_metrics()
+    {
+        get_metrics();
+        metrics::register_gauge_callback("hp_peer_compress_ratio_pct", "Compressed size of sent peer messages as a percentage of their original size.", []() {
+            const compression_metrics &m = get_metrics();
+            const uint64_t in_bytes = m.compress_in_bytes.get();
+            return in_bytes == 0 ? (int64_t)0 : (int64_t)(m.compress_out_bytes.get() * 100 / in_bytes);
+        });
+    }
+
+    /**
+     * Whether the given message type carries bulk payloads worth compressing.
+     */
+    bool is_compressible_type(const p2pmsg::P2PMsgContent type)
+    {
+        return type == p2pmsg::P2PMsgContent_HpfsResponseMsg ||
+               type == p2pmsg::P2PMsgContent_HpfsLogResponse ||
+               type == p2pmsg::P2PMsgContent_NonUnlProposalMsg ||
+               type == p2pmsg::P2PMsgContent_NplMsg;
+    }
+
+    outbound_message::outbound_message(std::string_view message) : message(message)
+    {
+        const uint32_t threshold = conf::cfg.mesh.compression_threshold;
+        if (threshold == 0 || message.size() < threshold || message.size() > UINT32_MAX ||
+            !is_compressible_type(p2pmsg::GetP2PMsg(message.data())->content_type()))
+            return;
+
+        compression_metrics &m = get_metrics();
+        const auto start = std::chrono::steady_clock::now();
+
+        std::string deflated;
+        uLongf deflated_len = compressBound(message.size());
+        deflated.resize(deflated_len);
+        if (compress2(reinterpret_cast<Bytef *>(deflated.data()), &deflated_len,
+                      reinterpret_cast<const Bytef *>(message.data()), message.size(), DEFLATE_LEVEL) != Z_OK)
+        {
+            LOG_WARNING << "Peer message compression failed.";
+            return;
+        }
+
+        // Already compressed or encrypted payloads are sent as they are unless we save at least 1/8 of the size.
+        if (deflated_len > message.size() - (message.size() / 8))
+        {
+            m.skipped_msgs.inc();
+            m.compress_cpu_us.inc(elapsed_microseconds(start));
+            return;
+        }
+
+        flatbuffers::FlatBufferBuilder fbuf(deflated_len + 128);
+        p2pmsg::create_compressed_msg(fbuf, p2pmsg::CompressionType_Deflate, message.size(), std::string_view(deflated.data(), deflated_len));
+        compressed = msg::fbuf::builder_to_string_view(fbuf);
+
+        m.compressed_msgs.inc();
+        m.compress_in_bytes.inc(message.size());
+        m.compress_out_bytes.inc(compressed.size());
+        m.compress_cpu_us.inc(elapsed_microseconds(start));
+    }
+
+    outbound_message::outbound_message(const flatbuffers::FlatBufferBuilder &fbuf)
+        : outbound_message(msg::fbuf::builder_to_string_view(fbuf))
+    {
+    }
+
+    /**
+     * Returns the bytes to be sent to the given session.
+     */
+    std::string_view outbound_message::for_session(const peer_comm_session &session) const
+    {
+        return (!compressed.empty() && session.accepted_compression == p2pmsg::CompressionType_Deflate) ? compressed : message;
+    }
+
+    /**
+     * Restores the original peer message from a received compressed message.
+     * @param message Buffer to populate with the original message.
+     * @param compressed_msg Received compressed message.
+     * @return 0 on success. -1 if the message is unsupported, corrupted or exceeds the peer message size limit.
+     */
+    int decompress_message(std::string &message, const p2pmsg::CompressedMsg &compressed_msg)
+    {
+        const uint32_t size = compressed_msg.uncompressed_size();
+        const uint64_t max_size = conf::cfg.mesh.max_bytes_per_msg > 0 ? conf::cfg.mesh.max_bytes_per_msg : MAX_DECOMPRESSED_SIZE;
+        if (compressed_msg.compression() != p2pmsg::CompressionType_Deflate || !compressed_msg.data() || size == 0 || size > max_size)
+            return -1;
+
+        compression_metrics &m = get_metrics();
+        const auto start = std::chrono::steady_clock::now();
+
+        // The output buffer is exactly the announced size. So a message inflating beyond it is rejected.
+        message.resize(size);
+        uLongf inflated_len = size;
+        if (uncompress(reinterpret_cast<Bytef *>(message.data()), &inflated_len,
+                       compressed_msg.data()->data(), compressed_msg.data()->size()) != Z_OK ||
+            inflated_len != size)
+            return -1;
+
+        m.decompress_in_bytes.inc(compressed_msg.data()->size());
+        m.decompress_out_bytes.inc(size);
+        m.decompress_cpu_us.inc(elapsed_microseconds(start));
+        return 0;
+    }
+
+} // namespace p2p
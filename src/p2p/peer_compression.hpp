@@ -0,0 +1,38 @@
+#ifndef _HP_P2P_PEER_COMPRESSION_
+#define _HP_P2P_PEER_COMPRESSION_
+
+#include "../pchheader.hpp"
+#include "../msg/fbuf/p2pmsg_generated.h"
+#include "peer_comm_session.hpp"
+
+/**
+ * Compression of bulk peer messages (hpfs responses, non-unl proposals, npl messages). Each node announces the
+ * compression it accepts in its peer challenge. Latency sensitive messages such as proposals are never compressed.
+ */
+namespace p2p
+{
+    /**
+     * A peer message about to be sent to one or more peer sessions. Bulk messages above the configured compression
+     * threshold are compressed once on construction, so construct this before locking the peer connections.
+     */
+    class outbound_message
+    {
+    private:
+        const std::string_view message;
+        std::string compressed; // Compressed wire message. Empty if the message is not worth compressing.
+
+    public:
+        outbound_message(std::string_view message);
+        outbound_message(const flatbuffers::FlatBufferBuilder &fbuf);
+        std::string_view for_session(const peer_comm_session &session) const;
+    };
+
+    void init_compression_metrics();
+
+    bool is_compressible_type(const msg::fbuf::p2pmsg::P2PMsgContent type);
+
+    int decompress_message(std::string &message, const msg::fbuf::p2pmsg::CompressedMsg &compressed_msg);
+
+} // namespace p2p
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef _HP_P2P_PROPOSAL_SET_
+#define _HP_P2P_PROPOSAL_SET_
+
+#include "../pchheader.hpp"
+#include "../util/fixed_bytes.hpp"
+#include "../util/flat_set.hpp"
+#include "../msg/fbuf/p2pmsg_generated.h"
+
+namespace p2p
+{
+    /**
+     * Sorted unique list of fixed size values carried in a proposal (users, input hashes).
+     * A received proposal keeps its message buffer and the values are read in place from the flatbuffer byte arrays,
+     * which verify_proposal_msg_structure() has checked to be exactly N bytes each and in ascending order.
+     * A proposal built by this node holds its values in an owned flat_set.
+     */
+    template <size_t N>
+    class proposal_set
+    {
+    private:
+        typedef flatbuffers::Vector<flatbuffers::Offset<msg::fbuf::p2pmsg::ByteArray>> wire_vector;
+
+        util::flat_set<util::fixed_bytes<N>> owned;
+        std::shared_ptr<const std::string> buffer; // Received message buffer which the wire vector points into.
+        const wire_vector *wire = NULL;            // Values of a received proposal. NULL if the values are owned.
+
+        /**
+         * Copies the values of a received proposal into the owned set so they can be modified.
+         */
+        void detach()
+        {
+            if (!wire)
+                return;
+
+            util::flat_set<util::fixed_bytes<N>> values;
+            values.reserve(size());
+            for (const util::fixed_bytes<N> &value : *this)
+                values.emplace(value);
+            owned.swap(values);
+            wire = NULL;
+            buffer.reset();
+        }
+
+    public:
+        class const_iterator
+        {
+        private:
+            const proposal_set *set = NULL;
+            size_t index = 0;
+
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef util::fixed_bytes<N> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const util::fixed_bytes<N> *pointer;
+            typedef const util::fixed_bytes<N> &reference;
+
+            const_iterator(const proposal_set *set, const size_t index) : set(set), index(index)
+            {
+            }
+
+            reference operator*() const
+            {
+                return (*set)[index];
+            }
+
+            pointer operator->() const
+            {
+                return &(*set)[index];
+            }
+
+            const_iterator &operator++()
+            {
+                index++;
+                return *this;
+            }
+
+            bool operator==(const const_iterator &other) const
+            {
+                return index == other.index;
+            }
+
+            bool operator!=(const const_iterator &other) const
+            {
+                return index != other.index;
+            }
+        };
+
+        proposal_set() = default;
+
+        /**
+         * Creates a view over the byte arrays of a received proposal.
+         * @param buffer The received message buffer. Kept alive for as long as the view exists.
+         * @param wire Byte array vector within the buffer.
+         */
+        proposal_set(std::shared_ptr<const std::string> buffer, const wire_vector *wire) : buffer(std::move(buffer)), wire(wire)
+        {
+        }
+
+        const util::fixed_bytes<N> &operator[](const size_t index) const
+        {
+            // fixed_bytes is a plain byte array, so it can be read directly from the wire bytes.
+            return wire ? *reinterpret_cast<const util::fixed_bytes<N> *>(wire->Get(index)->array()->data())
+                        : *(owned.begin() + index);
+        }
+
+        const_iterator begin() const
+        {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(this, size());
+        }
+
+        size_t size() const
+        {
+            return wire ? wire->size() : owned.size();
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        bool emplace(const util::fixed_bytes<N> &value)
+        {
+            detach();
+            return owned.emplace(value);
+        }
+
+        /**
+         * Exchanges the values with the given set. Used to hand over a set built elsewhere without copying.
+         */
+        void swap(util::flat_set<util::fixed_bytes<N>> &other)
+        {
+            detach();
+            owned.swap(other);
+        }
+    };
+
+} // namespace p2p
+
+#endif
@@ -33,7 +33,10 @@ namespace p2p::self
 
             if (mi.type == p2pmsg::P2PMsgContent_ProposalMsg)
             {
-                handle_proposal_message(p2pmsg::create_proposal_from_msg(mi, hash_proposal_msg(*mi.p2p_msg->content_as_ProposalMsg())));
+                const util::h32 hash = hash_proposal_msg(*mi.p2p_msg->content_as_ProposalMsg());
+                std::shared_ptr<const std::string> buffer = std::make_shared<const std::string>(std::move(msg));
+                const peer_message_info buffer_mi{p2pmsg::GetP2PMsg(buffer->data()), mi.type, mi.originated_on};
+                handle_proposal_message(p2pmsg::create_proposal_from_msg(buffer_mi, hash, std::move(buffer)));
             }
             else if (mi.type == p2pmsg::P2PMsgContent_NonUnlProposalMsg)
             {
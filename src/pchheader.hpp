@@ -8,12 +8,14 @@
 #include <blake3.h>
 #include <boost/stacktrace.hpp>
 #include <chrono>
+#include <condition_variable>
 #include <concurrentqueue.h>
 #include <cstdio>
 #include <dirent.h>
 #include <fcntl.h>
 #include <flatbuffers/flatbuffers.h>
 #include <ftw.h>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <jsoncons/json.hpp>
@@ -22,6 +24,7 @@
 #include <list>
 #include <math.h>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <plog/Log.h>
 #include <plog/Appenders/ColorConsoleAppender.h>
@@ -52,4 +55,25 @@
 #include <variant>
 #include <vector>
 
+// Debug and verbose log statements are compiled out entirely (including their argument expressions)
+// when building with HP_STRIP_DEBUG_LOGS.
+#ifdef HP_STRIP_DEBUG_LOGS
+#undef LOG_DEBUG
+#undef LOG_VERBOSE
+#define LOG_DEBUG \
+    if (true)     \
+    {             \
+        ;         \
+    }             \
+    else          \
+        PLOG_DEBUG
+#define LOG_VERBOSE \
+    if (true)       \
+    {               \
+        ;           \
+    }               \
+    else            \
+        PLOG_VERBOSE
+#endif
+
 #endif
\ No newline at end of file
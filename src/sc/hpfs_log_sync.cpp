@@ -4,7 +4,9 @@
 #include "../crypto.hpp"
 #include "../ledger/ledger.hpp"
 #include "../msg/fbuf/p2pmsg_conversion.hpp"
+#include "../p2p/peer_compression.hpp"
 #include "../ledger/sqlite.hpp"
+#include "../thread_placement.hpp"
 
 namespace p2pmsg = msg::fbuf::p2pmsg;
 
@@ -77,6 +79,7 @@ namespace sc::hpfs_log_sync
     void hpfs_log_syncer_loop()
     {
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::SYNC, "hp-hpfslog-sync");
 
         LOG_INFO << "Hpfs log sync: Worker started.";
 
@@ -204,7 +207,7 @@ namespace sc::hpfs_log_sync
             resp.min_record_id = lr.min_record_id;
             flatbuffers::FlatBufferBuilder fbuf(1024);
             p2pmsg::create_msg_from_hpfs_log_response(fbuf, resp);
-            std::string_view msg = std::string_view(reinterpret_cast<const char *>(fbuf.GetBufferPointer()), fbuf.GetSize());
+            const p2p::outbound_message msg(fbuf);
 
             // Find the peer that we should send the history response to.
             std::scoped_lock<std::mutex> lock(p2p::ctx.peer_connections_mutex);
@@ -212,8 +215,8 @@ namespace sc::hpfs_log_sync
 
             if (peer_itr != p2p::ctx.peer_connections.end())
             {
-                comm::comm_session *session = peer_itr->second;
-                session->send(msg);
+                p2p::peer_comm_session *session = peer_itr->second;
+                session->send(msg.for_session(*session));
             }
         }
 
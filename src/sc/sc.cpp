@@ -9,6 +9,7 @@
 #include "../unl.hpp"
 #include "../util/version.hpp"
 #include "../p2p/p2p.hpp"
+#include "../thread_placement.hpp"
 #include "contract_serve.hpp"
 #include "sc.hpp"
 #include "hpfs_log_sync.hpp"
@@ -153,6 +154,9 @@ namespace sc
             // Contract process.
             util::fork_detach();
 
+            // Move off the cores of the forking (consensus or read request) thread onto the contract cpus.
+            thread_placement::apply_to_process(thread_placement::THREAD_CLASS::CONTRACT);
+
             // Set up the process environment and overlay the contract binary program with execv().
 
             if (insert_demarkation_line(ctx) == -1)
@@ -395,7 +399,7 @@ namespace sc
 
         user_json_to_stream(ctx.user_fds, ctx.args.userbufs, os);
 
-        os << "},\"unl\":" << unl::get_json() << "}";
+        os << "},\"unl\":" << unl::get_snapshot()->get_json() << "}";
 
         // Get the final json string that should be written to contract input pipe.
         const std::string json = os.str();
@@ -432,6 +436,7 @@ namespace sc
     void contract_monitor_loop(execution_context &ctx)
     {
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::CONTRACT, "hp-sc-monitor");
 
         // We record the start time of the monitoring thread to track the contract execution timeout.
         const uint64_t start_time = util::get_epoch_milliseconds();
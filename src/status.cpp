@@ -3,23 +3,34 @@
 #include "ledger/ledger_common.hpp"
 #include "conf.hpp"
 #include "p2p/p2p.hpp"
+#include "metrics.hpp"
 
 namespace status
 {
     moodycamel::ConcurrentQueue<change_event> event_queue;
 
-    std::shared_mutex ledger_mutex;
-    util::sequence_hash lcl_id;        // Last ledger id/hash pair.
-    ledger::ledger_record last_ledger; // Last ledger record that the node created.
+    /**
+     * Last ledger information. Published as a whole so readers always see a matching id and record.
+     */
+    struct ledger_status
+    {
+        util::sequence_hash lcl_id;        // Last ledger id/hash pair.
+        ledger::ledger_record last_ledger; // Last ledger record that the node created.
+    };
+
+    // Status snapshots are immutable once published and are replaced with std::atomic_store, so readers never lock.
+    // The mutexes only serialize the writers.
+    std::mutex ledger_mutex;
+    std::shared_ptr<const ledger_status> ledger_snapshot = std::make_shared<const ledger_status>();
 
     // Indicates the current voting status.
     std::atomic<VOTE_STATUS> vote_status = VOTE_STATUS::UNKNOWN;
 
-    std::shared_mutex unl_mutex;
-    std::set<std::string> unl; // List of last reported unl binary pubkeys.
+    std::mutex unl_mutex;
+    std::shared_ptr<const std::set<std::string>> unl = std::make_shared<const std::set<std::string>>(); // List of last reported unl binary pubkeys.
 
-    std::shared_mutex peers_mutex;
-    std::set<conf::peer_ip_port> peers; // Known ip:port pairs for connection verified peers.
+    std::mutex peers_mutex;
+    std::shared_ptr<const std::set<conf::peer_ip_port>> peers = std::make_shared<const std::set<conf::peer_ip_port>>(); // Known ip:port pairs for connection verified peers.
     std::atomic<size_t> peer_count = 0;
     std::atomic<bool> weakly_connected = false;
     std::atomic<int16_t> available_mesh_capacity = -1;
@@ -30,16 +41,13 @@ namespace status
 
     void init_ledger(const util::sequence_hash &ledger_id, const ledger::ledger_record &ledger)
     {
-        // Not acquiring the mutex lock since this is called during startup only.
-        lcl_id = ledger_id;
-        last_ledger = ledger;
+        std::atomic_store(&ledger_snapshot, std::make_shared<const ledger_status>(ledger_status{ledger_id, ledger}));
     }
 
     void ledger_created(const util::sequence_hash &ledger_id, const ledger::ledger_record &ledger)
     {
-        std::unique_lock lock(ledger_mutex);
-        lcl_id = ledger_id;
-        last_ledger = ledger;
+        std::scoped_lock<std::mutex> lock(ledger_mutex);
+        std::atomic_store(&ledger_snapshot, std::make_shared<const ledger_status>(ledger_status{ledger_id, ledger}));
         event_queue.try_enqueue(ledger_created_event{ledger});
     }
 
@@ -54,8 +62,7 @@ namespace status
 
     const util::sequence_hash get_lcl_id()
     {
-        std::shared_lock lock(ledger_mutex);
-        return lcl_id;
+        return std::atomic_load(&ledger_snapshot)->lcl_id;
     }
 
     VOTE_STATUS get_vote_status()
@@ -65,52 +72,54 @@ namespace status
 
     const ledger::ledger_record get_last_ledger()
     {
-        std::shared_lock lock(ledger_mutex);
-        return last_ledger;
+        return std::atomic_load(&ledger_snapshot)->last_ledger;
     }
 
     //----- UNL status
 
     void init_unl(const std::set<std::string> &init_unl)
     {
-        // Not acquiring the mutex lock since this is called during startup only.
-        unl = init_unl;
+        std::atomic_store(&unl, std::make_shared<const std::set<std::string>>(init_unl));
     }
 
     void unl_changed(const std::set<std::string> &new_unl)
     {
-        std::unique_lock lock(unl_mutex);
-        unl = new_unl;
+        std::scoped_lock<std::mutex> lock(unl_mutex);
+        std::atomic_store(&unl, std::make_shared<const std::set<std::string>>(new_unl));
 
-        event_queue.try_enqueue(unl_change_event{unl});
+        event_queue.try_enqueue(unl_change_event{new_unl});
     }
 
-    const std::set<std::string> get_unl()
+    /**
+     * Returns the last reported unl. The returned set is never modified.
+     */
+    std::shared_ptr<const std::set<std::string>> get_unl()
     {
-        std::shared_lock lock(unl_mutex);
-        return unl;
+        return std::atomic_load(&unl);
     }
 
     //----- Peers status
 
     void set_peers(const std::set<conf::peer_ip_port> &updated_peers)
     {
-        std::unique_lock lock(peers_mutex);
-        peers = std::move(updated_peers);
+        std::scoped_lock<std::mutex> lock(peers_mutex);
+        std::atomic_store(&peers, std::make_shared<const std::set<conf::peer_ip_port>>(updated_peers));
 
-        if (peers.size() != peer_count)
+        if (updated_peers.size() != peer_count)
         {
-            peer_count = peers.size();
+            peer_count = updated_peers.size();
 
             if (conf::cfg.health.connectivity_stats)
                 event_queue.try_enqueue(connectivity_health{peer_count.load(), weakly_connected.load()});
         }
     }
 
-    const std::set<conf::peer_ip_port> get_peers()
+    /**
+     * Returns the known peers. The returned set is never modified.
+     */
+    std::shared_ptr<const std::set<conf::peer_ip_port>> get_peers()
     {
-        std::unique_lock lock(peers_mutex);
-        return peers;
+        return std::atomic_load(&peers);
     }
 
     size_t get_peers_count()
@@ -148,6 +157,10 @@ namespace status
 
     void report_proposal_batch(const std::list<p2p::proposal> &proposals)
     {
+        static metrics::histogram &comm_latency = metrics::get_histogram("hp_proposal_comm_latency_ms", "Time taken for peer proposals to arrive.");
+        for (const p2p::proposal &p : proposals)
+            comm_latency.record((p.sent_timestamp < p.recv_timestamp) ? (p.recv_timestamp - p.sent_timestamp) : 0);
+
         if (!conf::cfg.health.proposal_stats)
             return;
 
@@ -65,10 +65,10 @@ namespace status
 
     void init_unl(const std::set<std::string> &init_unl);
     void unl_changed(const std::set<std::string> &new_unl);
-    const std::set<std::string> get_unl();
+    std::shared_ptr<const std::set<std::string>> get_unl();
 
     void set_peers(const std::set<conf::peer_ip_port> &updated_peers);
-    const std::set<conf::peer_ip_port> get_peers();
+    std::shared_ptr<const std::set<conf::peer_ip_port>> get_peers();
     size_t get_peers_count();
     void set_weakly_connected(const bool is_weakly_connected);
     bool get_weakly_connected();
@@ -0,0 +1,197 @@
+#include "pchheader.hpp"
+#include "thread_placement.hpp"
+#include "conf.hpp"
+#include "hplog.hpp"
+#include "util/util.hpp"
+#include <sys/syscall.h>
+
+namespace thread_placement
+{
+    constexpr size_t MAX_THREAD_NAME_LEN = 15; // Linux thread name limit excluding the null terminator.
+
+    constexpr const char *THREAD_CLASS_NAMES[THREAD_CLASS_COUNT] = {"consensus", "network", "sync", "contract", "general"};
+
+    /**
+     * A thread which started before the placement config was loaded. Pinned once init() runs.
+     */
+    struct pending_thread
+    {
+        pid_t tid;
+        THREAD_CLASS thread_class;
+    };
+
+    cpu_set_t process_cpus;                   // Cpus the process was allowed to run on at startup.
+    cpu_set_t class_cpus[THREAD_CLASS_COUNT]; // Effective cpu set of each thread class.
+    bool class_pinned[THREAD_CLASS_COUNT] = {};
+
+    std::vector<pending_thread> pending_threads;
+    std::mutex placement_mutex;               // Guards pending_threads and the transition to initialized state.
+    std::atomic<bool> is_initialized = false; // Class cpu sets are read-only once this is set.
+
+    /**
+     * Returns the physical socket (package) id of the given cpu. -1 if it cannot be determined.
+     */
+    int get_cpu_socket(const uint32_t cpu)
+    {
+        const std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/physical_package_id";
+        const int fd = open(path.data(), O_RDONLY);
+        if (fd == -1)
+            return -1;
+
+        char buf[16] = {};
+        const ssize_t res = read(fd, buf, sizeof(buf) - 1);
+        close(fd);
+        return res > 0 ? atoi(buf) : -1;
+    }
+
+    /**
+     * Formats the given cpu set as a cpu list (eg. "0-3,8").
+     */
+    const std::string format_cpu_list(const cpu_set_t &cpus)
+    {
+        std::string list;
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (!CPU_ISSET(cpu, &cpus))
+                continue;
+
+            int last = cpu;
+            while (last + 1 < CPU_SETSIZE && CPU_ISSET(last + 1, &cpus))
+                last++;
+
+            if (!list.empty())
+                list.append(",");
+            list.append(std::to_string(cpu));
+            if (last > cpu)
+                list.append("-").append(std::to_string(last));
+            cpu = last;
+        }
+        return list;
+    }
+
+    /**
+     * Logs the effective placement of each thread class along with the sockets it spans.
+     */
+    void report_placement()
+    {
+        for (size_t i = 0; i < THREAD_CLASS_COUNT; i++)
+        {
+            std::set<int> sockets;
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                if (CPU_ISSET(cpu, &class_cpus[i]))
+                    sockets.emplace(get_cpu_socket(cpu));
+            }
+
+            std::string socket_list;
+            for (const int socket : sockets)
+                socket_list.append(socket_list.empty() ? "" : ",").append(socket == -1 ? "?" : std::to_string(socket));
+
+            LOG_INFO << "Thread placement: " << THREAD_CLASS_NAMES[i] << " cpus " << format_cpu_list(class_cpus[i])
+                     << (class_pinned[i] ? "" : " (unpinned)") << " socket " << socket_list;
+
+            if (class_pinned[i] && sockets.size() > 1)
+                LOG_WARNING << "Thread placement: " << THREAD_CLASS_NAMES[i] << " cpus span multiple sockets.";
+        }
+
+        // Contract processes are cpu hungry. Consensus and network threads sharing their cores miss stage windows.
+        for (const THREAD_CLASS thread_class : {THREAD_CLASS::CONSENSUS, THREAD_CLASS::NETWORK})
+        {
+            cpu_set_t overlap;
+            CPU_AND(&overlap, &class_cpus[thread_class], &class_cpus[THREAD_CLASS::CONTRACT]);
+            if (CPU_COUNT(&overlap) > 0 && (class_pinned[thread_class] || class_pinned[THREAD_CLASS::CONTRACT]))
+                LOG_WARNING << "Thread placement: " << THREAD_CLASS_NAMES[thread_class] << " cpus overlap contract cpus "
+                            << format_cpu_list(overlap);
+        }
+    }
+
+    /**
+     * Resolves the configured cpu set of each thread class, pins threads which started before the config
+     * was available and reports the placement.
+     * @return 0 on success. -1 if a configured cpu is not available to the process.
+     */
+    int init()
+    {
+        if (sched_getaffinity(0, sizeof(cpu_set_t), &process_cpus) == -1)
+        {
+            LOG_ERROR << errno << ": Error getting process cpu affinity.";
+            return -1;
+        }
+
+        const std::string *cpu_lists[THREAD_CLASS_COUNT] = {&conf::cfg.threads.consensus_cpus, &conf::cfg.threads.network_cpus,
+                                                            &conf::cfg.threads.sync_cpus, &conf::cfg.threads.contract_cpus,
+                                                            &conf::cfg.threads.general_cpus};
+
+        for (size_t i = 0; i < THREAD_CLASS_COUNT; i++)
+        {
+            std::set<uint32_t> cpus;
+            util::parse_cpu_list(cpus, *cpu_lists[i]); // Already validated by conf.
+
+            class_pinned[i] = !cpus.empty();
+            if (!class_pinned[i])
+            {
+                class_cpus[i] = process_cpus;
+                continue;
+            }
+
+            CPU_ZERO(&class_cpus[i]);
+            for (const uint32_t cpu : cpus)
+            {
+                if (!CPU_ISSET(cpu, &process_cpus))
+                {
+                    LOG_ERROR << "Thread placement: " << THREAD_CLASS_NAMES[i] << " cpu " << cpu << " is not available to the process.";
+                    return -1;
+                }
+                CPU_SET(cpu, &class_cpus[i]);
+            }
+        }
+
+        {
+            std::scoped_lock<std::mutex> lock(placement_mutex);
+            is_initialized = true;
+
+            // Threads which have exited since starting simply fail with ESRCH.
+            for (const pending_thread &t : pending_threads)
+                sched_setaffinity(t.tid, sizeof(cpu_set_t), &class_cpus[t.thread_class]);
+            pending_threads.clear();
+        }
+
+        report_placement();
+        return 0;
+    }
+
+    /**
+     * Names the calling thread and pins it to the cpu set of its class. Must be called at the start of every
+     * long-lived thread. Threads starting before init() are named immediately and pinned during init().
+     * @param thread_class Placement class of the thread.
+     * @param name Thread name shown in ps/top/gdb. Truncated to 15 characters.
+     */
+    void apply(const THREAD_CLASS thread_class, std::string_view name)
+    {
+        char thread_name[MAX_THREAD_NAME_LEN + 1] = {};
+        name.copy(thread_name, MAX_THREAD_NAME_LEN);
+        prctl(PR_SET_NAME, thread_name);
+
+        std::scoped_lock<std::mutex> lock(placement_mutex);
+        if (!is_initialized)
+        {
+            pending_threads.push_back(pending_thread{(pid_t)syscall(SYS_gettid), thread_class});
+            return;
+        }
+
+        // Threads inherit the affinity of their creator. So unpinned classes are reset to the process cpus as well.
+        if (sched_setaffinity(0, sizeof(cpu_set_t), &class_cpus[thread_class]) == -1)
+            LOG_WARNING << errno << ": Error setting cpu affinity of thread " << name;
+    }
+
+    /**
+     * Pins the calling process to the cpu set of the given class. Meant for forked child processes, so this
+     * does not lock or allocate.
+     */
+    void apply_to_process(const THREAD_CLASS thread_class)
+    {
+        if (is_initialized)
+            sched_setaffinity(0, sizeof(cpu_set_t), &class_cpus[thread_class]);
+    }
+
+} // namespace thread_placement
@@ -0,0 +1,32 @@
+#ifndef _HP_THREAD_PLACEMENT_
+#define _HP_THREAD_PLACEMENT_
+
+#include "pchheader.hpp"
+
+/**
+ * Names long-lived HotPocket threads and pins each class of threads to its configured cpu set.
+ * Keeping latency sensitive threads (consensus, network) off the contract execution cores and within one
+ * socket reduces scheduler noise during consensus stage windows.
+ */
+namespace thread_placement
+{
+    enum THREAD_CLASS
+    {
+        CONSENSUS,
+        NETWORK,
+        SYNC,
+        CONTRACT,
+        GENERAL
+    };
+
+    constexpr size_t THREAD_CLASS_COUNT = 5;
+
+    int init();
+
+    void apply(const THREAD_CLASS thread_class, std::string_view name);
+
+    void apply_to_process(const THREAD_CLASS thread_class);
+
+} // namespace thread_placement
+
+#endif
@@ -10,15 +10,45 @@
  */
 namespace unl
 {
-    struct node_stat
+    // Currently published UNL snapshot. Always accessed with std::atomic_load/atomic_store.
+    std::shared_ptr<const unl_snapshot> current_snapshot = std::make_shared<const unl_snapshot>();
+
+    // Serializes the writers. Each writer copies the current snapshot, modifies the copy and publishes it.
+    std::mutex write_mutex;
+
+    /**
+     * Returns the stringified json object of this UNL version. Built on first access.
+     */
+    const std::string &unl_snapshot::get_json() const
     {
-        uint32_t time_config = 0; // Roundtime config of this node.
-        uint64_t active_on = 0;   // Latest timestamp we received a proposal from this node.
-    };
+        std::call_once(json_flag, [&]() {
+            std::ostringstream os;
+            os << "{";
+            for (auto node = list.begin(); node != list.end(); node++)
+            {
+                if (node != list.begin())
+                    os << ","; // Trailing comma separator for previous element.
+
+                // Convert binary pubkey into hex.
+                os << "\"" << util::to_hex(node->first) << "\":{"
+                   << "\"active_on\":" << node->second.active_on
+                   << "}";
+            }
+            os << "}";
+            json = os.str();
+        });
 
-    std::map<std::string, node_stat> list; // List of binary pubkeys of UNL nodes and their statistics.
-    std::string json_list;                 // Stringified json array of UNL. (To be fed into the contract args)
-    std::shared_mutex unl_mutex;
+        return json;
+    }
+
+    /**
+     * Publishes the given snapshot as the next UNL version. Must be called while holding the write mutex.
+     */
+    void publish(std::shared_ptr<unl_snapshot> snapshot)
+    {
+        snapshot->version = get_snapshot()->version + 1;
+        std::atomic_store(&current_snapshot, std::shared_ptr<const unl_snapshot>(std::move(snapshot)));
+    }
 
     /**
      * Performs startup activitites related to unl list.
@@ -29,32 +59,40 @@ namespace unl
         if (conf::cfg.contract.unl.empty())
             return -1;
 
-        std::unique_lock lock(unl_mutex);
-        merge_latest_unl_config();
+        std::scoped_lock<std::mutex> lock(write_mutex);
+        std::shared_ptr<unl_snapshot> snapshot = std::make_shared<unl_snapshot>();
+        merge_latest_unl_config(*snapshot);
+        publish(std::move(snapshot));
         status::init_unl(conf::cfg.contract.unl);
 
         return 0;
     }
 
+    /**
+     * Returns the current UNL snapshot. The snapshot stays valid and unchanged for as long as the caller holds it.
+     */
+    std::shared_ptr<const unl_snapshot> get_snapshot()
+    {
+        return std::atomic_load(&current_snapshot);
+    }
+
     size_t count()
     {
-        std::shared_lock lock(unl_mutex);
-        return list.size();
+        return get_snapshot()->list.size();
     }
 
     const std::set<std::string> get()
     {
-        std::shared_lock lock(unl_mutex);
+        const std::shared_ptr<const unl_snapshot> snapshot = get_snapshot();
         std::set<std::string> ret;
-        for (auto [pubkey, time_config] : list)
-            ret.emplace(std::move(pubkey));
+        for (const auto &[pubkey, stat] : snapshot->list)
+            ret.emplace(pubkey);
         return ret;
     }
 
     const std::string get_json()
     {
-        std::shared_lock lock(unl_mutex);
-        return json_list;
+        return get_snapshot()->get_json();
     }
 
     /**
@@ -62,10 +100,10 @@ namespace unl
      * @param bin_pubkey Pubkey to check for existence.
      * @return Return true if the given pubkey is in the unl list.
     */
-    bool exists(const std::string &bin_pubkey)
+    bool exists(std::string_view bin_pubkey)
     {
-        std::shared_lock lock(unl_mutex);
-        return list.find(bin_pubkey) != list.end();
+        const std::shared_ptr<const unl_snapshot> snapshot = get_snapshot();
+        return snapshot->list.find(bin_pubkey) != snapshot->list.end();
     }
 
     /**
@@ -75,8 +113,11 @@ namespace unl
     {
         bool is_unl_list_changed = false;
         {
-            std::unique_lock lock(unl_mutex);
-            is_unl_list_changed = merge_latest_unl_config();
+            std::scoped_lock<std::mutex> lock(write_mutex);
+            std::shared_ptr<unl_snapshot> snapshot = std::make_shared<unl_snapshot>(*get_snapshot());
+            is_unl_list_changed = merge_latest_unl_config(*snapshot);
+            if (is_unl_list_changed)
+                publish(std::move(snapshot));
         }
 
         if (is_unl_list_changed)
@@ -91,13 +132,14 @@ namespace unl
      */
     void update_unl_stats(const std::list<p2p::proposal> &proposals)
     {
-        std::unique_lock lock(unl_mutex);
+        std::scoped_lock<std::mutex> lock(write_mutex);
+        std::shared_ptr<unl_snapshot> snapshot = std::make_shared<unl_snapshot>(*get_snapshot());
         bool changes_made = false;
 
         for (const auto &p : proposals)
         {
-            const auto itr = list.find(p.pubkey);
-            if (itr != list.end())
+            const auto itr = snapshot->list.find(p.pubkey);
+            if (itr != snapshot->list.end())
             {
                 changes_made = true;
                 itr->second.active_on = p.recv_timestamp;
@@ -105,9 +147,9 @@ namespace unl
             }
         }
 
-        // Update the prepared json list which will be fed into contract args.
+        // The json fed into contract args gets rebuilt from the new version when requested.
         if (changes_made)
-            json_list = prepare_json_list();
+            publish(std::move(snapshot));
     }
 
     /**
@@ -115,7 +157,9 @@ namespace unl
      */
     uint32_t get_majority_time_config()
     {
-        std::unique_lock lock(unl_mutex);
+        std::scoped_lock<std::mutex> lock(write_mutex);
+        std::shared_ptr<unl_snapshot> snapshot = std::make_shared<unl_snapshot>(*get_snapshot());
+        bool changes_made = false;
 
         // Vote and find majority time config within the unl using values extracted from incoming proposals.
         // Fill any 0 time configs with information from peer connections.
@@ -124,14 +168,17 @@ namespace unl
         {
             std::scoped_lock<std::mutex> lock(p2p::ctx.peer_connections_mutex);
 
-            for (auto itr = list.begin(); itr != list.end(); itr++)
+            for (auto itr = snapshot->list.begin(); itr != snapshot->list.end(); itr++)
             {
                 // If time config is 0, attempt to get from peer connection (if available).
                 if (itr->second.time_config == 0)
                 {
                     const auto peer_itr = p2p::ctx.peer_connections.find(itr->first);
-                    if (peer_itr != p2p::ctx.peer_connections.end())
+                    if (peer_itr != p2p::ctx.peer_connections.end() && peer_itr->second->reported_time_config > 0)
+                    {
                         itr->second.time_config = peer_itr->second->reported_time_config;
+                        changes_made = true;
+                    }
                 }
 
                 const uint32_t time_config = itr->second.time_config;
@@ -140,6 +187,10 @@ namespace unl
             }
         }
 
+        // Keep the filled time configs for subsequent calls.
+        if (changes_made)
+            publish(std::move(snapshot));
+
         // Find the majority vote.
         uint32_t highest_votes = 0;
         uint32_t majority_time_config = 0;
@@ -156,11 +207,13 @@ namespace unl
     }
 
     /**
-     * Updates the unl list using the latest config unl.
+     * Updates the given unl snapshot using the latest config unl.
+     * @param snapshot The unpublished snapshot to update.
      * @return Whether or not any unl list changes were made.
      */
-    bool merge_latest_unl_config()
+    bool merge_latest_unl_config(unl_snapshot &snapshot)
     {
+        std::map<std::string, node_stat, std::less<>> &list = snapshot.list;
         bool changes_made = false;
 
         // Erase any pubkeys from current unl list that does not exist in new config.
@@ -190,31 +243,10 @@ namespace unl
         if (!changes_made)
             return false;
 
-        // Update the prepared json list which will be fed into contract args.
-        json_list = prepare_json_list();
-
         // Update the own node's unl status.
         conf::cfg.node.is_unl = (list.count(conf::cfg.node.public_key) == 1);
 
         return true; // Changes made.
     }
 
-    const std::string prepare_json_list()
-    {
-        std::ostringstream os;
-        os << "{";
-        for (auto node = list.begin(); node != list.end(); node++)
-        {
-            if (node != list.begin())
-                os << ","; // Trailing comma separator for previous element.
-
-            // Convert binary pubkey into hex.
-            os << "\"" << util::to_hex(node->first) << "\":{"
-               << "\"active_on\":" << node->second.active_on
-               << "}";
-        }
-        os << "}";
-        return os.str();
-    }
-
 } // namespace unl
@@ -10,17 +10,44 @@
  */
 namespace unl
 {
+    struct node_stat
+    {
+        uint32_t time_config = 0; // Roundtime config of this node.
+        uint64_t active_on = 0;   // Latest timestamp we received a proposal from this node.
+    };
 
+    /**
+     * Immutable version of the UNL. A new snapshot is published whenever the UNL or its stats change,
+     * so readers never need to lock. Derived artifacts are built lazily once per snapshot.
+     */
+    class unl_snapshot
+    {
+    private:
+        mutable std::once_flag json_flag;
+        mutable std::string json; // Stringified json object of the UNL. (To be fed into the contract args)
+
+    public:
+        uint64_t version = 0;
+        std::map<std::string, node_stat, std::less<>> list; // Binary pubkeys of UNL nodes and their statistics.
+
+        unl_snapshot() = default;
+        unl_snapshot(const unl_snapshot &other) : version(other.version), list(other.list)
+        {
+        }
+
+        const std::string &get_json() const;
+    };
+
+    std::shared_ptr<const unl_snapshot> get_snapshot();
     size_t count();
     const std::set<std::string> get();
     const std::string get_json();
-    bool exists(const std::string &bin_pubkey);
+    bool exists(std::string_view bin_pubkey);
     int init();
     void update_unl_changes_from_patch();
     void update_unl_stats(const std::list<p2p::proposal> &proposals);
     uint32_t get_majority_time_config();
-    bool merge_latest_unl_config();
-    const std::string prepare_json_list();
+    bool merge_latest_unl_config(unl_snapshot &snapshot);
 
 } // namespace unl
 
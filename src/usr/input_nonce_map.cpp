@@ -1,12 +1,14 @@
 #include "../pchheader.hpp"
 #include "../util/util.hpp"
 #include "../ledger/ledger.hpp"
+#include "../hplog.hpp"
 #include "input_nonce_map.hpp"
 
 namespace usr
 {
-    constexpr uint64_t TTL = 300000; // 5 minutes.
-    constexpr uint16_t CLEANUP_THRESHOLD = 256;
+    input_nonce_map::input_nonce_map() : wheel(NONCE_WHEEL_SIZE)
+    {
+    }
 
     /**
      * Checks whether the given nonce is valid for the given user pubkey. If it is valid, remembers this nonce
@@ -17,56 +19,170 @@ namespace usr
      */
     int input_nonce_map::check(const std::string &pubkey, const uint64_t &nonce, const std::string &sig, const uint64_t &max_ledger_seq_no, const bool no_add)
     {
-        int result = 0;
-        
-        auto itr = nonce_map.find(pubkey);
+        const uint64_t lcl_seq_no = ledger::ctx.get_lcl_id().seq_no;
+
+        std::scoped_lock<std::mutex> lock(nonce_map_mutex);
+
+        // Collect any entries that have expired since the last check.
+        sweep(lcl_seq_no);
+
+        const pubkey_key key = to_key(pubkey);
+        const auto itr = nonce_map.find(key);
         if (itr == nonce_map.end())
         {
-            result = 0;
             if (!no_add)
-                nonce_map.emplace(pubkey, std::tuple<uint64_t, std::string, uint64_t>(nonce, sig, max_ledger_seq_no));
+            {
+                nonce_entry &entry = nonce_map[key];
+                entry.nonce = nonce;
+                entry.expire_seq_no = max_ledger_seq_no;
+                memcpy(entry.sig.data(), sig.data(), MIN(sig.size(), NONCE_SIG_SIZE));
+                schedule(key, entry);
+            }
+            return 0;
         }
-        else
+
+        nonce_entry &entry = itr->second;
+
+        // Check if previous nonce has already expired or it is less than new nonce.
+        if (entry.expire_seq_no <= lcl_seq_no || entry.nonce < nonce)
+        {
+            if (!no_add)
+            {
+                entry.nonce = nonce;
+                entry.expire_seq_no = max_ledger_seq_no;
+                memcpy(entry.sig.data(), sig.data(), MIN(sig.size(), NONCE_SIG_SIZE));
+                schedule(key, entry);
+            }
+            return 0;
+        }
+
+        // If new nonce is deemed invalid, check if new nonce/sig is same as old nonce/sig.
+        const bool same_sig = sig.size() == NONCE_SIG_SIZE && memcmp(entry.sig.data(), sig.data(), NONCE_SIG_SIZE) == 0;
+        return (entry.nonce == nonce && same_sig) ? 2 : 1;
+    }
+
+    /**
+     * Places the entry in the wheel slot matching its expiry seq no. Entries expiring beyond the wheel span
+     * are placed in the farthest slot.
+     */
+    void input_nonce_map::schedule(const pubkey_key &key, nonce_entry &entry)
+    {
+        const uint64_t slot_seq_no = MIN(MAX(entry.expire_seq_no, swept_seq_no + 1), swept_seq_no + NONCE_WHEEL_SIZE);
+
+        // Entry is already in the correct slot.
+        if (entry.slot_seq_no == slot_seq_no)
+            return;
+
+        entry.slot_seq_no = slot_seq_no;
+        wheel[slot_seq_no % NONCE_WHEEL_SIZE].push_back(key);
+    }
+
+    /**
+     * Sweeps all wheel slots which came due since the last sweep, up to the given lcl seq no.
+     * Expired entries are removed and entries parked beyond the wheel span are moved forward.
+     * Each key reference is visited once per slot it is placed in, so the work is amortised over the checks.
+     */
+    void input_nonce_map::sweep(const uint64_t lcl_seq_no)
+    {
+        if (lcl_seq_no <= swept_seq_no)
+            return;
+
+        // If the ledger has advanced more than a full wheel rotation, every slot is due and each needs only one visit.
+        const uint64_t wheel_start_seq_no = lcl_seq_no >= NONCE_WHEEL_SIZE ? (lcl_seq_no - NONCE_WHEEL_SIZE + 1) : 0;
+        const uint64_t from_seq_no = MAX(swept_seq_no + 1, wheel_start_seq_no);
+        swept_seq_no = lcl_seq_no;
+
+        size_t expired_count = 0;
+        for (uint64_t seq_no = from_seq_no; seq_no <= lcl_seq_no; seq_no++)
         {
-            const uint64_t &existing_nonce = std::get<0>(itr->second);
-            const uint64_t expire_lcl_seq_no = std::get<2>(itr->second);
+            const size_t slot = seq_no % NONCE_WHEEL_SIZE;
+            std::vector<pubkey_key> due_keys;
+            due_keys.swap(wheel[slot]);
 
-            // Check if previous nonce has already expired or it is less than new nonce.
-            if (expire_lcl_seq_no <= ledger::ctx.get_lcl_id().seq_no || existing_nonce < nonce)
+            for (const pubkey_key &key : due_keys)
             {
-                if (!no_add)
+                const auto itr = nonce_map.find(key);
+
+                // Skip stale references of entries which were removed or moved to another slot.
+                if (itr == nonce_map.end() || itr->second.slot_seq_no % NONCE_WHEEL_SIZE != slot)
+                    continue;
+
+                nonce_entry &entry = itr->second;
+                if (entry.slot_seq_no > lcl_seq_no)
                 {
-                    std::get<0>(itr->second) = nonce;
-                    std::get<2>(itr->second) = max_ledger_seq_no;
+                    // Entry was placed into this slot for a later rotation during this sweep.
+                    wheel[slot].push_back(key);
+                }
+                else if (entry.expire_seq_no <= lcl_seq_no)
+                {
+                    nonce_map.erase(itr);
+                    expired_count++;
+                }
+                else
+                {
+                    // Entry was parked in the farthest slot. Move it closer to its expiry.
+                    schedule(key, entry);
                 }
-                result = 0;
-            }
-            else
-            {
-                // If new nonce is deemed invalid, check if new nonce/sig is same as old nonce/sig.
-                const std::string &existing_sig = std::get<1>(itr->second);
-                result = (existing_nonce == nonce && existing_sig == sig) ? 2 : 1;
             }
         }
 
-        if (nonce_map.size() > CLEANUP_THRESHOLD)
-            cleanup();
+        if (expired_count > 0)
+            LOG_DEBUG << "Input nonce map: " << expired_count << " expired. keys:" << nonce_map.size() << " mem:" << (calculate_memory_usage() / 1024) << "KB";
+    }
+
+    input_nonce_map::pubkey_key input_nonce_map::to_key(std::string_view pubkey)
+    {
+        pubkey_key key = {};
+        memcpy(key.data(), pubkey.data(), MIN(pubkey.size(), NONCE_PUBKEY_SIZE));
+        return key;
+    }
+
+    size_t input_nonce_map::pubkey_key_hasher::operator()(const pubkey_key &key) const
+    {
+        // Users choose their own public keys. So we use SipHash with a random per-process key, which prevents
+        // anyone from grinding keys that fall into the same bucket.
+        static const std::array<uint8_t, crypto_shorthash_KEYBYTES> hash_key = []() {
+            std::array<uint8_t, crypto_shorthash_KEYBYTES> k;
+            randombytes_buf(k.data(), k.size());
+            return k;
+        }();
+
+        uint8_t hash[crypto_shorthash_BYTES];
+        crypto_shorthash(hash, key.data(), key.size(), hash_key.data());
 
+        size_t result;
+        memcpy(&result, hash, sizeof(result));
         return result;
     }
 
-    void input_nonce_map::cleanup()
+    /**
+     * Returns the no. of users whose nonces are currently being tracked.
+     */
+    size_t input_nonce_map::size()
     {
-        const uint64_t now = util::get_epoch_milliseconds();
+        std::scoped_lock<std::mutex> lock(nonce_map_mutex);
+        return nonce_map.size();
+    }
 
-        for (auto itr = nonce_map.begin(); itr != nonce_map.end();)
-        {
-            const uint64_t expire_on = std::get<2>(itr->second);
-            if (expire_on <= now)
-                itr = nonce_map.erase(itr);
-            else
-                itr++;
-        }
+    /**
+     * Returns the approximate no. of bytes allocated for tracked entries and the expiry wheel.
+     */
+    size_t input_nonce_map::memory_usage()
+    {
+        std::scoped_lock<std::mutex> lock(nonce_map_mutex);
+        return calculate_memory_usage();
+    }
+
+    size_t input_nonce_map::calculate_memory_usage() const
+    {
+        // Each map node holds the key/value pair plus the next pointer and cached hash.
+        size_t bytes = nonce_map.size() * (sizeof(pubkey_key) + sizeof(nonce_entry) + sizeof(void *) + sizeof(size_t));
+        bytes += nonce_map.bucket_count() * sizeof(void *);
+
+        for (const std::vector<pubkey_key> &slot : wheel)
+            bytes += sizeof(slot) + slot.capacity() * sizeof(pubkey_key);
+
+        return bytes;
     }
 
 } // namespace usr
@@ -5,18 +5,56 @@
 
 namespace usr
 {
+    // No. of ledger seq no. slots in the expiry wheel. Entries expiring beyond the wheel span are parked in the
+    // farthest slot and moved forward when that slot comes due.
+    constexpr size_t NONCE_WHEEL_SIZE = 256;
+
+    constexpr size_t NONCE_PUBKEY_SIZE = 33; // Prefixed ed25519 public key.
+    constexpr size_t NONCE_SIG_SIZE = 64;    // ed25519 signature.
+
+    /**
+     * Tracks the last accepted nonce of each user. Entries expire when the ledger reaches the max ledger seq no.
+     * of the input the nonce belonged to. Expired entries are collected via a ledger seq no. keyed timing wheel,
+     * so each check only performs amortised constant work regardless of the no. of tracked users.
+     */
     class input_nonce_map
     {
     private:
-        // Keeps short-lived nonces and signatures with their absolute expiration time.
-        // Keyed by user binary pubkey.
-        std::unordered_map<std::string, std::tuple<uint64_t, std::string, uint64_t>> nonce_map;
-        void cleanup();
+        typedef std::array<uint8_t, NONCE_PUBKEY_SIZE> pubkey_key;
+
+        struct pubkey_key_hasher
+        {
+            size_t operator()(const pubkey_key &key) const;
+        };
+
+        struct nonce_entry
+        {
+            uint64_t nonce = 0;
+            uint64_t expire_seq_no = 0; // The nonce is no longer enforced once the ledger reaches this seq no.
+            uint64_t slot_seq_no = 0;   // The seq no. of the wheel slot currently holding this entry.
+            std::array<uint8_t, NONCE_SIG_SIZE> sig;
+        };
+
+        std::unordered_map<pubkey_key, nonce_entry, pubkey_key_hasher> nonce_map;
+
+        // Ring of wheel slots. Slot index = seq no. % NONCE_WHEEL_SIZE. A slot may contain stale keys of entries
+        // that have since been moved to another slot. Those are discarded when the slot is swept.
+        std::vector<std::vector<pubkey_key>> wheel;
+        uint64_t swept_seq_no = 0; // All slots up to and including this seq no. have been swept.
+        std::mutex nonce_map_mutex;
+
+        void schedule(const pubkey_key &key, nonce_entry &entry);
+        void sweep(const uint64_t lcl_seq_no);
+        size_t calculate_memory_usage() const;
+        static pubkey_key to_key(std::string_view pubkey);
 
     public:
+        input_nonce_map();
         int check(const std::string &pubkey, const uint64_t &nonce, const std::string &sig, const uint64_t &max_ledger_seq_no, const bool no_add = false);
+        size_t size();
+        size_t memory_usage();
     };
 
 } // namespace usr
 
-#endif
\ No newline at end of file
+#endif
@@ -3,17 +3,21 @@
 #include "../util/util.hpp"
 #include "../util/buffer_store.hpp"
 #include "../conf.hpp"
+#include "../metrics.hpp"
 #include "../msg/usrmsg_parser.hpp"
 #include "usr.hpp"
 #include "read_req.hpp"
+#include "../thread_placement.hpp"
 
 /**
  * Helper functions for serving read requests from users.
  */
 namespace read_req
 {
-    constexpr uint16_t LOOP_WAIT = 100;      // Milliseconds.
-    constexpr uint16_t MAX_QUEUE_SIZE = 1024; // Maximum read request queue size, The size passed is rounded up to the next multiple of the block size (32).
+    constexpr uint16_t LOOP_WAIT = 100;                // Milliseconds.
+    constexpr uint16_t MAX_QUEUE_SIZE = 1024;          // Maximum read request queue size.
+    constexpr uint16_t MAX_READ_REQUESTS_PER_USER = 16; // Max no. of queued and running read requests of a single user.
+    constexpr uint32_t READ_REQ_QUEUE_TIMEOUT = 10000; // Milliseconds a read request can wait in the queue before it gets dropped.
 
     bool is_shutting_down = false;
     bool init_success = false;
@@ -21,9 +25,10 @@ namespace read_req
     util::buffer_store read_req_store;
     std::thread thread_pool_executor; // Thread which spawns new threads for the read requests is the queue.
     std::vector<std::thread> read_req_threads;
-    moodycamel::ConcurrentQueue<user_read_req> read_req_queue(MAX_QUEUE_SIZE, 0, conf::CONCURRENT_READ_REQUEST_MAX_LIMIT);
+    std::mutex read_req_queue_mutex;
+    std::list<user_read_req> read_req_queue;
     std::mutex execution_contexts_mutex;
-    std::list<sc::execution_context> execution_contexts;
+    std::list<running_read_req> execution_contexts;
     std::mutex completed_threads_mutex;
     std::vector<pthread_t> completed_threads;
 
@@ -32,6 +37,8 @@ namespace read_req
         if (read_req_store.init() == -1)
             return -1;
 
+        metrics::register_gauge_callback("hp_read_req_queue_size", "Read requests waiting to be executed.", []() { return (int64_t)get_queue_size(); });
+
         thread_pool_executor = std::thread(manage_thread_pool);
         init_success = true;
         return 0;
@@ -49,8 +56,8 @@ namespace read_req
             {
                 // Force stoping all running contracts.
                 std::scoped_lock<std::mutex> lock(execution_contexts_mutex);
-                for (sc::execution_context &execution_context : execution_contexts)
-                    sc::stop(execution_context);
+                for (running_read_req &running : execution_contexts)
+                    sc::stop(running.contract_ctx);
             }
 
             // Joining all read request processing threads.
@@ -68,6 +75,7 @@ namespace read_req
     {
         LOG_INFO << "Read request thread pool manager started.";
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::GENERAL, "hp-readreq-mgr");
 
         while (!is_shutting_down)
         {
@@ -90,10 +98,11 @@ namespace read_req
                 }
             }
 
-            if (read_req_queue.size_approx() != 0 && read_req_threads.size() <= conf::cfg.user.concurrent_read_requests)
+            const size_t queue_size = get_queue_size();
+            if (queue_size != 0 && read_req_threads.size() < conf::cfg.user.concurrent_read_requests)
             {
                 read_req_threads.push_back(std::thread(read_request_processor));
-                if (read_req_queue.size_approx() == 1)
+                if (queue_size == 1)
                 {
                     // The sleep is added to avoid creating a new thread before the newly created thread dequeue the job
                     // from the queue.
@@ -117,8 +126,9 @@ namespace read_req
         LOG_DEBUG << "A new read request processing thread started.";
 
         util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::GENERAL, "hp-readreq");
 
-        std::list<sc::execution_context>::iterator context_itr;
+        std::list<running_read_req>::iterator context_itr;
 
         // Own pthread id.
         const pthread_t thread_id = pthread_self();
@@ -126,43 +136,44 @@ namespace read_req
         while (!is_shutting_down)
         {
             user_read_req read_request;
-            if (read_req_queue.try_dequeue(read_request))
+            if (dequeue_read_request(read_request))
             {
+                usr::session_handle &handle = *read_request.handle;
                 {
-                    // Contract context is added to the list for force kill if a SIGINT is received.
+                    // Contract context is added to the list for force kill if a SIGINT is received or the request gets cancelled.
                     sc::execution_context contract_ctx(read_req_store);
                     std::scoped_lock<std::mutex> execution_contract_lock(execution_contexts_mutex);
-                    context_itr = execution_contexts.emplace(execution_contexts.begin(), std::move(contract_ctx));
+                    context_itr = execution_contexts.emplace(execution_contexts.begin(), running_read_req{std::move(contract_ctx), read_request.handle, read_request.id});
                 }
 
                 // Populate execution context data if any read requests are available in the queue.
-                initialize_execution_context(std::move(read_request), thread_id, *context_itr);
+                sc::execution_context &contract_ctx = context_itr->contract_ctx;
+                initialize_execution_context(read_request, thread_id, contract_ctx);
                 LOG_DEBUG << "Read request contract execution started.";
 
+                static metrics::histogram &execution_duration = metrics::get_histogram("hp_read_req_execution_ms", "Read request contract execution time.");
+
                 // Process the read requests by executing the contract.
-                if (sc::execute_contract(*context_itr) != -1)
-                {
-                    // If contract execution was succcessful, send the output back to user.
-                    std::scoped_lock<std::mutex> lock(usr::ctx.users_mutex);
+                const uint64_t execution_start = util::get_epoch_milliseconds();
+                const int execution_result = sc::execute_contract(contract_ctx);
+                execution_duration.record(util::get_epoch_milliseconds() - execution_start);
 
-                    const auto user_buf_itr = context_itr->args.userbufs.begin();
+                if (execution_result != -1)
+                {
+                    // If contract execution was succcessful, send the output back to user via the user's session handle.
+                    const auto user_buf_itr = contract_ctx.args.userbufs.begin();
                     if (!user_buf_itr->second.outputs.empty())
                     {
-                        // Find the user session by user pubkey.
-                        const auto user_itr = usr::ctx.users.find(user_buf_itr->first);
-                        if (user_itr != usr::ctx.users.end()) // match found
+                        msg::usrmsg::usrmsg_parser parser(handle.protocol);
+                        for (sc::contract_output &output : user_buf_itr->second.outputs)
                         {
-                            const usr::connected_user &user = user_itr->second;
-                            msg::usrmsg::usrmsg_parser parser(user.protocol);
-                            for (sc::contract_output &output : user_buf_itr->second.outputs)
-                            {
-                                std::vector<uint8_t> msg;
-                                parser.create_contract_read_response_container(msg, read_request.id, output.message);
-                                user.session.send(msg);
-                                output.message.clear();
-                            }
-                            user_buf_itr->second.outputs.clear();
+                            std::vector<uint8_t> msg;
+                            parser.create_contract_read_response_container(msg, read_request.id, output.message);
+                            if (handle.send(msg) == -1)
+                                break; // User has disconnected.
+                            output.message.clear();
                         }
+                        user_buf_itr->second.outputs.clear();
                     }
                     LOG_DEBUG << "Read request contract execution ended.";
                 }
@@ -171,6 +182,8 @@ namespace read_req
                     LOG_ERROR << "Contract execution for read request failed.";
                 }
 
+                handle.read_requests_running--;
+
                 // Remove successfully executed execution contexts.
                 std::scoped_lock<std::mutex> execution_contract_lock(execution_contexts_mutex);
                 execution_contexts.erase(context_itr);
@@ -192,22 +205,120 @@ namespace read_req
 
     /**
      * Add new read request from users to the read request queue for processing.
-     * @param pubkey Public key of the user.
+     * @param handle Session handle of the user.
      * @param id Message id (used to associate replies).
      * @param content Message content.
-     * @return 0 on successful addition and -1 on queue overflow
+     * @return 0 on successful addition and -1 on queue overflow or if the user has too many read requests.
     */
-    int populate_read_req_queue(const std::string &pubkey, const std::string &id, const std::string &content)
+    int populate_read_req_queue(const std::shared_ptr<usr::session_handle> &handle, const std::string &id, const std::string &content)
     {
+        std::scoped_lock<std::mutex> lock(read_req_queue_mutex);
+
+        if (read_req_queue.size() >= MAX_QUEUE_SIZE ||
+            (handle->read_requests_queued + handle->read_requests_running) >= MAX_READ_REQUESTS_PER_USER)
+            return -1;
+
         user_read_req read_request;
+        read_request.handle = handle;
         read_request.id = id;
+        read_request.deadline = util::get_epoch_milliseconds() + READ_REQ_QUEUE_TIMEOUT;
         read_request.content = read_req_store.write_buf(content.data(), content.size());
-        read_request.pubkey = pubkey;
-
         if (read_request.content.is_null())
             return -1;
-        else
-            return read_req_queue.try_enqueue(read_request);
+
+        handle->read_requests_queued++;
+        read_req_queue.push_back(std::move(read_request));
+        return 0;
+    }
+
+    /**
+     * Takes the next read request to be executed off the queue. Requests of the users with the least no. of running
+     * read requests are served first so a single user cannot occupy all read request threads while others wait.
+     * Requests of disconnected users and requests that waited past their deadline are dropped.
+     * @param read_request The dequeued read request.
+     * @return True if a read request was dequeued. False if there are no read requests to execute.
+     */
+    bool dequeue_read_request(user_read_req &read_request)
+    {
+        std::scoped_lock<std::mutex> lock(read_req_queue_mutex);
+
+        const uint64_t now = util::get_epoch_milliseconds();
+        auto selected = read_req_queue.end();
+        auto itr = read_req_queue.begin();
+        while (itr != read_req_queue.end())
+        {
+            if (itr->handle->is_closed() || now > itr->deadline)
+            {
+                LOG_DEBUG << "Dropped read request " << itr->id << (itr->handle->is_closed() ? " of disconnected user." : " past deadline.");
+                itr->handle->read_requests_queued--;
+                read_req_store.purge(itr->content);
+                itr = read_req_queue.erase(itr);
+                continue;
+            }
+
+            if (selected == read_req_queue.end() || itr->handle->read_requests_running < selected->handle->read_requests_running)
+                selected = itr;
+
+            ++itr;
+        }
+
+        if (selected == read_req_queue.end())
+            return false;
+
+        read_request = std::move(*selected);
+        read_req_queue.erase(selected);
+        read_request.handle->read_requests_queued--;
+        read_request.handle->read_requests_running++;
+        return true;
+    }
+
+    /**
+     * Cancels the read requests of a user. Queued requests are removed and running requests are stopped.
+     * @param handle Session handle of the user.
+     * @param id Id of the read request to cancel. Empty to cancel all read requests of the user.
+     * @return No. of read requests cancelled.
+     */
+    int cancel_read_requests(const usr::session_handle &handle, std::string_view id)
+    {
+        int cancelled = 0;
+        {
+            std::scoped_lock<std::mutex> lock(read_req_queue_mutex);
+            auto itr = read_req_queue.begin();
+            while (itr != read_req_queue.end())
+            {
+                if (itr->handle.get() == &handle && (id.empty() || itr->id == id))
+                {
+                    itr->handle->read_requests_queued--;
+                    read_req_store.purge(itr->content);
+                    itr = read_req_queue.erase(itr);
+                    cancelled++;
+                }
+                else
+                {
+                    ++itr;
+                }
+            }
+        }
+
+        {
+            std::scoped_lock<std::mutex> lock(execution_contexts_mutex);
+            for (running_read_req &running : execution_contexts)
+            {
+                if (running.handle.get() == &handle && (id.empty() || running.id == id))
+                {
+                    sc::stop(running.contract_ctx);
+                    cancelled++;
+                }
+            }
+        }
+
+        return cancelled;
+    }
+
+    size_t get_queue_size()
+    {
+        std::scoped_lock<std::mutex> lock(read_req_queue_mutex);
+        return read_req_queue.size();
     }
 
     /**
@@ -222,7 +333,7 @@ namespace read_req
         contract_ctx.args.readonly = true;
         sc::contract_iobufs user_bufs;
         user_bufs.inputs.push_back(read_request.content);
-        contract_ctx.args.userbufs.try_emplace(read_request.pubkey, std::move(user_bufs));
+        contract_ctx.args.userbufs.try_emplace(read_request.handle->pubkey, std::move(user_bufs));
     }
 
     /**
@@ -3,14 +3,23 @@
 
 #include "../sc/sc.hpp"
 #include "../util/buffer_store.hpp"
+#include "session_handle.hpp"
 
 namespace read_req
 {
     struct user_read_req
     {
-        std::string pubkey;
+        std::shared_ptr<usr::session_handle> handle; // Session handle of the user who sent the request.
         std::string id;
         util::buffer_view content;
+        uint64_t deadline = 0; // Epoch milliseconds after which the request is dropped if it's still queued.
+    };
+
+    struct running_read_req
+    {
+        sc::execution_context contract_ctx;
+        std::shared_ptr<usr::session_handle> handle;
+        std::string id;
     };
 
     int init();
@@ -21,7 +30,13 @@ namespace read_req
 
     void read_request_processor();
 
-    int populate_read_req_queue(const std::string &pubkey, const std::string &id, const std::string &content);
+    int populate_read_req_queue(const std::shared_ptr<usr::session_handle> &handle, const std::string &id, const std::string &content);
+
+    bool dequeue_read_request(user_read_req &read_request);
+
+    int cancel_read_requests(const usr::session_handle &handle, std::string_view id = {});
+
+    size_t get_queue_size();
 
     void initialize_execution_context(const user_read_req &read_request, const pthread_t thread_id, sc::execution_context &contract_ctx);
 
@@ -0,0 +1,38 @@
+#include "session_handle.hpp"
+
+namespace usr
+{
+    session_handle::session_handle(user_comm_session &session, std::string_view pubkey, const util::PROTOCOL protocol)
+        : session(&session), pubkey(pubkey), protocol(protocol)
+    {
+    }
+
+    /**
+     * Sends the given message to the user session if the user is still connected.
+     * @return 0 if the message was queued for sending. -1 if the user has disconnected.
+     */
+    int session_handle::send(const std::vector<uint8_t> &msg)
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        if (session == NULL)
+            return -1;
+
+        return session->send(msg);
+    }
+
+    /**
+     * Detaches the handle from the session. Must be called before the session is destroyed.
+     */
+    void session_handle::close()
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        session = NULL;
+    }
+
+    bool session_handle::is_closed()
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        return session == NULL;
+    }
+
+} // namespace usr
@@ -0,0 +1,36 @@
+#ifndef _HP_USR_SESSION_HANDLE_
+#define _HP_USR_SESSION_HANDLE_
+
+#include "../pchheader.hpp"
+#include "../util/util.hpp"
+#include "user_comm_session.hpp"
+
+namespace usr
+{
+    /**
+     * Shared reference to an authenticated user's session for components which reply to the user asynchronously.
+     * Replies go straight to the session without looking the user up again. The handle gets closed when the user
+     * disconnects, after which replies are discarded.
+     */
+    class session_handle
+    {
+    private:
+        user_comm_session *session;
+        std::mutex mutex; // Guards the session pointer against the user disconnecting.
+
+    public:
+        const std::string pubkey;      // User binary public key.
+        const util::PROTOCOL protocol; // The messaging protocol used by the user.
+
+        std::atomic<uint32_t> read_requests_queued = 0;  // No. of read requests waiting in the queue.
+        std::atomic<uint32_t> read_requests_running = 0; // No. of read requests being executed.
+
+        session_handle(user_comm_session &session, std::string_view pubkey, const util::PROTOCOL protocol);
+        int send(const std::vector<uint8_t> &msg);
+        void close();
+        bool is_closed();
+    };
+
+} // namespace usr
+
+#endif
@@ -9,19 +9,15 @@
 
 namespace usr
 {
-    // Forward declaration. Defined in usr.cpp.
-    void dispatch_change_events();
-
     class user_comm_server : public comm::comm_server<user_comm_session>
     {
         using comm::comm_server<user_comm_session>::comm_server; // Inherit constructors.
 
+    private:
+        uint64_t last_upload_sweep = 0; // Epoch milliseconds of the last idle upload sweep.
+
     protected:
-        int process_custom_messages()
-        {
-            usr::dispatch_change_events();
-            return 0;
-        }
+        int process_custom_messages();
     };
 } // namespace usr
 
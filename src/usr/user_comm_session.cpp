@@ -19,6 +19,12 @@ namespace usr
         {
             LOG_DEBUG << "User client connected " << display_name();
 
+            // Bound the outbound queue so a slow consumer cannot grow our memory without limit.
+            const std::string &policy = conf::cfg.user.slow_consumer_policy;
+            set_outbound_budget(conf::cfg.user.max_outbound_bytes,
+                                policy == "disconnect" ? comm::OUTBOUND_POLICY::DISCONNECT
+                                                       : (policy == "coalesce" ? comm::OUTBOUND_POLICY::COALESCE : comm::OUTBOUND_POLICY::DROP_OLDEST));
+
             // As soon as a user connects, we issue them a challenge message. We remember the
             // challenge we issued and later verify the user's response with it.
             std::vector<uint8_t> msg;
@@ -39,8 +45,10 @@ namespace usr
     /**
      * This gets hit every time we receive some data from a client connected to the HP public port.
      */
-    int user_comm_session::handle_message(std::string_view msg)
+    int user_comm_session::handle_message(comm::inbound_message &inbound)
     {
+        std::string_view msg = inbound.data;
+
         // Adding message size to user message characters(bytes) per minute counter.
         increment_metric(comm::SESSION_THRESHOLDS::MAX_RAWBYTES_PER_MINUTE, msg.size());
 
@@ -59,12 +67,11 @@ namespace usr
             // Check whether this user is among authenticated users
             // and perform authenticated msg processing.
 
-            const auto itr = ctx.users.find(pubkey);
-            if (itr != ctx.users.end())
+            connected_user *user = ctx.users.find(pubkey);
+            if (user)
             {
                 // This is an authed user.
-                connected_user &user = itr->second;
-                if (handle_authed_user_message(user, msg) != 0)
+                if (handle_authed_user_message(*user, msg) != 0)
                 {
                     increment_metric(comm::SESSION_THRESHOLDS::MAX_BADMSGS_PER_MINUTE, 1);
                     LOG_DEBUG << "Bad message from user " << display_name();
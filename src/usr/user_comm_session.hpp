@@ -15,7 +15,7 @@ namespace usr
 
     private:
         int handle_connect();
-        int handle_message(std::string_view msg);
+        int handle_message(comm::inbound_message &inbound);
         void handle_close();
     };
 
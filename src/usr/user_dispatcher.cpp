@@ -0,0 +1,192 @@
+#include "../pchheader.hpp"
+#include "../hplog.hpp"
+#include "../util/util.hpp"
+#include "../msg/usrmsg_parser.hpp"
+#include "../msg/usrmsg_common.hpp"
+#include "../status.hpp"
+#include "usr.hpp"
+#include "user_dispatcher.hpp"
+#include "../thread_placement.hpp"
+
+/**
+ * Sends consensus outputs and change notifications to connected users. Messages are assembled on the dispatcher
+ * thread from parts which are serialized once per protocol, so the consensus thread only hands over the outputs
+ * and user locks are only held to enqueue the finished messages.
+ */
+namespace usr
+{
+    constexpr uint16_t LOOP_WAIT = 10; // Milliseconds.
+
+    bool dispatcher_shutting_down = false;
+    bool dispatcher_init_success = false;
+    std::thread dispatcher_thread;
+    moodycamel::ConcurrentQueue<contract_output_batch> output_batch_queue;
+
+    int init_dispatcher()
+    {
+        dispatcher_thread = std::thread(dispatcher_loop);
+        dispatcher_init_success = true;
+        return 0;
+    }
+
+    void deinit_dispatcher()
+    {
+        if (dispatcher_init_success)
+        {
+            dispatcher_shutting_down = true;
+            dispatcher_thread.join();
+        }
+    }
+
+    /**
+     * Hands over the consensed outputs of a ledger to the dispatcher thread.
+     * @param batch Outputs of the locally connected users along with the round information.
+     */
+    void enqueue_contract_outputs(contract_output_batch &&batch)
+    {
+        output_batch_queue.enqueue(std::move(batch));
+    }
+
+    void dispatcher_loop()
+    {
+        LOG_INFO << "User message dispatcher started.";
+        util::mask_signal();
+        thread_placement::apply(thread_placement::THREAD_CLASS::NETWORK, "hp-user-disp");
+
+        while (!dispatcher_shutting_down)
+        {
+            const int dispatched = dispatch_contract_outputs() + dispatch_change_events();
+
+            // Wait a small delay if there were no messages to dispatch.
+            if (dispatched == 0)
+                util::sleep(LOOP_WAIT);
+        }
+
+        LOG_INFO << "User message dispatcher stopped.";
+    }
+
+    /**
+     * Sends the queued contract outputs to the relevant users if they are still connected to the node.
+     * @return No. of output batches dispatched.
+     */
+    int dispatch_contract_outputs()
+    {
+        int dispatched = 0;
+        contract_output_batch batch;
+        while (output_batch_queue.try_dequeue(batch))
+        {
+            dispatched++;
+
+            // Round-common message fragments for each protocol. Constructed on first use.
+            msg::usrmsg::contract_output_fragments fragments[3];
+            bool fragments_created[3] = {false, false, false};
+
+            for (const user_output_set &uo : batch.users)
+            {
+                std::optional<util::PROTOCOL> protocol;
+                ctx.users.with_user(uo.pubkey, [&](const connected_user &user)
+                                    { protocol = user.protocol; });
+                if (!protocol)
+                    continue; // User has disconnected.
+
+                const msg::usrmsg::usrmsg_parser parser(*protocol);
+                if (!fragments_created[*protocol])
+                {
+                    parser.create_contract_output_fragments(fragments[*protocol], batch.unl_sig, batch.lcl_seq_no, batch.lcl_hash.to_string_view());
+                    fragments_created[*protocol] = true;
+                }
+
+                std::vector<uint8_t> msg;
+                parser.create_contract_output_container(msg, fragments[*protocol], uo.hash, uo.outputs, uo.hash_root);
+
+                // The user may have reconnected with a different protocol while the message was being assembled.
+                ctx.users.with_user(uo.pubkey, [&](connected_user &user)
+                                    {
+                                        if (user.protocol == *protocol)
+                                            user.session.send(msg);
+                                    });
+            }
+        }
+        return dispatched;
+    }
+
+    /**
+     * Sends any change event notifications to relevant users who are currently connected to the node.
+     * @return No. of events dispatched.
+     */
+    int dispatch_change_events()
+    {
+        int dispatched = 0;
+        status::change_event ev;
+        while (status::event_queue.try_dequeue(ev))
+        {
+            dispatched++;
+
+            // Array to hold constructed message cache from each protocol.
+            std::vector<uint8_t> protocol_msgs[3];
+
+            if (ev.index() == 0) // UNL change event. Broadcast for subscribed users.
+            {
+                ctx.users.for_each([&](connected_user &user)
+                                   {
+                                       if (user.subscriptions[NOTIFICATION_CHANNEL::UNL_CHANGE])
+                                       {
+                                           std::vector<uint8_t> &msg = protocol_msgs[user.protocol];
+                                           if (msg.empty()) // Construct the message with relevant protocol if not done so already.
+                                           {
+                                               msg::usrmsg::usrmsg_parser parser(user.protocol);
+                                               const status::unl_change_event &unl_ev = std::get<status::unl_change_event>(ev);
+                                               parser.create_unl_notification(msg, unl_ev.unl);
+                                           }
+                                           user.session.send_notification(msg, ev.index());
+                                       }
+                                   });
+            }
+            else if (ev.index() == 1 || ev.index() == 2) // Ledger events. Broadcast for subscribed users.
+            {
+                ctx.users.for_each([&](connected_user &user)
+                                   {
+                                       if (user.subscriptions[NOTIFICATION_CHANNEL::LEDGER_EVENT])
+                                       {
+                                           std::vector<uint8_t> &msg = protocol_msgs[user.protocol];
+                                           if (msg.empty()) // Construct the message with relevant protocol if not done so already.
+                                           {
+                                               msg::usrmsg::usrmsg_parser parser(user.protocol);
+
+                                               if (ev.index() == 1) // Ledger created event.
+                                               {
+                                                   const status::ledger_created_event &ledger_ev = std::get<status::ledger_created_event>(ev);
+                                                   parser.create_ledger_created_notification(msg, ledger_ev.ledger);
+                                               }
+                                               else if (ev.index() == 2) // Vote status chnge event.
+                                               {
+                                                   const status::vote_status_change_event &vote_ev = std::get<status::vote_status_change_event>(ev);
+                                                   parser.create_vote_status_notification(msg, vote_ev.vote_status);
+                                               }
+                                           }
+                                           user.session.send_notification(msg, ev.index());
+                                       }
+                                   });
+            }
+            else if (ev.index() == 3) // Health events. Broadcast for subscribed users.
+            {
+                ctx.users.for_each([&](connected_user &user)
+                                   {
+                                       if (user.subscriptions[NOTIFICATION_CHANNEL::HEALTH_STAT])
+                                       {
+                                           std::vector<uint8_t> &msg = protocol_msgs[user.protocol];
+                                           if (msg.empty()) // Construct the message with relevant protocol if not done so already.
+                                           {
+                                               msg::usrmsg::usrmsg_parser parser(user.protocol);
+                                               const status::health_event &health_ev = std::get<status::health_event>(ev);
+                                               parser.create_health_notification(msg, health_ev);
+                                           }
+                                           user.session.send_notification(msg, ev.index());
+                                       }
+                                   });
+            }
+        }
+        return dispatched;
+    }
+
+} // namespace usr
@@ -0,0 +1,46 @@
+#ifndef _HP_USR_USER_DISPATCHER_
+#define _HP_USR_USER_DISPATCHER_
+
+#include "../pchheader.hpp"
+#include "../util/h32.hpp"
+#include "../util/merkle_hash_tree.hpp"
+
+namespace usr
+{
+    /**
+     * Consensed outputs of a single locally connected user.
+     */
+    struct user_output_set
+    {
+        std::string pubkey;
+        std::string hash; // The hash of all outputs for the user.
+        std::vector<std::string> outputs;
+        util::merkle_hash_node hash_root; // Merkle hash tree collapsed around the user's output hash.
+    };
+
+    /**
+     * Consensed user outputs of a ledger to be sent to the users by the dispatcher.
+     */
+    struct contract_output_batch
+    {
+        uint64_t lcl_seq_no = 0;
+        util::h32 lcl_hash;
+        std::vector<std::pair<std::string, std::string>> unl_sig;
+        std::vector<user_output_set> users;
+    };
+
+    int init_dispatcher();
+
+    void deinit_dispatcher();
+
+    void enqueue_contract_outputs(contract_output_batch &&batch);
+
+    void dispatcher_loop();
+
+    int dispatch_contract_outputs();
+
+    int dispatch_change_events();
+
+} // namespace usr
+
+#endif
@@ -3,9 +3,39 @@
 
 #include "../pchheader.hpp"
 #include "../util/util.hpp"
+#include "../util/buffer_store.hpp"
 
 namespace usr
 {
+    // Max no. of chunked input uploads a user can have in progress at once.
+    constexpr size_t MAX_CONCURRENT_INPUT_UPLOADS = 4;
+
+    // Max no. of bytes a signed input container holds in addition to the input (nonce, max ledger seq no. and field
+    // framing). Used to reject over-budget inputs before decoding the container. Containers padded beyond this may
+    // get rejected early.
+    constexpr size_t MAX_INPUT_CONTAINER_OVERHEAD = 1024;
+
+    // Max size of a single chunked input upload. The per-round user input limit applies as well if configured.
+    constexpr size_t MAX_INPUT_UPLOAD_SIZE = 64 * 1024 * 1024;
+
+    // Unfinished chunked input uploads which don't receive a chunk within this many milliseconds are abandoned.
+    constexpr uint64_t INPUT_UPLOAD_IDLE_TIMEOUT = 30000;
+
+    // Upload chunks are admitted against a per-user byte rate instead of the message rate limit. Each chunk is charged
+    // at least the minimum charge so a flood of tiny chunks is limited as well. Applies when admission control is enabled.
+    constexpr uint64_t INPUT_UPLOAD_BYTES_PER_SEC = 16 * 1024 * 1024;
+    constexpr uint64_t MIN_INPUT_UPLOAD_CHUNK_CHARGE = 4 * 1024;
+
+    /**
+     * Input container fields decoded when a user submits an input directly to this node.
+     */
+    struct decoded_input_container
+    {
+        std::string input;
+        uint64_t nonce = 0;
+        uint64_t max_ledger_seq_no = 0;
+        bool streamed = false; // Whether the signed container holds the hash of chunk uploaded input bytes.
+    };
 
     /**
      * Represents a signed contract input message a network user has submitted.
@@ -15,6 +45,43 @@ namespace usr
         const std::string input_container;
         const std::string sig;
         const util::PROTOCOL protocol; // The message protocol used by the user.
+
+        // Holds the result of the first container decode for inputs submitted to this node, so consensus does not need
+        // to decode the container again. This is never transmitted. Inputs received from peers only have the container.
+        std::optional<decoded_input_container> decoded;
+
+        // Whether the input was uploaded in chunks. The signed container of such an input holds the hash of the input
+        // bytes instead of the input itself along with the streamed flag, and the bytes travel alongside the container.
+        // For inputs from peers this reflects whether the bytes were attached, and must match the signed flag.
+        bool streamed = false;
+
+        // Streamed input bytes that were uploaded to this node. These have already been assembled in the input store,
+        // so they are only referenced here and get read from the store when the NUP is relayed. This is never transmitted.
+        util::buffer_view stored_input = {0, 0};
+
+        // Streamed input bytes received from peers.
+        std::string streamed_input;
+
+        // Returns the input size if known. Falls back to the container size for undecoded inputs from peers.
+        size_t input_size() const
+        {
+            if (!stored_input.is_null())
+                return stored_input.size;
+            else if (streamed)
+                return streamed_input.size();
+            return decoded ? decoded->input.size() : input_container.size();
+        }
+    };
+
+    /**
+     * Tracks a chunked input upload which is in progress. Chunks are written straight into the input store as they arrive.
+     */
+    struct input_upload
+    {
+        util::buffer_view stored_input; // Reserved input store location of the declared input size.
+        uint32_t received = 0;          // No. of bytes received so far.
+        uint64_t last_activity = 0;     // Epoch milliseconds of the last upload message.
+        blake3_hasher hasher;           // Running hash of the received bytes.
     };
 
     struct extracted_user_input
@@ -23,6 +90,13 @@ namespace usr
         uint64_t nonce;
         uint64_t max_ledger_seq_no;
         std::string sig;
+        util::buffer_view stored_input = {0, 0}; // Set if the input is already in the input store. Then 'input' is empty.
+
+        // Returns the input size irrespective of where the input bytes are held.
+        size_t input_size() const
+        {
+            return stored_input.is_null() ? input.size() : stored_input.size;
+        }
 
         // Comparison operator used for sorting user's inputs in nonce order.
         bool operator<(const extracted_user_input &other)
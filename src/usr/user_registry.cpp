@@ -0,0 +1,77 @@
+#include "user_registry.hpp"
+
+namespace usr
+{
+    user_registry::shard &user_registry::get_shard(std::string_view pubkey)
+    {
+        return shards[std::hash<std::string_view>{}(pubkey) % USER_REGISTRY_SHARD_COUNT];
+    }
+
+    /**
+     * Adds a new user to the registry.
+     * @param session User socket session.
+     * @param pubkey User binary pubkey.
+     * @param protocol Messaging protocol used by the user.
+     * @param max_users Maximum no. of users allowed in the registry. 0 means unlimited.
+     * @return 0 if the user was added. 1 if a user with the same pubkey already exists. -1 if the user cap is reached.
+     */
+    int user_registry::add(usr::user_comm_session &session, std::string_view pubkey, const util::PROTOCOL protocol, const size_t max_users)
+    {
+        // Reserve a slot in the user count before touching the shard so concurrent additions can never overshoot the cap.
+        size_t count = user_count.load();
+        do
+        {
+            if (max_users > 0 && count >= max_users)
+                return -1;
+        } while (!user_count.compare_exchange_weak(count, count + 1));
+
+        shard &s = get_shard(pubkey);
+        std::scoped_lock<std::mutex> lock(s.mutex);
+        if (!s.users.try_emplace(std::string(pubkey), session, pubkey, protocol).second)
+        {
+            user_count--;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Removes the specified user from the registry.
+     * @return True if the user was removed. False if not found.
+     */
+    bool user_registry::remove(const std::string &pubkey)
+    {
+        shard &s = get_shard(pubkey);
+        std::scoped_lock<std::mutex> lock(s.mutex);
+        if (s.users.erase(pubkey) == 0)
+            return false;
+
+        user_count--;
+        return true;
+    }
+
+    /**
+     * Looks up the specified user. The returned pointer remains valid only until the user is removed. Since a user is
+     * removed only when its session closes, this is meant for callers acting on behalf of the user's own session.
+     * @return Pointer to the connected user. NULL if not found.
+     */
+    connected_user *user_registry::find(const std::string &pubkey)
+    {
+        shard &s = get_shard(pubkey);
+        std::scoped_lock<std::mutex> lock(s.mutex);
+        const auto itr = s.users.find(pubkey);
+        return itr == s.users.end() ? NULL : &itr->second;
+    }
+
+    size_t user_registry::size() const
+    {
+        return user_count.load();
+    }
+
+    bool user_registry::empty() const
+    {
+        return user_count.load() == 0;
+    }
+
+} // namespace usr
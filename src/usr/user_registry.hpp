@@ -0,0 +1,148 @@
+#ifndef _HP_USR_USER_REGISTRY_
+#define _HP_USR_USER_REGISTRY_
+
+#include "../pchheader.hpp"
+#include "../util/util.hpp"
+#include "../util/token_bucket.hpp"
+#include "user_comm_session.hpp"
+#include "session_handle.hpp"
+#include "user_input.hpp"
+#include "user_common.hpp"
+
+namespace usr
+{
+    // No. of independently locked shards the user registry is split into.
+    constexpr size_t USER_REGISTRY_SHARD_COUNT = 64;
+
+    /**
+     * Holds information about an authenticated (challenge-verified) user
+     * connected to the HotPocket node.
+     */
+    struct connected_user
+    {
+        // User binary public key
+        const std::string pubkey;
+
+        // Holds the unprocessed user inputs collected from websocket.
+        std::list<submitted_user_input> submitted_inputs;
+
+        // Total input bytes collected which are pending to be subjected to consensus.
+        size_t collected_input_size = 0;
+
+        // Guards submitted_inputs and collected_input_size. This lets the input collector and the consensus
+        // thread exchange inputs of a single user without blocking any other user.
+        std::mutex inputs_mutex;
+
+        // Chunked input uploads in progress keyed by the user-assigned upload id. Only accessed by the user message
+        // processing thread, which handles connection closure as well.
+        std::unordered_map<std::string, input_upload> uploads;
+
+        // Admission rate limiter for input submissions (contract inputs and upload begins). Only accessed by the user
+        // message processing thread.
+        util::token_bucket admission;
+
+        // Admission byte budget for upload chunks. Only accessed by the user message processing thread.
+        util::token_bucket upload_admission;
+
+        // Whether the user has been told about its inputs getting dropped since it got throttled. Further dropped
+        // inputs are not answered until an input gets accepted again. Only accessed by the user message processing thread.
+        bool throttle_notified = false;
+
+        // Whether the user got throttled since the last sealing NUP. Throttled users are served last when this node caps
+        // the total input bytes relayed per round.
+        std::atomic<bool> throttled = false;
+
+        // User's notification subscription toggles.
+        std::atomic<bool> subscriptions[3];
+
+        // Holds the websocket session of this user.
+        // We don't need to own the session object since the lifetime of user and session are coupled.
+        usr::user_comm_session &session;
+
+        // The messaging protocol used by this user.
+        const util::PROTOCOL protocol = util::PROTOCOL::JSON;
+
+        // Handle for replying to the user asynchronously. Closed when the user is removed.
+        const std::shared_ptr<session_handle> handle;
+
+        /**
+         * @param session The web socket session the user is connected to.
+         * @param pubkey The public key of the user in binary format.
+         */
+        connected_user(usr::user_comm_session &session, std::string_view pubkey, util::PROTOCOL protocol)
+            : pubkey(pubkey), admission(conf::cfg.user.max_msgs_per_sec),
+              upload_admission(conf::cfg.user.max_msgs_per_sec > 0 ? INPUT_UPLOAD_BYTES_PER_SEC : 0), session(session), protocol(protocol),
+              handle(std::make_shared<session_handle>(session, pubkey, protocol))
+        {
+            // Default subscriptions.
+            subscriptions[NOTIFICATION_CHANNEL::UNL_CHANGE] = false;
+            subscriptions[NOTIFICATION_CHANNEL::LEDGER_EVENT] = false;
+            subscriptions[NOTIFICATION_CHANNEL::HEALTH_STAT] = false;
+        }
+    };
+
+    /**
+     * Authenticated user list split into lock-striped shards keyed by user pubkey. Lookups of different users
+     * only contend when they land on the same shard, so user operations scale with the number of connected users
+     * instead of serializing on a single global lock.
+     */
+    class user_registry
+    {
+    private:
+        struct shard
+        {
+            std::unordered_map<std::string, connected_user> users;
+            std::mutex mutex;
+        };
+
+        std::array<shard, USER_REGISTRY_SHARD_COUNT> shards;
+        std::atomic<size_t> user_count = 0;
+
+        shard &get_shard(std::string_view pubkey);
+
+    public:
+        int add(usr::user_comm_session &session, std::string_view pubkey, const util::PROTOCOL protocol, const size_t max_users);
+        bool remove(const std::string &pubkey);
+        connected_user *find(const std::string &pubkey);
+        size_t size() const;
+        bool empty() const;
+
+        /**
+         * Invokes the given function on the specified user while holding the user's shard lock.
+         * @param pubkey Binary pubkey of the user.
+         * @param func Function to invoke with the connected_user reference.
+         * @return True if the user was found. False otherwise.
+         */
+        template <typename F>
+        bool with_user(const std::string &pubkey, F func)
+        {
+            shard &s = get_shard(pubkey);
+            std::scoped_lock<std::mutex> lock(s.mutex);
+            const auto itr = s.users.find(pubkey);
+            if (itr == s.users.end())
+                return false;
+
+            func(itr->second);
+            return true;
+        }
+
+        /**
+         * Invokes the given function on every connected user. Only one shard is locked at a time, so the
+         * iteration is not an atomic snapshot of the entire registry.
+         * @param func Function to invoke with each connected_user reference.
+         */
+        template <typename F>
+        void for_each(F func)
+        {
+            for (shard &s : shards)
+            {
+                std::scoped_lock<std::mutex> lock(s.mutex);
+                for (auto &[pubkey, user] : s.users)
+                    func(user);
+            }
+        }
+    };
+
+} // namespace usr
+
+#endif
@@ -11,12 +11,14 @@
 #include "../util/buffer_store.hpp"
 #include "../hpfs/hpfs_mount.hpp"
 #include "../status.hpp"
+#include "../metrics.hpp"
 #include "usr.hpp"
 #include "user_comm_session.hpp"
 #include "user_comm_server.hpp"
 #include "user_input.hpp"
 #include "read_req.hpp"
 #include "input_nonce_map.hpp"
+#include "user_dispatcher.hpp"
 
 namespace usr
 {
@@ -41,9 +43,11 @@ namespace usr
         metric_thresholds[3] = conf::cfg.user.max_bad_msgs_per_min;
         metric_thresholds[4] = conf::cfg.user.idle_timeout;
 
-        if (input_store.init() == -1)
+        if (input_store.init() == -1 || init_dispatcher() == -1)
             return -1;
 
+        register_metrics();
+
         // Start listening for incoming user connections only if user connection listening is enabled.
         if (conf::cfg.user.listen)
         {
@@ -59,11 +63,32 @@ namespace usr
         return 0;
     }
 
+    /**
+     * Registers user connection gauges. Values are collected from the user registry at export time.
+     */
+    void register_metrics()
+    {
+        metrics::register_gauge_callback("hp_users_connected", "No. of connected users.", []() { return (int64_t)ctx.users.size(); });
+        metrics::register_gauge_callback("hp_user_outbound_queued_bytes", "Bytes waiting in connected users' outbound queues.", []() {
+            int64_t total = 0;
+            ctx.users.for_each([&](connected_user &user) { total += user.session.get_outbound_stats().queued_bytes; });
+            return total;
+        });
+        metrics::register_gauge_callback("hp_user_outbound_dropped_msgs", "Notifications dropped for connected users due to the outbound budget.", []() {
+            int64_t total = 0;
+            ctx.users.for_each([&](connected_user &user) { total += user.session.get_outbound_stats().dropped_msgs; });
+            return total;
+        });
+    }
+
     /**
      * Cleanup any running processes.
      */
     void deinit()
     {
+        // The dispatcher is stopped before the server since it sends to the user sessions.
+        deinit_dispatcher();
+
         if (init_success)
         {
             // Stop com server only if user connections config is enabled (Otherwise server hasn't been started).
@@ -142,6 +167,16 @@ namespace usr
             std::string msg_type;
             parser.extract_type(msg_type);
 
+            // Admission control happens before any input container is extracted or decoded. Only input submissions
+            // are charged against the message rate. Upload chunks have their own byte budget and the remaining
+            // message types are bounded by the session limits.
+            if ((msg_type == msg::usrmsg::MSGTYPE_CONTRACT_INPUT || msg_type == msg::usrmsg::MSGTYPE_CONTRACT_INPUT_BEGIN) &&
+                !user.admission.try_consume())
+            {
+                reject_throttled_input(user, parser, msg::usrmsg::REASON_RATE_LIMITED, "");
+                return 0;
+            }
+
             if (msg_type == msg::usrmsg::MSGTYPE_CONTRACT_READ_REQUEST)
             {
                 // Ignore the request if contract execution is disabled or read requests disallowed.
@@ -151,9 +186,9 @@ namespace usr
                 std::string id, content;
                 if (parser.extract_read_request(id, content) != -1)
                 {
-                    if (read_req::populate_read_req_queue(user.pubkey, std::move(id), std::move(content)) == -1)
+                    if (read_req::populate_read_req_queue(user.handle, id, content) == -1)
                     {
-                        LOG_WARNING << "Failed to enqueue read request.";
+                        LOG_DEBUG << "Failed to enqueue read request from " << user.session.display_name();
                     }
                     return 0;
                 }
@@ -163,6 +198,15 @@ namespace usr
                     return -1;
                 }
             }
+            else if (msg_type == msg::usrmsg::MSGTYPE_CONTRACT_READ_CANCEL)
+            {
+                std::string id;
+                if (parser.extract_read_cancel(id) == -1 || id.empty())
+                    return -1;
+
+                read_req::cancel_read_requests(*user.handle, id);
+                return 0;
+            }
             else if (msg_type == msg::usrmsg::MSGTYPE_CONTRACT_INPUT)
             {
                 // Message is a contract input message.
@@ -171,56 +215,20 @@ namespace usr
                 std::string sig;
                 if (parser.extract_signed_input_container(input_container, sig) != -1)
                 {
-                    std::scoped_lock<std::mutex> lock(ctx.users_mutex);
+                    // Reject a container which cannot fit in the user's remaining round budget without decoding it.
+                    if (!has_round_input_budget(user, get_min_input_size(user.protocol, input_container.size())))
+                    {
+                        reject_throttled_input(user, parser, msg::usrmsg::REASON_ROUND_INPUTS_OVERFLOW, sig);
+                        return -1;
+                    }
 
-                    std::string input_data;
-                    uint64_t nonce;
-                    uint64_t max_ledger_seq_no;
-                    if (parser.extract_input_container(input_data, nonce, max_ledger_seq_no, input_container) != -1)
+                    // A streamed container only refers to input bytes by hash. So it can only be submitted by an upload.
+                    decoded_input_container decoded;
+                    if (parser.extract_input_container(decoded.input, decoded.nonce, decoded.max_ledger_seq_no, decoded.streamed, input_container) != -1 &&
+                        !decoded.streamed)
                     {
-                        const util::sequence_hash lcl_id = ledger::ctx.get_lcl_id();
-                        // Ignore the input if the max ledger seq number specified is beyond the max offeset.
-                        if (conf::cfg.contract.max_input_ledger_offset != 0 && max_ledger_seq_no > lcl_id.seq_no + conf::cfg.contract.max_input_ledger_offset)
-                        {
-                            send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_MAX_LEDGER_OFFSET_EXCEEDED, crypto::get_hash(sig));
-                            return -1;
-                        }
-
-                        // Ignore the input if our ledger has passed the input TTL.
-                        if (max_ledger_seq_no <= lcl_id.seq_no)
-                        {
-                            send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_MAX_LEDGER_EXPIRED, crypto::get_hash(sig));
-                            return -1;
-                        }
-
-                        // Check whether the newly received input is going to cause overflow of round input limit.
-                        if (conf::cfg.contract.round_limits.user_input_bytes > 0 &&
-                            (user.collected_input_size + input_data.size()) > conf::cfg.contract.round_limits.user_input_bytes)
-                        {
-                            send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_ROUND_INPUTS_OVERFLOW, crypto::get_hash(sig));
-                            return -1;
-                        }
-
-                        const int nonce_status = nonce_map.check(user.pubkey, nonce, sig, max_ledger_seq_no, true);
-                        if (nonce_status == 0)
-                        {
-                            //Add to the submitted input list.
-                            user.submitted_inputs.push_back(submitted_user_input{
-                                std::move(input_container),
-                                std::move(sig),
-                                user.protocol});
-
-                            // Increment the collected input size counter. This will be reset whenever collected inputs are moved
-                            // to concensus candidate input set.
-                            user.collected_input_size += input_data.size();
-                            return 0;
-                        }
-                        else
-                        {
-                            const char *reason = nonce_status == 1 ? msg::usrmsg::REASON_NONCE_EXPIRED : msg::usrmsg::REASON_ALREADY_SUBMITTED;
-                            send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, reason, crypto::get_hash(sig));
-                            return -1;
-                        }
+                        const size_t input_size = decoded.input.size();
+                        return queue_user_input(user, parser, std::move(input_container), std::move(sig), std::move(decoded), input_size);
                     }
                     else
                     {
@@ -230,9 +238,152 @@ namespace usr
                 }
                 else
                 {
-                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_BAD_MSG_FORMAT, crypto::get_hash(sig));
+                    // The signature could not be extracted. So there is nothing to identify the input with.
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_BAD_MSG_FORMAT, "");
+                    return -1;
+                }
+            }
+            else if (msg_type == msg::usrmsg::MSGTYPE_CONTRACT_INPUT_BEGIN)
+            {
+                std::string id;
+                uint64_t size;
+                if (parser.extract_input_upload_begin(id, size) == -1 || size == 0 || user.uploads.count(id) == 1)
+                {
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_BAD_MSG_FORMAT, "");
+                    return -1;
+                }
+
+                if (user.uploads.size() >= MAX_CONCURRENT_INPUT_UPLOADS)
+                {
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_UPLOAD_LIMIT_EXCEEDED, "");
+                    return -1;
+                }
+
+                // The whole input must be acceptable within a single round.
+                if (size > MAX_INPUT_UPLOAD_SIZE ||
+                    (conf::cfg.contract.round_limits.user_input_bytes > 0 && size > conf::cfg.contract.round_limits.user_input_bytes))
+                {
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_UPLOAD_TOO_LARGE, "");
+                    return -1;
+                }
+
+                // Reject up front if the user's remaining round budget cannot hold the upload.
+                if (!has_round_input_budget(user, size))
+                {
+                    reject_throttled_input(user, parser, msg::usrmsg::REASON_ROUND_INPUTS_OVERFLOW, "");
+                    return -1;
+                }
+
+                // Reserve the input store space up front so the chunks can be written straight into their final location.
+                const util::buffer_view stored_input = input_store.reserve_buf(size);
+                if (stored_input.is_null())
+                    return -1;
+
+                input_upload &upload = user.uploads[id];
+                upload.stored_input = stored_input;
+                upload.last_activity = util::get_epoch_milliseconds();
+                blake3_hasher_init(&upload.hasher);
+                return 0;
+            }
+            else if (msg_type == msg::usrmsg::MSGTYPE_CONTRACT_INPUT_CHUNK)
+            {
+                std::string id;
+                std::string_view data;
+                if (parser.extract_input_upload_chunk(id, data) == -1)
+                {
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_BAD_MSG_FORMAT, "");
+                    return -1;
+                }
+
+                const auto itr = user.uploads.find(id);
+                if (itr == user.uploads.end())
+                {
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_UPLOAD_NOT_FOUND, "");
+                    return -1;
+                }
+
+                input_upload &upload = itr->second;
+
+                // A dropped chunk would leave a gap in the upload. So the upload is abandoned instead.
+                if (!user.upload_admission.try_consume(std::max<uint64_t>(message.size(), MIN_INPUT_UPLOAD_CHUNK_CHARGE)))
+                {
+                    input_store.purge(upload.stored_input);
+                    user.uploads.erase(itr);
+                    reject_throttled_input(user, parser, msg::usrmsg::REASON_RATE_LIMITED, "");
+                    return 0;
+                }
+
+                if (((size_t)upload.received + data.size()) > upload.stored_input.size ||
+                    input_store.fill_buf(upload.stored_input, upload.received, data.data(), data.size()) == -1)
+                {
+                    // Abandon the upload if the user sends more than the declared size.
+                    input_store.purge(upload.stored_input);
+                    user.uploads.erase(itr);
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_UPLOAD_SIZE_MISMATCH, "");
+                    return -1;
+                }
+
+                blake3_hasher_update(&upload.hasher, data.data(), data.size());
+                upload.received += data.size();
+                upload.last_activity = util::get_epoch_milliseconds();
+                return 0;
+            }
+            else if (msg_type == msg::usrmsg::MSGTYPE_CONTRACT_INPUT_END)
+            {
+                std::string id;
+                std::string input_container;
+                std::string sig;
+                if (parser.extract_input_upload_end(id, input_container, sig) == -1)
+                {
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_BAD_MSG_FORMAT, "");
+                    return -1;
+                }
+
+                const auto itr = user.uploads.find(id);
+                if (itr == user.uploads.end())
+                {
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_UPLOAD_NOT_FOUND, crypto::get_hash(sig));
+                    return -1;
+                }
+
+                input_upload upload = itr->second;
+                user.uploads.erase(itr);
+
+                const char *reject_reason = NULL;
+                decoded_input_container decoded;
+                if (upload.received != upload.stored_input.size)
+                {
+                    reject_reason = msg::usrmsg::REASON_UPLOAD_SIZE_MISMATCH;
+                }
+                else if (parser.extract_input_container(decoded.input, decoded.nonce, decoded.max_ledger_seq_no, decoded.streamed, input_container) == -1 ||
+                         !decoded.streamed)
+                {
+                    reject_reason = msg::usrmsg::REASON_BAD_MSG_FORMAT;
+                }
+                else
+                {
+                    // The signed container must refer to the exact byte sequence we have received.
+                    std::string hash(BLAKE3_OUT_LEN, 0);
+                    blake3_hasher_finalize(&upload.hasher, reinterpret_cast<uint8_t *>(hash.data()), hash.size());
+                    if (!is_upload_hash_match(user.protocol, decoded.input, hash))
+                        reject_reason = msg::usrmsg::REASON_INPUT_HASH_MISMATCH;
+                }
+
+                if (reject_reason != NULL)
+                {
+                    input_store.purge(upload.stored_input);
+                    send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, reject_reason, crypto::get_hash(sig));
+                    return -1;
+                }
+
+                if (queue_user_input(user, parser, std::move(input_container), std::move(sig), std::move(decoded),
+                                     upload.stored_input.size, upload.stored_input) == -1)
+                {
+                    input_store.purge(upload.stored_input);
                     return -1;
                 }
+
+                return 0;
             }
             else if (msg_type == msg::usrmsg::MSGTYPE_STAT)
             {
@@ -301,35 +452,30 @@ namespace usr
         if (responses.empty())
             return;
 
-        // Lock the user sessions.
-        std::scoped_lock lock(usr::ctx.users_mutex);
-
         for (auto &[pubkey, user_responses] : responses)
         {
-            // Locate this user's socket session.
-            const auto user_itr = usr::ctx.users.find(pubkey);
-            if (user_itr != usr::ctx.users.end())
-            {
-                msg::usrmsg::usrmsg_parser parser(user_itr->second.protocol);
-
-                // Send the request status result if this user is connected to us.
-                for (const input_status_response &resp : user_responses)
-                {
-                    // We are not sending any status response for 'already submitted' inputs. This is because the user
-                    // would have gotten the proper status response during first submission.
-                    if (resp.reject_reason != msg::usrmsg::REASON_ALREADY_SUBMITTED)
-                    {
-                        send_input_status(parser,
-                                          user_itr->second.session,
-                                          resp.reject_reason == NULL ? msg::usrmsg::STATUS_ACCEPTED : msg::usrmsg::STATUS_REJECTED,
-                                          resp.reject_reason == NULL ? "" : resp.reject_reason,
-                                          resp.input_hash,
-                                          // Give priority ledger seq no/hash contained in individual responses.
-                                          resp.ledger_seq_no == 0 ? ledger_seq_no : resp.ledger_seq_no,
-                                          resp.ledger_hash == util::h32_empty ? ledger_hash : resp.ledger_hash);
-                    }
-                }
-            }
+            // Locate this user's socket session and send the request status results if this user is connected to us.
+            usr::ctx.users.with_user(pubkey, [&](const usr::connected_user &user)
+                                     {
+                                         msg::usrmsg::usrmsg_parser parser(user.protocol);
+
+                                         for (const input_status_response &resp : user_responses)
+                                         {
+                                             // We are not sending any status response for 'already submitted' inputs. This is because the user
+                                             // would have gotten the proper status response during first submission.
+                                             if (resp.reject_reason != msg::usrmsg::REASON_ALREADY_SUBMITTED)
+                                             {
+                                                 send_input_status(parser,
+                                                                   user.session,
+                                                                   resp.reject_reason == NULL ? msg::usrmsg::STATUS_ACCEPTED : msg::usrmsg::STATUS_REJECTED,
+                                                                   resp.reject_reason == NULL ? "" : resp.reject_reason,
+                                                                   resp.input_hash,
+                                                                   // Give priority ledger seq no/hash contained in individual responses.
+                                                                   resp.ledger_seq_no == 0 ? ledger_seq_no : resp.ledger_seq_no,
+                                                                   resp.ledger_hash == util::h32_empty ? ledger_hash : resp.ledger_hash);
+                                             }
+                                         }
+                                     });
         }
     }
 
@@ -345,6 +491,145 @@ namespace usr
         session.send(msg);
     }
 
+    /**
+     * Checks a newly submitted input against the submission criteria and queues it to be broadcast with the next NUP.
+     * The user is informed if the input is rejected.
+     * @param user The user who submitted the input.
+     * @param parser Parser of the user's protocol.
+     * @param input_container The signed input container.
+     * @param sig User signature of the input container.
+     * @param decoded Decoded input container fields.
+     * @param input_size Size of the input bytes.
+     * @param stored_input Input store location of a chunk uploaded input. Null view for regular inputs.
+     * @return 0 if the input was queued. -1 if the input was rejected.
+     */
+    int queue_user_input(connected_user &user, const msg::usrmsg::usrmsg_parser &parser, std::string &&input_container, std::string &&sig,
+                         decoded_input_container &&decoded, const size_t input_size, const util::buffer_view stored_input)
+    {
+        std::scoped_lock<std::mutex> lock(user.inputs_mutex);
+
+        const uint64_t max_ledger_seq_no = decoded.max_ledger_seq_no;
+
+        const util::sequence_hash lcl_id = ledger::ctx.get_lcl_id();
+        // Ignore the input if the max ledger seq number specified is beyond the max offeset.
+        if (conf::cfg.contract.max_input_ledger_offset != 0 && max_ledger_seq_no > lcl_id.seq_no + conf::cfg.contract.max_input_ledger_offset)
+        {
+            send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_MAX_LEDGER_OFFSET_EXCEEDED, crypto::get_hash(sig));
+            return -1;
+        }
+
+        // Ignore the input if our ledger has passed the input TTL.
+        if (max_ledger_seq_no <= lcl_id.seq_no)
+        {
+            send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, msg::usrmsg::REASON_MAX_LEDGER_EXPIRED, crypto::get_hash(sig));
+            return -1;
+        }
+
+        // Check whether the newly received input is going to cause overflow of round input limit.
+        if (conf::cfg.contract.round_limits.user_input_bytes > 0 &&
+            (user.collected_input_size + input_size) > conf::cfg.contract.round_limits.user_input_bytes)
+        {
+            reject_throttled_input(user, parser, msg::usrmsg::REASON_ROUND_INPUTS_OVERFLOW, sig);
+            return -1;
+        }
+
+        const int nonce_status = nonce_map.check(user.pubkey, decoded.nonce, sig, max_ledger_seq_no, true);
+        if (nonce_status != 0)
+        {
+            const char *reason = nonce_status == 1 ? msg::usrmsg::REASON_NONCE_EXPIRED : msg::usrmsg::REASON_ALREADY_SUBMITTED;
+            send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, reason, crypto::get_hash(sig));
+            return -1;
+        }
+
+        // Increment the collected input size counter. This will be reset whenever collected inputs are moved
+        // to concensus candidate input set.
+        user.collected_input_size += input_size;
+        user.throttle_notified = false;
+
+        // Add to the submitted input list along with the decoded container fields.
+        submitted_user_input &submitted = user.submitted_inputs.emplace_back(submitted_user_input{
+            std::move(input_container),
+            std::move(sig),
+            user.protocol,
+            std::move(decoded)});
+
+        if (!stored_input.is_null())
+        {
+            submitted.streamed = true;
+            submitted.stored_input = stored_input;
+        }
+
+        return 0;
+    }
+
+    /**
+     * Returns the smallest input size a signed input container of the given size can hold. The container holds the
+     * input along with a few small fields. Json containers may escape each input byte with up to 6 characters.
+     * @param protocol Message protocol of the container.
+     * @param container_size Size of the serialized input container.
+     * @return Lower bound of the input size in bytes.
+     */
+    size_t get_min_input_size(const util::PROTOCOL protocol, const size_t container_size)
+    {
+        if (container_size <= MAX_INPUT_CONTAINER_OVERHEAD)
+            return 0;
+
+        const size_t min_size = container_size - MAX_INPUT_CONTAINER_OVERHEAD;
+        return protocol == util::PROTOCOL::JSON ? (min_size / 6) : min_size;
+    }
+
+    /**
+     * Checks whether the given no. of input bytes fit within the user's remaining input budget for the round.
+     * Users exceeding their budget are marked as throttled.
+     * @param user The user submitting the input.
+     * @param input_size Input size in bytes.
+     * @return True if the input fits. False otherwise.
+     */
+    bool has_round_input_budget(connected_user &user, const size_t input_size)
+    {
+        if (conf::cfg.contract.round_limits.user_input_bytes == 0)
+            return true;
+
+        std::scoped_lock<std::mutex> lock(user.inputs_mutex);
+        if ((user.collected_input_size + input_size) > conf::cfg.contract.round_limits.user_input_bytes)
+        {
+            user.throttled = true;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Drops an input which exceeded the user's admission limits and marks the user as throttled. Only the first dropped
+     * input since the user last had an input accepted is answered. So a flooding user does not get (and we do not
+     * compute) a reply for every dropped message.
+     * @param user The user submitting the input.
+     * @param parser Parser of the user's protocol.
+     * @param reason Rejection reason.
+     * @param sig User signature of the input container if available. Its hash identifies the input in the reply.
+     */
+    void reject_throttled_input(connected_user &user, const msg::usrmsg::usrmsg_parser &parser, const char *reason, std::string_view sig)
+    {
+        user.throttled = true;
+        if (user.throttle_notified)
+            return;
+
+        user.throttle_notified = true;
+        send_input_status(parser, user.session, msg::usrmsg::STATUS_REJECTED, reason, sig.empty() ? "" : crypto::get_hash(sig));
+    }
+
+    /**
+     * Checks whether the input field of a chunk uploaded input container refers to the given hash of the uploaded bytes.
+     * Json containers hold the hash as hex since json inputs are strings. Binary protocols hold the raw hash.
+     */
+    bool is_upload_hash_match(const util::PROTOCOL protocol, std::string_view container_input, std::string_view hash)
+    {
+        if (protocol == util::PROTOCOL::JSON)
+            return container_input == util::to_hex(hash);
+        else
+            return container_input == hash;
+    }
+
     /**
      * Adds the user denoted by specified session id and public key to the global authed user list.
      * This should get called after the challenge handshake is verified.
@@ -356,44 +641,75 @@ namespace usr
      */
     int add_user(usr::user_comm_session &session, const std::string &pubkey_hex, std::string_view protocol_code)
     {
-        // If max number of user connections reached skip the rest.
-        if (ctx.users.size() == MAX_USER_COUNT)
+        // Decode hex pubkey and get binary pubkey.
+        const std::string pubkey = util::to_bin(pubkey_hex);
+        const util::PROTOCOL protocol = protocol_code == "json"   ? util::PROTOCOL::JSON
+                                        : protocol_code == "bson" ? util::PROTOCOL::BSON
+                                                                  : util::PROTOCOL::FLATBUF;
+
+        // The registry enforces the configured user cap (0 means unlimited) and rejects duplicate public keys.
+        const int res = ctx.users.add(session, pubkey, protocol, conf::cfg.user.max_connections);
+        if (res == -1)
         {
             LOG_DEBUG << "Rejecting " + session.display_name() << ". Maximum user count reached.";
             return -1;
         }
-
-        // Decode hex pubkey and get binary pubkey.
-        const std::string pubkey = util::to_bin(pubkey_hex);
-
-        // Acquire user list lock.
-        std::scoped_lock<std::mutex> lock(ctx.users_mutex);
-
-        // Now check whether this user public key is a duplicate.
-        if (ctx.users.count(pubkey) == 0)
+        else if (res == 1)
         {
-            // All good. Unique public key.
-            // Promote the connection from pending-challenges to authenticated users.
+            LOG_DEBUG << "Duplicate user public key " << session.display_name();
+            return 0;
+        }
 
-            const util::PROTOCOL protocol = (protocol_code == "json" ? util::PROTOCOL::JSON : util::PROTOCOL::BSON);
+        // All good. Unique public key.
+        // Promote the connection from pending-challenges to authenticated users.
+        session.mark_as_verified();       // Mark connection as a verified connection.
+        session.issued_challenge.clear(); // Remove the stored challenge
+        session.uniqueid = pubkey_hex;
+        session.pubkey = pubkey;
+        LOG_DEBUG << "User connection authenticated. Public key " << pubkey_hex;
 
-            session.mark_as_verified();       // Mark connection as a verified connection.
-            session.issued_challenge.clear(); // Remove the stored challenge
-            session.uniqueid = pubkey_hex;
-            session.pubkey = pubkey;
+        return 0;
+    }
 
-            // Add the user to the global authed user list
-            ctx.users.emplace(pubkey, usr::connected_user(session, pubkey, protocol));
-            LOG_DEBUG << "User connection authenticated. Public key " << pubkey_hex;
-        }
-        else
+    /**
+     * Runs on the user message processing thread. Used to periodically abandon idle input uploads.
+     */
+    int user_comm_server::process_custom_messages()
+    {
+        const uint64_t time_now = util::get_epoch_milliseconds();
+        if (time_now - last_upload_sweep >= 1000)
         {
-            LOG_DEBUG << "Duplicate user public key " << session.display_name();
+            last_upload_sweep = time_now;
+            expire_idle_uploads();
         }
-
         return 0;
     }
 
+    /**
+     * Abandons unfinished input uploads which have been idle for longer than the upload idle timeout, so connected
+     * users cannot hold input store space indefinitely. Must be called from the user message processing thread
+     * since that's the only thread accessing the uploads.
+     */
+    void expire_idle_uploads()
+    {
+        const uint64_t time_now = util::get_epoch_milliseconds();
+        ctx.users.for_each([&](connected_user &user)
+                           {
+                               for (auto itr = user.uploads.begin(); itr != user.uploads.end();)
+                               {
+                                   if (time_now - itr->second.last_activity < INPUT_UPLOAD_IDLE_TIMEOUT)
+                                   {
+                                       itr++;
+                                       continue;
+                                   }
+
+                                   LOG_DEBUG << "Abandoned idle input upload of " << user.session.display_name();
+                                   input_store.purge(itr->second.stored_input);
+                                   itr = user.uploads.erase(itr);
+                               }
+                           });
+    }
+
     /**
      * Removes the specified public key from the global user list.
      * This must get called when an authenticated user disconnects from HP.
@@ -403,29 +719,110 @@ namespace usr
      */
     int remove_user(const std::string &pubkey)
     {
-        std::scoped_lock<std::mutex> lock(ctx.users_mutex);
-        ctx.users.erase(pubkey);
+        std::shared_ptr<session_handle> handle;
+
+        // Release the input store space held by any unfinished input uploads and by completed uploads which
+        // haven't been relayed yet. Those inputs are discarded along with the user.
+        ctx.users.with_user(pubkey, [&](connected_user &user)
+                            {
+                                for (const auto &[id, upload] : user.uploads)
+                                    input_store.purge(upload.stored_input);
+
+                                {
+                                    std::scoped_lock<std::mutex> lock(user.inputs_mutex);
+                                    for (const submitted_user_input &submitted : user.submitted_inputs)
+                                    {
+                                        if (!submitted.stored_input.is_null())
+                                            input_store.purge(submitted.stored_input);
+                                    }
+
+                                    // Cleared so the input relay cannot pick up the purged inputs before the user is removed.
+                                    user.submitted_inputs.clear();
+                                    user.collected_input_size = 0;
+                                }
+
+                                handle = user.handle;
+                            });
+
+        // Stop sending replies to the session and abandon any read requests of the user.
+        if (handle)
+        {
+            handle->close();
+            read_req::cancel_read_requests(*handle);
+        }
+
+        ctx.users.remove(pubkey);
         return 0;
     }
 
-    const char *extract_submitted_input(const std::string &user_pubkey, const usr::submitted_user_input &submitted, usr::extracted_user_input &extracted)
+    /**
+     * Verifies the signature of a submitted input and extracts the input container fields.
+     * The signature is always verified over the raw container bytes. The container is only decoded if it hasn't
+     * already been decoded at the time of submission to this node.
+     * @return The rejection reason if input rejected. NULL if the input was extracted successfully.
+     */
+    const char *extract_submitted_input(const std::string &user_pubkey, usr::submitted_user_input &submitted, usr::extracted_user_input &extracted)
     {
         // Verify the signature of the submitted input_container.
-        if (crypto::verify(submitted.input_container, submitted.sig, user_pubkey) == -1)
+        if (crypto::verify_cached(submitted.input_container, submitted.sig, user_pubkey) == -1)
         {
             LOG_DEBUG << "User input bad signature.";
             return msg::usrmsg::REASON_BAD_SIG;
         }
 
-        // Extract information from input container.
-        msg::usrmsg::usrmsg_parser parser(submitted.protocol);
-        if (parser.extract_input_container(extracted.input, extracted.nonce, extracted.max_ledger_seq_no, submitted.input_container) == -1)
+        bool signed_streamed = false;
+        if (submitted.decoded)
         {
-            LOG_DEBUG << "User input bad input container format.";
+            // Container has already been decoded when the user submitted it to us.
+            extracted.input = std::move(submitted.decoded->input);
+            extracted.nonce = submitted.decoded->nonce;
+            extracted.max_ledger_seq_no = submitted.decoded->max_ledger_seq_no;
+            signed_streamed = submitted.decoded->streamed;
+            submitted.decoded.reset();
+        }
+        else
+        {
+            // Extract information from input container.
+            msg::usrmsg::usrmsg_parser parser(submitted.protocol);
+            if (parser.extract_input_container(extracted.input, extracted.nonce, extracted.max_ledger_seq_no, signed_streamed, submitted.input_container) == -1)
+            {
+                LOG_DEBUG << "User input bad input container format.";
+                return msg::usrmsg::REASON_BAD_MSG_FORMAT;
+            }
+        }
+
+        // Whether the input bytes travel alongside the container is not covered by the user signature. A relaying peer
+        // could strip or attach them, so it must agree with the signed flag. Otherwise this node would execute the
+        // hash as the input while other nodes execute the uploaded bytes under the same ordered hash.
+        if (signed_streamed != submitted.streamed)
+        {
+            LOG_DEBUG << "User input streamed flag mismatch.";
             return msg::usrmsg::REASON_BAD_MSG_FORMAT;
         }
 
-        extracted.sig = std::move(submitted.sig);
+        if (submitted.streamed)
+        {
+            // The container of a chunk uploaded input holds the hash of the input bytes.
+            if (submitted.stored_input.is_null())
+            {
+                // Input was relayed by a peer. Verify the received bytes are the ones the user signed for.
+                if (!is_upload_hash_match(submitted.protocol, extracted.input, crypto::get_hash(submitted.streamed_input)))
+                {
+                    LOG_DEBUG << "User input hash mismatch.";
+                    return msg::usrmsg::REASON_INPUT_HASH_MISMATCH;
+                }
+
+                extracted.input = std::move(submitted.streamed_input);
+            }
+            else
+            {
+                // Input was uploaded to us and its hash was verified when the upload completed.
+                extracted.input.clear();
+                extracted.stored_input = submitted.stored_input;
+            }
+        }
+
+        extracted.sig = submitted.sig;
 
         return NULL;
     }
@@ -435,14 +832,16 @@ namespace usr
      * @return The rejection reason if input rejected. NULL if the input can be accepted.
      */
     const char *validate_user_input_submission(const std::string &user_pubkey, const usr::extracted_user_input &extracted_input,
-                                               const uint64_t lcl_seq_no, size_t &total_input_size, std::string &ordered_hash, util::buffer_view &input)
+                                               const uint64_t lcl_seq_no, size_t &total_input_size, util::h40 &ordered_hash, util::buffer_view &input)
     {
         // Ordered hash is used as the globally unqiue 'key' to represent this input for this consensus round.
         // It is prefixed with the nonce to support user-defined sort order and the input hash is appended
         // to make it unique among inputs from all users.
         // Ordered hash = nonce (8 bytes) + input hash (32 bytes)
         // In the ledger, we will store the nonce and input hash separately.
-        ordered_hash = util::uint64_to_string_bytes(extracted_input.nonce) + crypto::get_hash(extracted_input.sig);
+        util::uint64_to_bytes(ordered_hash.data, extracted_input.nonce);
+        const std::string sig_hash = crypto::get_hash(extracted_input.sig);
+        memcpy(ordered_hash.data + sizeof(uint64_t), sig_hash.data(), BLAKE3_OUT_LEN);
 
         // Ignore the input if the max ledger seq number specified is beyond the max offeset.
         if (conf::cfg.contract.max_input_ledger_offset != 0 && extracted_input.max_ledger_seq_no > lcl_seq_no + conf::cfg.contract.max_input_ledger_offset)
@@ -459,7 +858,7 @@ namespace usr
         }
 
         // Check subtotal of inputs extracted so far with the input size limit.
-        const size_t new_total_input_size = total_input_size + extracted_input.input.size();
+        const size_t new_total_input_size = total_input_size + extracted_input.input_size();
         if (conf::cfg.contract.round_limits.user_input_bytes > 0 &&
             new_total_input_size > conf::cfg.contract.round_limits.user_input_bytes)
         {
@@ -477,7 +876,11 @@ namespace usr
         // Reaching here means the input is successfully validated and we can submit it to consensus.
 
         // Copy the input data into the input store. Contract will read the input from this location.
-        input = input_store.write_buf(extracted_input.input.data(), extracted_input.input.size());
+        // Chunk uploaded inputs are already in the input store.
+        if (extracted_input.stored_input.is_null())
+            input = input_store.write_buf(extracted_input.input.data(), extracted_input.input.size());
+        else
+            input = extracted_input.stored_input;
 
         // Increment the total valid input size so far.
         total_input_size = new_total_input_size;
@@ -485,81 +888,4 @@ namespace usr
         return NULL; // Success. No reject reason.
     }
 
-    /**
-     * Sends any change event notifications to relevant users who are currently connected to the node.
-     */
-    void dispatch_change_events()
-    {
-        status::change_event ev;
-        while (status::event_queue.try_dequeue(ev))
-        {
-            // Array to hold constructed message cache from each protocol.
-            std::vector<uint8_t> protocol_msgs[2];
-
-            if (ev.index() == 0) // UNL change event. Broadcast for subscribed users.
-            {
-                std::scoped_lock<std::mutex> lock(ctx.users_mutex);
-                for (auto &[sid, user] : ctx.users)
-                {
-                    if (user.subscriptions[NOTIFICATION_CHANNEL::UNL_CHANGE])
-                    {
-                        std::vector<uint8_t> &msg = protocol_msgs[user.protocol];
-                        if (msg.empty()) // Construct the message with relevant protocol if not done so already.
-                        {
-                            msg::usrmsg::usrmsg_parser parser(user.protocol);
-                            const status::unl_change_event &unl_ev = std::get<status::unl_change_event>(ev);
-                            parser.create_unl_notification(msg, unl_ev.unl);
-                        }
-                        user.session.send(msg);
-                    }
-                }
-            }
-            else if (ev.index() == 1 || ev.index() == 2) // Ledger events. Broadcast for subscribed users.
-            {
-                std::scoped_lock<std::mutex> lock(ctx.users_mutex);
-                for (auto &[sid, user] : ctx.users)
-                {
-                    if (user.subscriptions[NOTIFICATION_CHANNEL::LEDGER_EVENT])
-                    {
-                        std::vector<uint8_t> &msg = protocol_msgs[user.protocol];
-                        if (msg.empty()) // Construct the message with relevant protocol if not done so already.
-                        {
-                            msg::usrmsg::usrmsg_parser parser(user.protocol);
-
-                            if (ev.index() == 1) // Ledger created event.
-                            {
-                                const status::ledger_created_event &ledger_ev = std::get<status::ledger_created_event>(ev);
-                                parser.create_ledger_created_notification(msg, ledger_ev.ledger);
-                            }
-                            else if (ev.index() == 2) // Vote status chnge event.
-                            {
-                                const status::vote_status_change_event &vote_ev = std::get<status::vote_status_change_event>(ev);
-                                parser.create_vote_status_notification(msg, vote_ev.vote_status);
-                            }
-                        }
-                        user.session.send(msg);
-                    }
-                }
-            }
-            else if (ev.index() == 3) // Health events. Broadcast for subscribed users.
-            {
-                std::scoped_lock<std::mutex> lock(ctx.users_mutex);
-                for (auto &[sid, user] : ctx.users)
-                {
-                    if (user.subscriptions[NOTIFICATION_CHANNEL::HEALTH_STAT])
-                    {
-                        std::vector<uint8_t> &msg = protocol_msgs[user.protocol];
-                        if (msg.empty()) // Construct the message with relevant protocol if not done so already.
-                        {
-                            msg::usrmsg::usrmsg_parser parser(user.protocol);
-                            const status::health_event &health_ev = std::get<status::health_event>(ev);
-                            parser.create_health_notification(msg, health_ev);
-                        }
-                        user.session.send(msg);
-                    }
-                }
-            }
-        }
-    }
-
 } // namespace usr
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "../pchheader.hpp"
 #include "../util/util.hpp"
 #include "../util/h32.hpp"
+#include "../util/fixed_bytes.hpp"
 #include "../util/rollover_hashset.hpp"
 #include "../util/buffer_store.hpp"
 #include "../msg/usrmsg_parser.hpp"
@@ -11,62 +12,20 @@
 #include "user_comm_server.hpp"
 #include "user_input.hpp"
 #include "user_common.hpp"
+#include "user_registry.hpp"
 
 /**
  * Maintains the global user list with pending input outputs and manages user connections.
  */
 namespace usr
 {
-    constexpr uint16_t MAX_USER_COUNT = 64; // Maximum number of user.
-
-    /**
-     * Holds information about an authenticated (challenge-verified) user
-     * connected to the HotPocket node.
-     */
-    struct connected_user
-    {
-        // User binary public key
-        const std::string pubkey;
-
-        // Holds the unprocessed user inputs collected from websocket.
-        std::list<submitted_user_input> submitted_inputs;
-
-        // Total input bytes collected which are pending to be subjected to consensus.
-        size_t collected_input_size = 0;
-
-        // User's notification subscription toggles.
-        bool subscriptions[3];
-
-        // Holds the websocket session of this user.
-        // We don't need to own the session object since the lifetime of user and session are coupled.
-        usr::user_comm_session &session;
-
-        // The messaging protocol used by this user.
-        const util::PROTOCOL protocol = util::PROTOCOL::JSON;
-
-        /**
-         * @param session The web socket session the user is connected to.
-         * @param pubkey The public key of the user in binary format.
-         */
-        connected_user(usr::user_comm_session &session, std::string_view pubkey, util::PROTOCOL protocol)
-            : pubkey(pubkey), session(session), protocol(protocol)
-        {
-            // Default subscriptions.
-            subscriptions[NOTIFICATION_CHANNEL::UNL_CHANGE] = false;
-            subscriptions[NOTIFICATION_CHANNEL::LEDGER_EVENT] = false;
-            subscriptions[NOTIFICATION_CHANNEL::HEALTH_STAT] = false;
-        }
-    };
-
     /**
      * The context struct to hold global connected-users and related objects.
      */
     struct connected_context
     {
-        // Connected (authenticated) user list.
-        // Map key: User pubkey. Value: User info object.
-        std::unordered_map<std::string, usr::connected_user> users;
-        std::mutex users_mutex; // Mutex for users access race conditions.
+        // Connected (authenticated) user list keyed by user pubkey.
+        usr::user_registry users;
 
         std::optional<usr::user_comm_server> server;
     };
@@ -84,6 +43,8 @@ namespace usr
 
     int init();
 
+    void register_metrics();
+
     void deinit();
 
     int start_listening();
@@ -99,16 +60,27 @@ namespace usr
                            std::string_view status, std::string_view reason, std::string_view input_hash,
                            const uint64_t ledger_seq_no = 0, const util::h32 &ledger_hash = util::h32_empty);
 
+    int queue_user_input(connected_user &user, const msg::usrmsg::usrmsg_parser &parser, std::string &&input_container, std::string &&sig,
+                         decoded_input_container &&decoded, const size_t input_size, const util::buffer_view stored_input = {0, 0});
+
+    size_t get_min_input_size(const util::PROTOCOL protocol, const size_t container_size);
+
+    bool has_round_input_budget(connected_user &user, const size_t input_size);
+
+    void reject_throttled_input(connected_user &user, const msg::usrmsg::usrmsg_parser &parser, const char *reason, std::string_view sig);
+
+    bool is_upload_hash_match(const util::PROTOCOL protocol, std::string_view container_input, std::string_view hash);
+
+    void expire_idle_uploads();
+
     int add_user(usr::user_comm_session &session, const std::string &user_pubkey_hex, std::string_view protocol_code);
 
     int remove_user(const std::string &pubkey);
 
-    const char *extract_submitted_input(const std::string &user_pubkey, const usr::submitted_user_input &submitted, usr::extracted_user_input &extracted);
+    const char *extract_submitted_input(const std::string &user_pubkey, usr::submitted_user_input &submitted, usr::extracted_user_input &extracted);
 
     const char *validate_user_input_submission(const std::string &user_pubkey, const usr::extracted_user_input &extracted_input,
-                                               const uint64_t lcl_seq_no, size_t &total_input_size, std::string &ordered_hash, util::buffer_view &input);
-
-    void dispatch_change_events();
+                                               const uint64_t lcl_seq_no, size_t &total_input_size, util::h40 &ordered_hash, util::buffer_view &input);
 
 } // namespace usr
 
@@ -0,0 +1,82 @@
+#include "arena.hpp"
+
+namespace util
+{
+    counting_resource::counting_resource(std::pmr::memory_resource *upstream) : upstream(upstream)
+    {
+    }
+
+    void *counting_resource::do_allocate(size_t bytes, size_t alignment)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        allocated_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        return upstream->allocate(bytes, alignment);
+    }
+
+    void counting_resource::do_deallocate(void *p, size_t bytes, size_t alignment)
+    {
+        upstream->deallocate(p, bytes, alignment);
+    }
+
+    bool counting_resource::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+    {
+        return this == &other;
+    }
+
+    uint64_t counting_resource::get_allocations() const
+    {
+        return allocations.load(std::memory_order_relaxed);
+    }
+
+    uint64_t counting_resource::get_allocated_bytes() const
+    {
+        return allocated_bytes.load(std::memory_order_relaxed);
+    }
+
+    arena::arena(const size_t buffer_size)
+        : buffer(buffer_size),
+          upstream(std::pmr::new_delete_resource()),
+          monotonic(buffer.data(), buffer.size(), &upstream),
+          resource(&monotonic)
+    {
+    }
+
+    /**
+     * Returns the memory resource to be used with pmr containers.
+     */
+    std::pmr::memory_resource *arena::get()
+    {
+        return &resource;
+    }
+
+    /**
+     * Reclaims all memory handed out by the arena. Any objects allocated from the arena must already be destroyed.
+     * Subsequent allocations are served from the start of the preallocated buffer again.
+     */
+    void arena::reset()
+    {
+        monotonic.release();
+    }
+
+    /**
+     * Returns the total no. of allocations served by the arena.
+     */
+    uint64_t arena::get_allocations() const
+    {
+        return resource.get_allocations();
+    }
+
+    /**
+     * Returns the total no. of heap allocations the arena had to make because the buffer was exhausted.
+     */
+    uint64_t arena::get_upstream_allocations() const
+    {
+        return upstream.get_allocations();
+    }
+
+    uint64_t arena::get_upstream_bytes() const
+    {
+        return upstream.get_allocated_bytes();
+    }
+
+} // namespace util
@@ -0,0 +1,55 @@
+#ifndef _HP_UTIL_ARENA_
+#define _HP_UTIL_ARENA_
+
+#include "../pchheader.hpp"
+
+namespace util
+{
+
+    /**
+     * Memory resource which forwards to an upstream resource and counts the allocations made through it.
+     */
+    class counting_resource : public std::pmr::memory_resource
+    {
+    private:
+        std::pmr::memory_resource *upstream;
+        // Counters are atomic so they can be read from other threads for reporting.
+        std::atomic<uint64_t> allocations = 0;
+        std::atomic<uint64_t> allocated_bytes = 0;
+
+    protected:
+        void *do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+    public:
+        counting_resource(std::pmr::memory_resource *upstream);
+        uint64_t get_allocations() const;
+        uint64_t get_allocated_bytes() const;
+    };
+
+    /**
+     * Monotonic allocation arena for short-lived working sets. Allocations are served from a preallocated buffer
+     * and fall back to the heap only when the buffer is exhausted. Deallocations are no-ops and all memory is
+     * reclaimed at once with reset(). Not thread-safe.
+     */
+    class arena
+    {
+    private:
+        std::vector<std::byte> buffer;
+        counting_resource upstream;                       // Heap allocations made when the buffer is exhausted.
+        std::pmr::monotonic_buffer_resource monotonic;
+        counting_resource resource;                       // Allocations served to the arena users.
+
+    public:
+        arena(const size_t buffer_size);
+        std::pmr::memory_resource *get();
+        void reset();
+        uint64_t get_allocations() const;
+        uint64_t get_upstream_allocations() const;
+        uint64_t get_upstream_bytes() const;
+    };
+
+} // namespace util
+
+#endif
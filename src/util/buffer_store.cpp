@@ -5,6 +5,9 @@
 #define BLOCK_SIZE 4096
 #define BLOCK_ALIGN(x) (((x) + ((typeof(x))(BLOCK_SIZE)-1)) & ~((typeof(x))(BLOCK_SIZE)-1))
 
+// Alignment of packed buffers within a segment.
+#define PACK_ALIGN(x) (((x) + 7) & ~((typeof(x))7))
+
 namespace util
 {
     int buffer_store::init()
@@ -20,26 +23,59 @@ namespace util
         return 0;
     }
 
+    /**
+     * Copies the given buffer into the store.
+     * @param buf Buffer to copy.
+     * @param size Buffer size.
+     * @return The view representing the stored location within the memfd. Null view on error.
+     */
     const buffer_view buffer_store::write_buf(const void *buf, const uint32_t size)
     {
+        std::scoped_lock<std::mutex> lock(segments_mutex);
+
         buffer_view view = {0, 0};
-        ssize_t res = pwrite(fd, buf, size, next_write_pos);
-        if (res < size)
-        {
-            LOG_ERROR << errno << ": Error writing to buffer store fd " << fd;
-            return view;
-        }
-        else
-        {
-            view.offset = next_write_pos;
-            view.size = size;
+        uint8_t *mem = allocate(size, view);
+        if (mem)
+            memcpy(mem, buf, size);
+
+        return view;
+    }
+
+    /**
+     * Reserves room for a buffer whose content is filled in later (eg. as it arrives over the network) using fill_buf().
+     * @param size Buffer size.
+     * @return The view representing the reserved location within the memfd. Null view on error.
+     */
+    const buffer_view buffer_store::reserve_buf(const uint32_t size)
+    {
+        std::scoped_lock<std::mutex> lock(segments_mutex);
+
+        buffer_view view = {0, 0};
+        allocate(size, view);
+        return view;
+    }
 
-            // Get nearest block offset that occurs after the just-written buffer.
-            next_write_pos += size;
-            next_write_pos = BLOCK_ALIGN(next_write_pos);
+    /**
+     * Copies the given data into a part of a previously reserved buffer.
+     * @param view The reserved buffer.
+     * @param pos Position within the reserved buffer to copy the data to.
+     * @param buf Data to copy.
+     * @param size Data size.
+     * @return 0 on success. -1 on failure.
+     */
+    int buffer_store::fill_buf(const buffer_view &view, const size_t pos, const void *buf, const size_t size)
+    {
+        std::scoped_lock<std::mutex> lock(segments_mutex);
 
-            return view;
+        const buffer_segment *segment = find_segment(view);
+        if (!segment || (pos + size) > view.size)
+        {
+            LOG_ERROR << "Error filling buffer store fd " << fd << " (" << view.offset << "," << view.size << ") at " << pos;
+            return -1;
         }
+
+        memcpy(segment->mem + (view.offset - segment->offset) + pos, buf, size);
+        return 0;
     }
 
     /**
@@ -50,31 +86,196 @@ namespace util
      */
     int buffer_store::read_buf(const buffer_view &view, std::string &buf)
     {
-        buf.resize(view.size);
-        const ssize_t res = pread(fd, buf.data(), view.size, view.offset);
-        if (res < view.size)
+        const std::string_view sv = view_buf(view);
+        if (sv.size() < view.size)
         {
-            LOG_ERROR << errno << ": Error reading from buffer store fd " << fd;
+            LOG_ERROR << "Error reading from buffer store fd " << fd << " (" << view.offset << "," << view.size << ")";
+            return -1;
         }
-        return res;
+
+        buf = sv;
+        return sv.size();
+    }
+
+    /**
+     * Returns a view of the stored buffer content without copying. The view remains valid until the buffer is purged.
+     * @param view The buffer_view that should be accessed.
+     * @return String view of the buffer content. Empty view if the buffer is not found.
+     */
+    std::string_view buffer_store::view_buf(const buffer_view &view)
+    {
+        std::scoped_lock<std::mutex> lock(segments_mutex);
+
+        const buffer_segment *segment = find_segment(view);
+        if (!segment)
+            return std::string_view();
+
+        return std::string_view(reinterpret_cast<const char *>(segment->mem + (view.offset - segment->offset)), view.size);
     }
 
+    /**
+     * Marks the given buffer as no longer needed. The underlying memory is released when all the buffers in
+     * the same segment have been purged.
+     * @return 0 on success. -1 on failure.
+     */
     int buffer_store::purge(const buffer_view &buf)
     {
-        const size_t purge_size = BLOCK_ALIGN(buf.size);
-        if (fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, buf.offset, purge_size) == -1 &&
-            errno != EBADF) // errno=EBADF is ignored, since if the memfd is closed, we don't need to cleanup anyway.
+        std::scoped_lock<std::mutex> lock(segments_mutex);
+
+        buffer_segment *segment = find_segment(buf);
+        if (!segment || segment->live_count == 0)
         {
-            LOG_ERROR << errno << ": Error when purging buffer store fd " << fd << " (" << buf.offset << "," << buf.size << ")";
+            LOG_ERROR << "Error when purging buffer store fd " << fd << " (" << buf.offset << "," << buf.size << "). Segment not found.";
             return -1;
         }
+
+        segment->live_count--;
+        if (segment->live_count == 0 && segment->sealed)
+            release_segment(*segment);
+
         return 0;
     }
 
+    /**
+     * Starts a new buffer generation (eg. a new consensus round). Subsequent buffers are packed into a fresh segment
+     * so that buffers with similar lifetimes share segments and get released together.
+     */
+    void buffer_store::new_generation()
+    {
+        std::scoped_lock<std::mutex> lock(segments_mutex);
+
+        if (active_segment)
+        {
+            active_segment->sealed = true;
+            if (active_segment->live_count == 0)
+                release_segment(*active_segment);
+            active_segment = NULL;
+        }
+    }
+
     void buffer_store::deinit()
     {
+        std::scoped_lock<std::mutex> lock(segments_mutex);
+
+        for (auto &[offset, segment] : segments)
+            munmap(segment.mem, segment.size);
+        segments.clear();
+        active_segment = NULL;
+
         if (fd > 0)
             close(fd);
     }
 
-} // namespace util
\ No newline at end of file
+    /**
+     * Allocates room for a buffer of the given size. Must be called while holding the segments lock.
+     * @param size Buffer size.
+     * @param view The view representing the allocated location within the memfd.
+     * @return Memory mapped address of the allocated buffer. NULL on error.
+     */
+    uint8_t *buffer_store::allocate(const uint32_t size, buffer_view &view)
+    {
+        buffer_segment *segment = NULL;
+        if (size > BUFFER_SEGMENT_MAX_PACKED_SIZE)
+        {
+            // Large buffers get their own segment which is sealed straight away.
+            segment = create_segment(BLOCK_ALIGN((size_t)size));
+            if (!segment)
+                return NULL;
+            segment->sealed = true;
+        }
+        else
+        {
+            // Start a new packing segment if the current one doesn't have enough room.
+            if (!active_segment || (active_segment->write_pos + size) > active_segment->size)
+            {
+                if (active_segment)
+                {
+                    active_segment->sealed = true;
+                    if (active_segment->live_count == 0)
+                        release_segment(*active_segment);
+                    active_segment = NULL;
+                }
+
+                active_segment = create_segment(BUFFER_SEGMENT_SIZE);
+                if (!active_segment)
+                    return NULL;
+            }
+
+            segment = active_segment;
+        }
+
+        uint8_t *mem = segment->mem + segment->write_pos;
+        view = {(off_t)(segment->offset + segment->write_pos), size};
+        segment->write_pos = PACK_ALIGN(segment->write_pos + size);
+        segment->live_count++;
+
+        return mem;
+    }
+
+    /**
+     * Allocates and maps a new segment at the end of the memfd. Segment offsets are never reused, so any offsets
+     * handed out earlier remain unambiguous.
+     * @param size Segment size. Must be block aligned.
+     * @return Pointer to the new segment. NULL on error.
+     */
+    buffer_segment *buffer_store::create_segment(const size_t size)
+    {
+        const off_t offset = next_segment_pos;
+        if (ftruncate(fd, offset + size) == -1)
+        {
+            LOG_ERROR << errno << ": Error extending buffer store fd " << fd;
+            return NULL;
+        }
+
+        void *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+        if (mem == MAP_FAILED)
+        {
+            LOG_ERROR << errno << ": Error mapping buffer store segment fd " << fd << " (" << offset << "," << size << ")";
+            return NULL;
+        }
+
+        next_segment_pos += size;
+
+        buffer_segment &segment = segments[offset];
+        segment.offset = offset;
+        segment.size = size;
+        segment.mem = static_cast<uint8_t *>(mem);
+        return &segment;
+    }
+
+    /**
+     * Returns the segment which contains the given buffer view. NULL if not found.
+     */
+    buffer_segment *buffer_store::find_segment(const buffer_view &view)
+    {
+        auto itr = segments.upper_bound(view.offset);
+        if (itr == segments.begin())
+            return NULL;
+
+        buffer_segment &segment = (--itr)->second;
+        if ((size_t)(view.offset - segment.offset) + view.size > segment.size)
+            return NULL;
+
+        return &segment;
+    }
+
+    /**
+     * Unmaps the segment and releases its memory back to the system by punching a hole over the whole segment.
+     */
+    void buffer_store::release_segment(buffer_segment &segment)
+    {
+        munmap(segment.mem, segment.size);
+
+        if (fallocate(fd, FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, segment.offset, segment.size) == -1 &&
+            errno != EBADF) // errno=EBADF is ignored, since if the memfd is closed, we don't need to cleanup anyway.
+        {
+            LOG_ERROR << errno << ": Error when purging buffer store fd " << fd << " (" << segment.offset << "," << segment.size << ")";
+        }
+
+        if (active_segment == &segment)
+            active_segment = NULL;
+
+        segments.erase(segment.offset);
+    }
+
+} // namespace util
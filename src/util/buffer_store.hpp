@@ -5,32 +5,68 @@
 
 namespace util
 {
+    // Size of a regular buffer store segment. Small buffers are packed into these.
+    constexpr size_t BUFFER_SEGMENT_SIZE = 4 * 1024 * 1024;
+
+    // Buffers larger than this are placed in their own dedicated segment.
+    constexpr size_t BUFFER_SEGMENT_MAX_PACKED_SIZE = BUFFER_SEGMENT_SIZE / 4;
 
     struct buffer_view
     {
         off_t offset;
         uint32_t size;
 
-        bool is_null()
+        bool is_null() const
         {
             return !offset && !size;
         }
     };
 
+    /**
+     * A contiguous region of the buffer store memfd which is memory mapped into our address space.
+     * The segment is released as a whole once all the buffers written into it have been purged.
+     */
+    struct buffer_segment
+    {
+        off_t offset = 0;        // Start offset of the segment within the memfd.
+        size_t size = 0;         // Mapped size of the segment.
+        size_t write_pos = 0;    // Next packing position relative to segment start.
+        uint8_t *mem = NULL;     // Memory mapped address of the segment.
+        uint32_t live_count = 0; // No. of buffers in this segment which haven't been purged yet.
+        bool sealed = false;     // Whether the segment no longer accepts new buffers.
+    };
+
+    /**
+     * Memfd backed buffer store. Buffers are identified by their offset/size within the memfd so that the memfd can be
+     * handed over to other processes (eg. contract) to read the buffers directly. Buffers are packed into memory mapped
+     * segments and readers within HotPocket can access them as string views without copying.
+     */
     class buffer_store
     {
     private:
-        off_t next_write_pos = 0;
+        off_t next_segment_pos = 0;
+        std::map<off_t, buffer_segment> segments; // Live segments keyed by their memfd start offset.
+        buffer_segment *active_segment = NULL;     // The segment small buffers are currently packed into.
+        std::mutex segments_mutex;
+
+        buffer_segment *create_segment(const size_t size);
+        buffer_segment *find_segment(const buffer_view &view);
+        void release_segment(buffer_segment &segment);
+        uint8_t *allocate(const uint32_t size, buffer_view &view);
 
     public:
         int fd;
         int init();
         const buffer_view write_buf(const void *buf, const uint32_t size);
+        const buffer_view reserve_buf(const uint32_t size);
+        int fill_buf(const buffer_view &view, const size_t pos, const void *buf, const size_t size);
         int read_buf(const buffer_view &view, std::string &buf);
+        std::string_view view_buf(const buffer_view &view);
         int purge(const buffer_view &buf);
+        void new_generation();
         void deinit();
     };
 
 } // namespace util
 
-#endif
\ No newline at end of file
+#endif
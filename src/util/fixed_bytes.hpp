@@ -0,0 +1,60 @@
+#ifndef _HP_UTIL_FIXED_BYTES_
+#define _HP_UTIL_FIXED_BYTES_
+
+#include "../pchheader.hpp"
+
+namespace util
+{
+    /**
+     * Fixed-size binary value (ordered hash, pubkey etc.) stored inline without any heap allocation.
+     * Compares and orders exactly the same way as a std::string holding the same bytes.
+     */
+    template <size_t N>
+    struct fixed_bytes
+    {
+        uint8_t data[N] = {};
+
+        static constexpr size_t size()
+        {
+            return N;
+        }
+
+        bool operator==(const fixed_bytes &rhs) const
+        {
+            return memcmp(data, rhs.data, N) == 0;
+        }
+
+        bool operator!=(const fixed_bytes &rhs) const
+        {
+            return memcmp(data, rhs.data, N) != 0;
+        }
+
+        bool operator<(const fixed_bytes &rhs) const
+        {
+            return memcmp(data, rhs.data, N) < 0;
+        }
+
+        /**
+         * Copies the given bytes. Caller must make sure the view has exactly N bytes.
+         */
+        fixed_bytes &operator=(std::string_view sv)
+        {
+            memcpy(data, sv.data(), N);
+            return *this;
+        }
+
+        std::string_view to_string_view() const
+        {
+            return std::string_view(reinterpret_cast<const char *>(data), N);
+        }
+    };
+
+    // User input ordered hash. [8 byte nonce][32 byte input signature hash]
+    typedef fixed_bytes<40> h40;
+
+    // Binary ed25519 public key with the key type prefix byte.
+    typedef fixed_bytes<33> pk33;
+
+} // namespace util
+
+#endif
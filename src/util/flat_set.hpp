@@ -0,0 +1,101 @@
+#ifndef _HP_UTIL_FLAT_SET_
+#define _HP_UTIL_FLAT_SET_
+
+#include "../pchheader.hpp"
+
+namespace util
+{
+    /**
+     * Ordered set of unique values stored contiguously in a sorted vector. Meant for small value types
+     * (hashes, pubkeys) which are mostly built once in order and then iterated or looked up.
+     */
+    template <typename T>
+    class flat_set
+    {
+    private:
+        std::vector<T> items;
+
+    public:
+        typedef typename std::vector<T>::const_iterator const_iterator;
+
+        /**
+         * Inserts the value if it doesn't exist. Inserting in ascending order only appends.
+         * @return True if inserted. False if the value already exists.
+         */
+        bool emplace(const T &value)
+        {
+            if (items.empty() || items.back() < value)
+            {
+                items.push_back(value);
+                return true;
+            }
+
+            const auto itr = std::lower_bound(items.begin(), items.end(), value);
+            if (itr != items.end() && !(value < *itr))
+                return false;
+
+            items.insert(itr, value);
+            return true;
+        }
+
+        /**
+         * Inserts values given in any order with a single sort. Use this instead of emplace() for unordered bulk
+         * inserts which would otherwise shift the vector on every insert.
+         */
+        void insert_unordered(const std::vector<T> &values)
+        {
+            items.insert(items.end(), values.begin(), values.end());
+            std::sort(items.begin(), items.end());
+            items.erase(std::unique(items.begin(), items.end(), [](const T &a, const T &b) { return !(a < b) && !(b < a); }), items.end());
+        }
+
+        const_iterator find(const T &value) const
+        {
+            const auto itr = std::lower_bound(items.begin(), items.end(), value);
+            return (itr != items.end() && !(value < *itr)) ? itr : items.end();
+        }
+
+        size_t count(const T &value) const
+        {
+            return find(value) == items.end() ? 0 : 1;
+        }
+
+        const_iterator begin() const
+        {
+            return items.begin();
+        }
+
+        const_iterator end() const
+        {
+            return items.end();
+        }
+
+        size_t size() const
+        {
+            return items.size();
+        }
+
+        bool empty() const
+        {
+            return items.empty();
+        }
+
+        void reserve(const size_t n)
+        {
+            items.reserve(n);
+        }
+
+        void clear()
+        {
+            items.clear();
+        }
+
+        void swap(flat_set &other)
+        {
+            items.swap(other.items);
+        }
+    };
+
+} // namespace util
+
+#endif
@@ -7,151 +7,174 @@ namespace util
 {
     merkle_hash_tree::merkle_hash_tree(const size_t block_size) : block_size(block_size)
     {
-        root.hash.resize(BLAKE3_OUT_LEN);
     }
 
-    void merkle_hash_tree::create_groups(std::list<merkle_hash_node> &nodes)
+    /**
+     * Builds the tree with the given leaf hashes. Each hash must be 32 bytes.
+     */
+    void merkle_hash_tree::populate(const std::vector<std::string_view> &hashes)
     {
-        if (nodes.size() == 1)
+        clear();
+        if (hashes.empty())
+            return;
+
+        // Reserve the space for all levels up front so the levels stay contiguous.
+        size_t total = 0;
+        for (size_t count = hashes.size(); count > 1; count = (count + block_size - 1) / block_size)
+            total += count;
+        nodes.reserve(total + 1);
+
+        level_offsets.push_back(0);
+        leaf_index.reserve(hashes.size());
+        for (std::string_view hash : hashes)
         {
-            merkle_hash_node &first = nodes.front();
-            root.hash.swap(first.hash);
-            root.children.swap(first.children);
+            h32 &leaf = nodes.emplace_back();
+            leaf = hash;
+            leaf_index.try_emplace(leaf, nodes.size() - 1);
         }
-        else if (nodes.size() > 1)
+
+        // Hash each block of the level into its parent on the next level until a single root remains.
+        std::vector<std::string_view> block;
+        block.reserve(block_size);
+        while (level_size(level_offsets.size() - 1) > 1)
         {
-            // Create parent hash nodes for blocks of nodes.
-            std::list<merkle_hash_node> parents;
+            const size_t offset = level_offsets.back();
+            const size_t count = level_size(level_offsets.size() - 1);
+            level_offsets.push_back(nodes.size());
 
-            const size_t blocks = (nodes.size() + block_size - 1) / block_size;
-            for (size_t i = 0; i < blocks; i++)
+            for (size_t i = 0; i < count; i += block_size)
             {
-                parents.push_back({});
-                merkle_hash_node &parent = parents.back();
-
-                // Move a portion of nodes under the parent.
-                auto last_child = nodes.begin();
-                std::advance(last_child, MIN(block_size, nodes.size()));
-                parent.children.splice(parent.children.end(), nodes, nodes.begin(), last_child);
-
-                // Calculate parent hash.
-                if (parent.children.size() > 1)
-                {
-                    std::vector<std::string_view> hashes;
-                    for (const util::merkle_hash_node &child : parent.children)
-                        hashes.push_back(child.hash);
-                    parent.hash = crypto::get_list_hash(hashes);
-                }
-                else
+                const size_t end = MIN(i + block_size, count);
+                if (end - i == 1)
                 {
                     // If parent has a single child, the child becomes the parent.
-                    parent.hash.swap(parent.children.begin()->hash);
-                    parent.children.swap(parent.children.begin()->children);
+                    nodes.push_back(nodes[offset + i]);
+                    continue;
                 }
-            }
 
-            create_groups(parents);
+                block.clear();
+                for (size_t j = i; j < end; j++)
+                    block.push_back(nodes[offset + j].to_string_view());
+                nodes.emplace_back() = crypto::get_list_hash(block);
+            }
         }
     }
 
-    void merkle_hash_tree::populate(const std::vector<std::string_view> &hashes)
-    {
-        // Create leaf tree nodes for all hashes.
-        std::list<merkle_hash_node> leafs;
-        for (std::string_view hash : hashes)
-            leafs.push_back(merkle_hash_node{std::string(hash)});
-
-        create_groups(leafs);
-    }
-
     const std::string merkle_hash_tree::root_hash()
     {
-        return root.hash;
+        if (nodes.empty())
+            return std::string(BLAKE3_OUT_LEN, 0);
+        return std::string(nodes.back().to_string_view());
     }
 
+    /**
+     * Collapses (merges) all nodes except for the ones leading to the retained hash. Only the path from the root to
+     * the retained leaf and the hashes of the siblings along that path are read, so a proof costs
+     * O(depth x block size) regardless of the no. of leaves.
+     * @param retain_hash The leaf hash to retain. The returned tree has the retained node marked.
+     * @return The collapsed tree. Only has the root hash if the retained hash is not found.
+     */
     const merkle_hash_node merkle_hash_tree::collapse(std::string_view retain_hash)
     {
-        // Traverse through the tree and collapse (merge) all leaf nodes except for the retained hash.
-        merkle_hash_node new_root = clone(root);
-        retain_node(new_root, retain_hash);
-        return new_root;
-    }
-
-    void merkle_hash_tree::clear()
-    {
-        root.hash = std::string(BLAKE3_OUT_LEN, 0);
-        root.children.clear();
-    }
-
-    merkle_hash_node merkle_hash_tree::clone(const merkle_hash_node &node)
-    {
-        merkle_hash_node new_node;
-        new_node.hash = node.hash;
+        merkle_hash_node new_root;
+        new_root.hash = root_hash();
 
-        for (const merkle_hash_node &child : node.children)
-            new_node.children.push_back(clone(child));
+        if (new_root.hash == retain_hash)
+        {
+            new_root.is_retained = true;
+            return new_root;
+        }
 
-        return new_node;
-    }
+        if (nodes.empty() || retain_hash.size() != sizeof(h32))
+            return new_root;
 
-    bool merkle_hash_tree::retain_node(merkle_hash_node &node, std::string_view retain_hash)
-    {
-        // Check whether this node is the retain hash or we have already found the retain hash.
-        if (retain_hash.empty() || node.hash == retain_hash)
-        {
-            node.children.clear(); // No need to dig deeper.
+        h32 key;
+        key = retain_hash;
+        const auto itr = leaf_index.find(key);
+        if (itr == leaf_index.end())
+            return new_root;
 
-            if (node.hash == retain_hash)
-                node.is_retained = true; // Mark this node as the retained node.
+        // Walk down from the root. On each level the path node is at position (leaf / block_size^level).
+        merkle_hash_node *collapsed = &new_root;
+        const size_t leaf = itr->second;
+        size_t level = level_offsets.size() - 1;
+        size_t divisor = 1; // block_size^(level - 1)
+        for (size_t l = 1; l < level; l++)
+            divisor *= block_size;
 
-            return true;
-        }
-        else
+        while (level > 0)
         {
-            // Check whether any child contains the retain hash.
-            bool contains_retain_child = false;
-            for (merkle_hash_node &child : node.children)
-            {
-                // If the retain child already found, there's no need to check hashes further. So we pass empty hash.
-                std::string_view hash_to_check = contains_retain_child ? std::string_view() : retain_hash;
-                if (retain_node(child, hash_to_check))
-                    contains_retain_child = true;
-            }
-
-            // If a child contains the retain hash, then this node must be retained as well.
-            if (contains_retain_child)
-            {
-                return true;
-            }
-            else
+            // Position of the path node's child and its block of siblings on the level below.
+            const size_t child_index = leaf / divisor;
+            divisor /= block_size;
+            const size_t block_start = (child_index / block_size) * block_size;
+            const size_t block_end = MIN(block_start + block_size, level_size(level - 1));
+            level--;
+
+            // A node with a single child is the child itself. So it doesn't get its own level in the proof.
+            if (block_end - block_start == 1)
+                continue;
+
+            merkle_hash_node *collapsed_next = NULL;
+            for (size_t i = block_start; i < block_end; i++)
             {
-                node.children.clear();
-                return false;
+                merkle_hash_node &collapsed_child = collapsed->children.emplace_back();
+                collapsed_child.hash = nodes[level_offsets[level] + i].to_string_view();
+                if (i == child_index)
+                    collapsed_next = &collapsed_child;
             }
+            collapsed = collapsed_next;
         }
+
+        collapsed->is_retained = true; // Mark the last node in the path as the retained node.
+        return new_root;
+    }
+
+    void merkle_hash_tree::clear()
+    {
+        nodes.clear();
+        level_offsets.clear();
+        leaf_index.clear();
+    }
+
+    size_t merkle_hash_tree::level_size(const size_t level) const
+    {
+        const size_t end = (level + 1) < level_offsets.size() ? level_offsets[level + 1] : nodes.size();
+        return end - level_offsets[level];
     }
 
     /**
      * Helper method to print the contents for debugging.
      */
-    void merkle_hash_tree::print(const merkle_hash_node &node)
+    void merkle_hash_tree::print(const size_t level, const size_t index)
     {
-        std::cout << util::to_hex(node.hash).substr(0, 8);
+        std::cout << util::to_hex(nodes[level_offsets[level] + index].to_string_view()).substr(0, 8);
+
+        // Skip the promoted single child nodes since they are the same node.
+        size_t child_level = level;
+        size_t block_start = index;
+        size_t block_end = index + 1;
+        while (child_level > 0 && block_end - block_start == 1)
+        {
+            block_start = block_start * block_size;
+            block_end = MIN(block_start + block_size, level_size(child_level - 1));
+            child_level--;
+        }
 
-        if (!node.children.empty())
+        if (block_end - block_start > 1)
         {
             std::cout << "(";
-            for (const merkle_hash_node &child : node.children)
+            for (size_t i = block_start; i < block_end; i++)
             {
-                print(child);
-                if (&child != &node.children.back())
+                print(child_level, i);
+                if (i != block_end - 1)
                     std::cout << " ";
             }
             std::cout << ")";
         }
 
-        if (&node == &root)
+        if (level == level_offsets.size() - 1)
             std::cout << "\n";
     }
 
-} // namespace util
\ No newline at end of file
+} // namespace util
@@ -2,9 +2,13 @@
 #define _HP_UTIL_MERKLE_HASH_TREE_
 
 #include "../pchheader.hpp"
+#include "h32.hpp"
 
 namespace util
 {
+    /**
+     * Node of a collapsed merkle hash tree (a proof) handed out to users.
+     */
     struct merkle_hash_node
     {
         std::string hash;
@@ -12,15 +16,21 @@ namespace util
         bool is_retained = false;
     };
 
+    /**
+     * Merkle hash tree stored as a contiguous level-ordered array of fixed size hashes. Leaves are grouped into
+     * blocks of 'block_size' and each block is hashed into a parent on the next level until a single root remains.
+     * A block with a single node is promoted to the next level as is.
+     */
     class merkle_hash_tree
     {
     private:
         const size_t block_size;
-        merkle_hash_node root;
-        void create_groups(std::list<merkle_hash_node> &nodes);
-        merkle_hash_node clone(const merkle_hash_node &node);
-        bool retain_node(merkle_hash_node &node, std::string_view retain_hash);
-        void print(const merkle_hash_node &node);
+        std::vector<h32> nodes;                                   // All levels starting from the leaves.
+        std::vector<size_t> level_offsets;                        // Start index of each level within 'nodes'.
+        std::unordered_map<h32, size_t, h32_std_key_hasher> leaf_index; // Index of the first leaf having each hash.
+
+        size_t level_size(const size_t level) const;
+        void print(const size_t level, const size_t index);
 
     public:
         merkle_hash_tree(const size_t block_size);
@@ -31,4 +41,4 @@ namespace util
     };
 } // namespace util
 
-#endif
\ No newline at end of file
+#endif
@@ -36,4 +36,17 @@ namespace util
 
         return false; // Hash already exists.
     }
+
+    /**
+     * Removes the given hash from the list if it exists.
+     */
+    void rollover_hashset::erase(const std::string &hash)
+    {
+        const auto itr = recent_hashes.find(hash);
+        if (itr == recent_hashes.end())
+            return;
+
+        recent_hashes_list.remove(&(*itr));
+        recent_hashes.erase(itr);
+    }
 }
\ No newline at end of file
@@ -24,6 +24,7 @@ namespace util
     public:
         rollover_hashset(const uint32_t maxsize);
         bool try_emplace(const std::string hash);
+        void erase(const std::string &hash);
     };
 } // namespace util
 
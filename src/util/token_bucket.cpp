@@ -0,0 +1,43 @@
+#include "token_bucket.hpp"
+#include "util.hpp"
+
+namespace util
+{
+
+    /**
+     * @param rate No. of tokens added per second. 0 means unlimited.
+     * @param capacity Max no. of tokens the bucket can hold (the allowed burst). Defaults to the rate.
+     */
+    token_bucket::token_bucket(const uint64_t rate, const uint64_t capacity)
+        : rate(rate),
+          capacity(capacity == 0 ? rate : capacity),
+          tokens(this->capacity * 1000),
+          last_refill(util::get_epoch_milliseconds())
+    {
+    }
+
+    /**
+     * Takes the given no. of tokens from the bucket if available.
+     * @return True if the tokens were taken. False if the bucket did not have enough tokens.
+     */
+    bool token_bucket::try_consume(const uint64_t count)
+    {
+        if (rate == 0)
+            return true;
+
+        const uint64_t now = util::get_epoch_milliseconds();
+        if (now > last_refill)
+        {
+            // 'rate' tokens per second equals 'rate' scaled tokens per millisecond.
+            tokens = std::min(capacity * 1000, tokens + (now - last_refill) * rate);
+            last_refill = now;
+        }
+
+        if (tokens < count * 1000)
+            return false;
+
+        tokens -= count * 1000;
+        return true;
+    }
+
+} // namespace util
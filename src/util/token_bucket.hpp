@@ -0,0 +1,28 @@
+#ifndef _HP_UTIL_TOKEN_BUCKET_
+#define _HP_UTIL_TOKEN_BUCKET_
+
+#include "../pchheader.hpp"
+
+namespace util
+{
+
+    /**
+     * Token bucket rate limiter. Tokens are refilled at a constant rate up to the bucket capacity.
+     * Not thread-safe.
+     */
+    class token_bucket
+    {
+    private:
+        uint64_t rate = 0;        // Tokens added per second. 0 means unlimited.
+        uint64_t capacity = 0;    // Max tokens the bucket can hold.
+        uint64_t tokens = 0;      // Available tokens scaled by 1000 to refill at millisecond resolution.
+        uint64_t last_refill = 0; // Epoch milliseconds of the last refill.
+
+    public:
+        token_bucket(const uint64_t rate = 0, const uint64_t capacity = 0);
+        bool try_consume(const uint64_t count = 1);
+    };
+
+} // namespace util
+
+#endif
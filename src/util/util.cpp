@@ -513,4 +513,35 @@ namespace util
         return sv.substr(sv.size() - suffix_len, suffix_len);
     }
 
+    /**
+     * Parses a Linux style cpu list (eg. "0-3,8,10-11") into the given set.
+     * @param cpus Set to populate with the cpu numbers.
+     * @param str Cpu list string. An empty string results in an empty set.
+     * @return 0 on success. -1 if the list is malformed or contains cpus beyond CPU_SETSIZE.
+     */
+    int parse_cpu_list(std::set<uint32_t> &cpus, std::string_view str)
+    {
+        std::vector<std::string> ranges;
+        split_string(ranges, str, ",");
+
+        for (const std::string &range : ranges)
+        {
+            std::vector<std::string> bounds;
+            split_string(bounds, range, "-");
+
+            uint64_t first = 0, last = 0;
+            if (bounds.empty() || bounds.size() > 2 || range.front() == '-' || range.back() == '-' || range.find("--") != std::string::npos ||
+                bounds.front().find_first_not_of("0123456789") != std::string::npos ||
+                bounds.back().find_first_not_of("0123456789") != std::string::npos ||
+                stoull(bounds.front(), first) == -1 || stoull(bounds.back(), last) == -1 ||
+                first > last || last >= CPU_SETSIZE)
+                return -1;
+
+            for (uint64_t cpu = first; cpu <= last; cpu++)
+                cpus.emplace(cpu);
+        }
+
+        return 0;
+    }
+
 } // namespace util
@@ -19,7 +19,8 @@ namespace util
     enum PROTOCOL
     {
         JSON = 0,
-        BSON = 1
+        BSON = 1,
+        FLATBUF = 2
     };
 
     const std::string to_hex(const std::string_view bin);
@@ -86,6 +87,8 @@ namespace util
 
     std::string_view get_string_suffix(std::string_view sv, const size_t suffix_len);
 
+    int parse_cpu_list(std::set<uint32_t> &cpus, std::string_view str);
+
 } // namespace util
 
 #endif
@@ -0,0 +1,111 @@
+#include "work_pool.hpp"
+
+namespace util
+{
+
+    work_pool::~work_pool()
+    {
+        deinit();
+    }
+
+    /**
+     * Starts the worker threads.
+     * @param thread_count No. of worker threads. 0 means all batches are run on the submitting thread.
+     * @param on_thread_start Optional callback invoked on each worker thread before it starts taking tasks.
+     */
+    void work_pool::init(const size_t thread_count, std::function<void()> on_thread_start)
+    {
+        this->on_thread_start = std::move(on_thread_start);
+        for (size_t i = 0; i < thread_count; i++)
+            threads.emplace_back(&work_pool::worker_loop, this);
+    }
+
+    /**
+     * Stops and joins the worker threads.
+     */
+    void work_pool::deinit()
+    {
+        {
+            std::scoped_lock<std::mutex> lock(tasks_mutex);
+            is_shutting_down = true;
+        }
+        tasks_cv.notify_all();
+
+        for (std::thread &t : threads)
+        {
+            if (t.joinable())
+                t.join();
+        }
+        threads.clear();
+    }
+
+    /**
+     * Returns the no. of worker threads (excluding submitting threads).
+     */
+    size_t work_pool::size() const
+    {
+        return threads.size();
+    }
+
+    /**
+     * Executes all tasks of the given batch and returns once all of them have completed.
+     * @param batch Independent tasks to execute. Tasks are moved out of the batch.
+     */
+    void work_pool::run(std::vector<std::function<void()>> &batch)
+    {
+        auto remaining = std::make_shared<size_t>(batch.size());
+
+        std::unique_lock<std::mutex> lock(tasks_mutex);
+        for (std::function<void()> &task : batch)
+        {
+            tasks.push_back([this, remaining, task = std::move(task)]()
+                            {
+                                task();
+
+                                {
+                                    std::scoped_lock<std::mutex> lock(tasks_mutex);
+                                    (*remaining)--;
+                                }
+                                done_cv.notify_all();
+                            });
+        }
+        batch.clear();
+        tasks_cv.notify_all();
+
+        // Help out with the queued tasks until the queue drains, then wait for tasks still running on workers.
+        while (!tasks.empty())
+        {
+            std::function<void()> task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+
+        done_cv.wait(lock, [&]
+                     { return *remaining == 0; });
+    }
+
+    void work_pool::worker_loop()
+    {
+        if (on_thread_start)
+            on_thread_start();
+
+        std::unique_lock<std::mutex> lock(tasks_mutex);
+        while (true)
+        {
+            tasks_cv.wait(lock, [&]
+                          { return is_shutting_down || !tasks.empty(); });
+
+            if (tasks.empty())
+                break; // Shutting down.
+
+            std::function<void()> task = std::move(tasks.front());
+            tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+} // namespace util
@@ -0,0 +1,36 @@
+#ifndef _HP_UTIL_WORK_POOL_
+#define _HP_UTIL_WORK_POOL_
+
+#include "../pchheader.hpp"
+
+namespace util
+{
+
+    /**
+     * Fixed set of worker threads which execute batches of independent tasks. The thread submitting a batch also
+     * executes queued tasks until its batch completes, so a pool with no worker threads runs batches inline.
+     */
+    class work_pool
+    {
+    private:
+        std::vector<std::thread> threads;
+        std::list<std::function<void()>> tasks;
+        std::mutex tasks_mutex;
+        std::condition_variable tasks_cv; // Signalled when tasks are queued or on shutdown.
+        std::condition_variable done_cv;  // Signalled when a task completes.
+        bool is_shutting_down = false;
+        std::function<void()> on_thread_start; // Invoked at the start of each worker thread (eg. to name/pin it).
+
+        void worker_loop();
+
+    public:
+        ~work_pool();
+        void init(const size_t thread_count, std::function<void()> on_thread_start = {});
+        void deinit();
+        size_t size() const;
+        void run(std::vector<std::function<void()>> &batch);
+    };
+
+} // namespace util
+
+#endif
@@ -0,0 +1,211 @@
+/**
+    Entry point for the hpcore microbenchmark suite.
+    Usage: hpcore_bench [--filter <name substring>] [--out <json file>] [--samples <n>] [--sample-ms <n>]
+**/
+
+#include "../../src/pchheader.hpp"
+#include "../../src/conf.hpp"
+#include "../../src/crypto.hpp"
+#include "../../src/unl.hpp"
+#include "../../src/util/util.hpp"
+#include "../../src/util/version.hpp"
+#include "bench.hpp"
+
+#ifndef HP_BENCH_GIT_REV
+#define HP_BENCH_GIT_REV "unknown"
+#endif
+
+namespace bench
+{
+    constexpr uint32_t DEFAULT_SAMPLES = 10;
+    constexpr uint32_t DEFAULT_SAMPLE_MS = 50;
+    constexpr const char *DEFAULT_OUT_FILE = "hpcore_bench.json";
+
+    struct bench_entry
+    {
+        std::string name;
+        uint64_t bytes_per_op = 0;
+        bench_setup setup;
+    };
+
+    std::vector<bench_entry> entries;
+
+    void add(std::string_view name, const uint64_t bytes_per_op, bench_setup setup)
+    {
+        entries.push_back(bench_entry{std::string(name), bytes_per_op, std::move(setup)});
+    }
+
+    std::string random_data(const size_t len, const uint64_t seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::string data;
+        data.resize(len);
+        for (size_t i = 0; i < len; i++)
+            data[i] = (char)(rng() & 0xff);
+        return data;
+    }
+
+    uint64_t now_ns()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * Runs the given operation 'iterations' times and returns the elapsed nanoseconds.
+     */
+    uint64_t time_op(const bench_op &op, const uint64_t iterations)
+    {
+        const uint64_t start = now_ns();
+        for (uint64_t i = 0; i < iterations; i++)
+            op();
+        return now_ns() - start;
+    }
+
+    /**
+     * Measures a benchmark. The iteration count of a sample is calibrated so each sample takes about 'sample_ms'.
+     * Reported figures are based on per-sample averages so outlier samples don't skew the median.
+     */
+    result run(const bench_entry &entry, const uint32_t samples, const uint32_t sample_ms)
+    {
+        const bench_op op = entry.setup();
+        const uint64_t sample_ns = (uint64_t)sample_ms * 1000000;
+
+        // Warm up and calibrate. Double the iterations until a batch takes at least 1/10th of a sample.
+        uint64_t iterations = 1;
+        uint64_t elapsed = time_op(op, iterations);
+        while (elapsed < sample_ns / 10)
+        {
+            iterations *= 2;
+            elapsed = time_op(op, iterations);
+        }
+        iterations = MAX(1, (uint64_t)((double)iterations * sample_ns / MAX(elapsed, 1)));
+
+        std::vector<double> ns_per_op;
+        ns_per_op.reserve(samples);
+        for (uint32_t i = 0; i < samples; i++)
+            ns_per_op.push_back((double)time_op(op, iterations) / iterations);
+
+        std::sort(ns_per_op.begin(), ns_per_op.end());
+
+        result r;
+        r.name = entry.name;
+        r.iterations = iterations * samples;
+        r.bytes_per_op = entry.bytes_per_op;
+        r.median_ns = ns_per_op[ns_per_op.size() / 2];
+        r.min_ns = ns_per_op.front();
+        r.max_ns = ns_per_op.back();
+        return r;
+    }
+
+    const std::string to_json(const std::vector<result> &results, const uint32_t samples, const uint32_t sample_ms)
+    {
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(2);
+        os << "{\"hp_version\":\"" << version::HP_VERSION << "\""
+           << ",\"git_rev\":\"" << HP_BENCH_GIT_REV << "\""
+           << ",\"timestamp\":" << util::get_epoch_milliseconds()
+           << ",\"cpus\":" << std::thread::hardware_concurrency()
+           << ",\"samples\":" << samples
+           << ",\"sample_ms\":" << sample_ms
+           << ",\"results\":[";
+
+        for (auto itr = results.begin(); itr != results.end(); itr++)
+        {
+            if (itr != results.begin())
+                os << ",";
+
+            os << "{\"name\":\"" << itr->name << "\""
+               << ",\"iterations\":" << itr->iterations
+               << ",\"median_ns\":" << itr->median_ns
+               << ",\"min_ns\":" << itr->min_ns
+               << ",\"max_ns\":" << itr->max_ns
+               << ",\"bytes_per_op\":" << itr->bytes_per_op
+               << "}";
+        }
+
+        os << "]}\n";
+        return os.str();
+    }
+
+    /**
+     * Prepares the global node state the benchmarked modules rely on. A throwaway signing key pair is generated
+     * and the node is the only UNL member.
+     */
+    int init_node_state()
+    {
+        if (crypto::init() == -1)
+            return -1;
+
+        crypto::generate_signing_keys(conf::cfg.node.public_key, conf::cfg.node.private_key);
+        conf::cfg.node.public_key_hex = util::to_hex(conf::cfg.node.public_key);
+        conf::cfg.contract.unl.emplace(conf::cfg.node.public_key);
+        conf::cfg.contract.consensus.roundtime = 1000;
+
+        return unl::init();
+    }
+
+} // namespace bench
+
+int main(int argc, char **argv)
+{
+    std::string filter;
+    std::string out_file = bench::DEFAULT_OUT_FILE;
+    uint32_t samples = bench::DEFAULT_SAMPLES;
+    uint32_t sample_ms = bench::DEFAULT_SAMPLE_MS;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view arg = argv[i];
+        if (i + 1 < argc && arg == "--filter")
+            filter = argv[++i];
+        else if (i + 1 < argc && arg == "--out")
+            out_file = argv[++i];
+        else if (i + 1 < argc && arg == "--samples")
+            samples = std::max(1, atoi(argv[++i]));
+        else if (i + 1 < argc && arg == "--sample-ms")
+            sample_ms = std::max(1, atoi(argv[++i]));
+        else
+        {
+            std::cerr << "Usage: hpcore_bench [--filter <name substring>] [--out <json file>] [--samples <n>] [--sample-ms <n>]\n";
+            return 1;
+        }
+    }
+
+    if (bench::init_node_state() == -1)
+    {
+        std::cerr << "Benchmark node state initialization failed.\n";
+        return 1;
+    }
+
+    bench::register_crypto_benchmarks();
+    bench::register_util_benchmarks();
+    bench::register_msg_benchmarks();
+    bench::register_ledger_benchmarks();
+
+    std::vector<bench::result> results;
+    for (const bench::bench_entry &entry : bench::entries)
+    {
+        if (!filter.empty() && entry.name.find(filter) == std::string::npos)
+            continue;
+
+        const bench::result r = bench::run(entry, samples, sample_ms);
+        results.push_back(r);
+
+        std::cout << std::left << std::setw(40) << r.name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(14) << r.median_ns << " ns/op";
+        if (r.bytes_per_op > 0)
+            std::cout << std::setw(12) << std::setprecision(1) << (r.bytes_per_op / r.median_ns) * 1000 << " MB/s";
+        std::cout << "\n";
+    }
+
+    std::ofstream out(out_file, std::ios::trunc);
+    out << bench::to_json(results, samples, sample_ms);
+    if (!out.good())
+    {
+        std::cerr << "Failed to write results to " << out_file << "\n";
+        return 1;
+    }
+
+    std::cout << "Results written to " << out_file << "\n";
+    return 0;
+}
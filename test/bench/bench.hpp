@@ -0,0 +1,56 @@
+#ifndef _HP_BENCH_
+#define _HP_BENCH_
+
+#include "../../src/pchheader.hpp"
+#include <algorithm>
+#include <fstream>
+#include <random>
+
+/**
+ * Minimal microbenchmark harness for hpcore hot paths.
+ */
+namespace bench
+{
+    // The operation measured by a benchmark. Invoked repeatedly.
+    typedef std::function<void()> bench_op;
+
+    // Prepares the benchmark data and returns the operation to measure. Only invoked for selected benchmarks.
+    typedef std::function<bench_op()> bench_setup;
+
+    struct result
+    {
+        std::string name;
+        uint64_t iterations = 0;   // Total measured iterations across all samples.
+        uint64_t bytes_per_op = 0; // Payload bytes processed by one operation (0 if not applicable).
+        double median_ns = 0;      // Median of per-sample nanoseconds per operation.
+        double min_ns = 0;
+        double max_ns = 0;
+    };
+
+    void add(std::string_view name, const uint64_t bytes_per_op, bench_setup setup);
+
+    /**
+     * Prevents the compiler from optimizing away a computed value.
+     */
+    template <typename T>
+    inline void keep(const T &value)
+    {
+        asm volatile(""
+                     :
+                     : "g"(&value)
+                     : "memory");
+    }
+
+    /**
+     * Returns a deterministic pseudo-random buffer of the given length so runs are comparable between commits.
+     */
+    std::string random_data(const size_t len, const uint64_t seed = 1);
+
+    void register_crypto_benchmarks();
+    void register_util_benchmarks();
+    void register_msg_benchmarks();
+    void register_ledger_benchmarks();
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,98 @@
+#include "../../src/pchheader.hpp"
+#include "../../src/conf.hpp"
+#include "../../src/crypto.hpp"
+#include "../../src/util/merkle_hash_tree.hpp"
+#include "bench.hpp"
+
+namespace bench
+{
+    constexpr size_t MERKLE_BLOCK_SIZE = 16;
+    constexpr size_t HASH_BATCH_SIZE = 8;
+
+    void add_hash_benchmark(std::string_view name, const size_t size)
+    {
+        add(name, size, [size]() {
+            const auto data = std::make_shared<std::string>(random_data(size));
+            return [data]() { keep(crypto::get_hash(*data)); };
+        });
+    }
+
+    std::shared_ptr<std::vector<std::string>> create_merkle_leaves(const size_t leaf_count)
+    {
+        auto hashes = std::make_shared<std::vector<std::string>>();
+        hashes->reserve(leaf_count);
+        for (size_t i = 0; i < leaf_count; i++)
+            hashes->push_back(crypto::get_hash(random_data(32, i + 1)));
+        return hashes;
+    }
+
+    void add_merkle_benchmarks(const size_t leaf_count)
+    {
+        add("merkle/populate_" + std::to_string(leaf_count), 0, [leaf_count]() {
+            auto hashes = create_merkle_leaves(leaf_count);
+            auto tree = std::make_shared<util::merkle_hash_tree>(MERKLE_BLOCK_SIZE);
+            return [hashes, tree]() {
+                const std::vector<std::string_view> leaves(hashes->begin(), hashes->end());
+                tree->populate(leaves);
+                keep(tree->root_hash());
+            };
+        });
+
+        add("merkle/collapse_" + std::to_string(leaf_count), 0, [leaf_count]() {
+            auto hashes = create_merkle_leaves(leaf_count);
+            auto tree = std::make_shared<util::merkle_hash_tree>(MERKLE_BLOCK_SIZE);
+            tree->populate(std::vector<std::string_view>(hashes->begin(), hashes->end()));
+
+            // Collapse for each leaf in turn, as done when dispatching outputs to every user.
+            auto next = std::make_shared<size_t>(0);
+            return [hashes, tree, next]() {
+                keep(tree->collapse(hashes->at(*next)));
+                *next = (*next + 1) % hashes->size();
+            };
+        });
+    }
+
+    void register_crypto_benchmarks()
+    {
+        add_hash_benchmark("crypto/hash_64b", 64);
+        add_hash_benchmark("crypto/hash_4kb", 4 * 1024);
+        add_hash_benchmark("crypto/hash_4mb", 4 * 1024 * 1024);
+
+        add("crypto/hash_batch_8x4mb", HASH_BATCH_SIZE * 4 * 1024 * 1024, []() {
+            auto buffers = std::make_shared<std::vector<std::string>>();
+            for (size_t i = 0; i < HASH_BATCH_SIZE; i++)
+                buffers->push_back(random_data(4 * 1024 * 1024, i + 1));
+
+            return [buffers]() {
+                std::vector<crypto::hash_job> jobs(buffers->size());
+                for (size_t i = 0; i < buffers->size(); i++)
+                    jobs[i].parts.push_back(buffers->at(i));
+                crypto::get_hashes(jobs);
+                keep(jobs);
+            };
+        });
+
+        add("crypto/sign", 32, []() {
+            const auto msg = std::make_shared<std::string>(random_data(32));
+            return [msg]() { keep(crypto::sign(*msg, conf::cfg.node.private_key)); };
+        });
+
+        add("crypto/verify", 32, []() {
+            const auto msg = std::make_shared<std::string>(random_data(32));
+            const auto sig = std::make_shared<std::string>(crypto::sign(*msg, conf::cfg.node.private_key));
+            return [msg, sig]() { keep(crypto::verify(*msg, *sig, conf::cfg.node.public_key)); };
+        });
+
+        add("crypto/verify_cached_hit", 32, []() {
+            const auto msg = std::make_shared<std::string>(random_data(32));
+            const auto sig = std::make_shared<std::string>(crypto::sign(*msg, conf::cfg.node.private_key));
+            crypto::verify_cached(*msg, *sig, conf::cfg.node.public_key);
+            return [msg, sig]() { keep(crypto::verify_cached(*msg, *sig, conf::cfg.node.public_key)); };
+        });
+
+        // Output merkle trees have a leaf per user with outputs in the round.
+        add_merkle_benchmarks(1000);
+        add_merkle_benchmarks(10000);
+    }
+
+} // namespace bench
@@ -0,0 +1,102 @@
+#include "../../src/pchheader.hpp"
+#include "../../src/crypto.hpp"
+#include "../../src/util/util.hpp"
+#include "../../src/ledger/sqlite.hpp"
+#include "../../src/ledger/ledger_common.hpp"
+#include "bench.hpp"
+
+namespace sqlite = ledger::sqlite;
+
+namespace bench
+{
+    constexpr size_t LEDGER_USER_COUNT = 50; // Users (with one input each) recorded per ledger.
+
+    /**
+     * Temporary sqlite database which is removed once the benchmark is done.
+     */
+    struct temp_db
+    {
+        std::string dir;
+        sqlite3 *db = NULL;
+
+        ~temp_db()
+        {
+            if (db)
+                sqlite::close_db(&db);
+            if (!dir.empty())
+                util::remove_directory_recursively(dir);
+        }
+    };
+
+    std::shared_ptr<temp_db> open_temp_db(const bool raw)
+    {
+        auto tdb = std::make_shared<temp_db>();
+        char dir_template[] = "/tmp/hpcore_bench_XXXXXX";
+        if (mkdtemp(dir_template) == NULL)
+            return tdb;
+
+        tdb->dir = dir_template;
+        const std::string db_path = tdb->dir + (raw ? "/raw.sqlite" : "/ledger.sqlite");
+        if (sqlite::open_db(db_path, &tdb->db, true) == 0)
+        {
+            if (raw)
+                sqlite::initialize_ledger_raw_db(tdb->db);
+            else
+                sqlite::initialize_ledger_db(tdb->db);
+        }
+
+        return tdb;
+    }
+
+    void register_ledger_benchmarks()
+    {
+        add("ledger/insert_ledger_row", 0, []() {
+            const auto tdb = open_temp_db(false);
+            auto seq_no = std::make_shared<uint64_t>(0);
+            return [tdb, seq_no]() {
+                ledger::ledger_record ledger;
+                ledger.seq_no = ++(*seq_no);
+                ledger.timestamp = ledger.seq_no;
+                ledger.ledger_hash = crypto::get_hash(&ledger.seq_no, sizeof(ledger.seq_no));
+                ledger.prev_ledger_hash = ledger.ledger_hash;
+                ledger.data_hash = ledger.ledger_hash;
+                ledger.state_hash = ledger.ledger_hash;
+                ledger.config_hash = ledger.ledger_hash;
+                ledger.nonce = ledger.ledger_hash;
+                ledger.user_hash = ledger.ledger_hash;
+                ledger.input_hash = ledger.ledger_hash;
+                ledger.output_hash = ledger.ledger_hash;
+                keep(sqlite::insert_ledger_row(tdb->db, ledger));
+            };
+        });
+
+        // Users and inputs of a ledger inserted within one transaction, as done when persisting raw ledger data.
+        add("ledger/insert_raw_users_inputs_50", 0, []() {
+            const auto tdb = open_temp_db(true);
+            auto pubkeys = std::make_shared<std::vector<std::string>>();
+            for (size_t i = 0; i < LEDGER_USER_COUNT; i++)
+                pubkeys->push_back(random_data(33, i + 1));
+
+            auto seq_no = std::make_shared<uint64_t>(0);
+            return [tdb, pubkeys, seq_no]() {
+                sqlite3_stmt *users_stmt = sqlite::prepare_user_insert(tdb->db);
+                sqlite3_stmt *inputs_stmt = sqlite::prepare_user_input_insert(tdb->db);
+                const uint64_t ledger_seq_no = ++(*seq_no);
+
+                sqlite::begin_transaction(tdb->db);
+                for (size_t i = 0; i < pubkeys->size(); i++)
+                {
+                    const std::string &pubkey = pubkeys->at(i);
+                    const std::string hash = crypto::get_hash(pubkey, std::to_string(ledger_seq_no));
+                    sqlite::insert_user_record(users_stmt, ledger_seq_no, pubkey);
+                    sqlite::insert_user_input_record(inputs_stmt, ledger_seq_no, pubkey, hash, ledger_seq_no, i * 1024, 1024);
+                }
+                sqlite::commit_transaction(tdb->db);
+
+                sqlite3_finalize(users_stmt);
+                sqlite3_finalize(inputs_stmt);
+            };
+        });
+    }
+
+} // namespace bench
@@ -0,0 +1,228 @@
+#include "../../src/pchheader.hpp"
+#include "../../src/conf.hpp"
+#include "../../src/crypto.hpp"
+#include "../../src/util/util.hpp"
+#include "../../src/msg/fbuf/p2pmsg_conversion.hpp"
+#include "../../src/msg/usrmsg_parser.hpp"
+#include "../../src/msg/usrmsg_common.hpp"
+#include "bench.hpp"
+
+namespace p2pmsg = msg::fbuf::p2pmsg;
+
+namespace bench
+{
+    constexpr size_t PROPOSAL_USER_COUNT = 100;
+    constexpr size_t PROPOSAL_INPUT_COUNT = 500;
+    constexpr size_t NUP_USER_COUNT = 20;
+    constexpr size_t NUP_INPUTS_PER_USER = 10;
+    constexpr size_t USER_INPUT_SIZE = 1024;
+    constexpr size_t READ_RESPONSE_SIZE = 4096;
+
+    const std::string random_pubkey(const uint64_t seed)
+    {
+        std::string pubkey = random_data(33, seed);
+        pubkey[0] = crypto::KEYPFX_ed25519;
+        return pubkey;
+    }
+
+    const p2p::proposal create_sample_proposal()
+    {
+        p2p::proposal p;
+        p.stage = 1;
+        p.time = util::get_epoch_milliseconds();
+        p.time_config = 1000;
+        p.node_nonce = random_data(32, 1);
+        p.group_nonce = random_data(32, 2);
+        p.state_hash = random_data(32, 3);
+        p.patch_hash = random_data(32, 4);
+        p.output_hash = random_data(32, 5);
+        p.output_sig = random_data(64, 6);
+
+        for (size_t i = 0; i < PROPOSAL_USER_COUNT; i++)
+        {
+            util::pk33 pubkey;
+            pubkey = random_pubkey(100 + i);
+            p.users.emplace(pubkey);
+        }
+
+        for (size_t i = 0; i < PROPOSAL_INPUT_COUNT; i++)
+        {
+            util::h40 ordered_hash;
+            ordered_hash = random_data(40, 1000 + i);
+            p.input_ordered_hashes.emplace(ordered_hash);
+        }
+
+        p.root_hash = p2pmsg::hash_proposal(p);
+        return p;
+    }
+
+    const p2p::nonunl_proposal create_sample_nup()
+    {
+        p2p::nonunl_proposal nup;
+        for (size_t u = 0; u < NUP_USER_COUNT; u++)
+        {
+            std::list<usr::submitted_user_input> &inputs = nup.user_inputs[random_pubkey(100 + u)];
+            for (size_t i = 0; i < NUP_INPUTS_PER_USER; i++)
+                inputs.push_back(usr::submitted_user_input{random_data(USER_INPUT_SIZE, u * 1000 + i), random_data(64, i), util::PROTOCOL::JSON});
+        }
+        return nup;
+    }
+
+    const std::string encode_p2p_msg(const std::function<void(flatbuffers::FlatBufferBuilder &)> &create)
+    {
+        flatbuffers::FlatBufferBuilder builder(1024);
+        create(builder);
+        return std::string(reinterpret_cast<const char *>(builder.GetBufferPointer()), builder.GetSize());
+    }
+
+    /**
+     * Returns a signed contract input message as a user would submit it.
+     */
+    const std::string create_input_message(const util::PROTOCOL protocol)
+    {
+        const std::string input = util::to_hex(random_data(USER_INPUT_SIZE / 2));
+
+        if (protocol == util::PROTOCOL::JSON)
+        {
+            const std::string container = "{\"input\":\"" + input + "\",\"nonce\":1,\"max_ledger_seq_no\":10}";
+            const std::string sig = util::to_hex(crypto::sign(container, conf::cfg.node.private_key));
+
+            // The container is embedded as a json string value.
+            std::string escaped_container;
+            for (const char c : container)
+            {
+                if (c == '"')
+                    escaped_container += '\\';
+                escaped_container += c;
+            }
+
+            return std::string("{\"") + msg::usrmsg::FLD_TYPE + "\":\"" + msg::usrmsg::MSGTYPE_CONTRACT_INPUT +
+                   "\",\"" + msg::usrmsg::FLD_INPUT_CONTAINER + "\":\"" + escaped_container +
+                   "\",\"" + msg::usrmsg::FLD_SIG + "\":\"" + sig + "\"}";
+        }
+
+        std::vector<uint8_t> container;
+        {
+            jsoncons::bson::bson_bytes_encoder encoder(container);
+            encoder.begin_object();
+            encoder.key(msg::usrmsg::FLD_INPUT);
+            encoder.byte_string_value(input);
+            encoder.key(msg::usrmsg::FLD_NONCE);
+            encoder.uint64_value(1);
+            encoder.key(msg::usrmsg::FLD_MAX_LEDGER_SEQ_NO);
+            encoder.uint64_value(10);
+            encoder.end_object();
+            encoder.flush();
+        }
+
+        const std::string sig = crypto::sign(std::string_view(reinterpret_cast<const char *>(container.data()), container.size()), conf::cfg.node.private_key);
+
+        std::vector<uint8_t> msg;
+        jsoncons::bson::bson_bytes_encoder encoder(msg);
+        encoder.begin_object();
+        encoder.key(msg::usrmsg::FLD_TYPE);
+        encoder.string_value(msg::usrmsg::MSGTYPE_CONTRACT_INPUT);
+        encoder.key(msg::usrmsg::FLD_INPUT_CONTAINER);
+        encoder.byte_string_value(std::string_view(reinterpret_cast<const char *>(container.data()), container.size()));
+        encoder.key(msg::usrmsg::FLD_SIG);
+        encoder.byte_string_value(sig);
+        encoder.end_object();
+        encoder.flush();
+        return std::string(reinterpret_cast<const char *>(msg.data()), msg.size());
+    }
+
+    void add_usrmsg_benchmarks(std::string_view protocol_name, const util::PROTOCOL protocol)
+    {
+        const std::string prefix = std::string("usrmsg_") + std::string(protocol_name);
+
+        add(prefix + "/encode_read_response", READ_RESPONSE_SIZE, [protocol]() {
+            const auto content = std::make_shared<std::string>(random_data(READ_RESPONSE_SIZE));
+            return [protocol, content]() {
+                msg::usrmsg::usrmsg_parser parser(protocol);
+                std::vector<uint8_t> msg;
+                parser.create_contract_read_response_container(msg, "req1", *content);
+                keep(msg);
+            };
+        });
+
+        add(prefix + "/encode_input_status", 0, [protocol]() {
+            const auto input_hash = std::make_shared<std::string>(random_data(32));
+            return [protocol, input_hash]() {
+                msg::usrmsg::usrmsg_parser parser(protocol);
+                std::vector<uint8_t> msg;
+                parser.create_contract_input_status(msg, msg::usrmsg::STATUS_ACCEPTED, "", *input_hash, 10, util::h32_empty);
+                keep(msg);
+            };
+        });
+
+        add(prefix + "/parse_input", USER_INPUT_SIZE, [protocol]() {
+            const auto message = std::make_shared<std::string>(create_input_message(protocol));
+            return [protocol, message]() {
+                msg::usrmsg::usrmsg_parser parser(protocol);
+                std::string container, sig, input;
+                uint64_t nonce = 0, max_ledger_seq_no = 0;
+                bool streamed = false;
+                if (parser.parse(*message) == 0 &&
+                    parser.extract_signed_input_container(container, sig) == 0)
+                    parser.extract_input_container(input, nonce, max_ledger_seq_no, streamed, container);
+                keep(input);
+            };
+        });
+    }
+
+    void register_msg_benchmarks()
+    {
+        add("p2pmsg/proposal_encode", 0, []() {
+            const auto p = std::make_shared<p2p::proposal>(create_sample_proposal());
+            return [p]() {
+                flatbuffers::FlatBufferBuilder builder(1024);
+                p2pmsg::create_msg_from_proposal(builder, *p);
+                keep(builder.GetSize());
+            };
+        });
+
+        add("p2pmsg/proposal_decode", 0, []() {
+            const p2p::proposal p = create_sample_proposal();
+            const auto message = std::make_shared<std::string>(encode_p2p_msg([&](flatbuffers::FlatBufferBuilder &builder) {
+                p2pmsg::create_msg_from_proposal(builder, p);
+            }));
+
+            return [message]() {
+                if (!p2pmsg::verify_peer_message(*message))
+                    return;
+                const p2p::peer_message_info mi = p2pmsg::get_peer_message_info(*message);
+                if (!p2pmsg::verify_proposal_msg_structure(mi))
+                    return;
+                const util::h32 hash = p2pmsg::verify_proposal_msg_trust(mi);
+                keep(p2pmsg::create_proposal_from_msg(mi, hash, message));
+            };
+        });
+
+        add("p2pmsg/nup_encode", NUP_USER_COUNT * NUP_INPUTS_PER_USER * USER_INPUT_SIZE, []() {
+            const auto nup = std::make_shared<p2p::nonunl_proposal>(create_sample_nup());
+            return [nup]() {
+                flatbuffers::FlatBufferBuilder builder(1024);
+                p2pmsg::create_msg_from_nonunl_proposal(builder, *nup);
+                keep(builder.GetSize());
+            };
+        });
+
+        add("p2pmsg/nup_decode", NUP_USER_COUNT * NUP_INPUTS_PER_USER * USER_INPUT_SIZE, []() {
+            const p2p::nonunl_proposal nup = create_sample_nup();
+            const auto message = std::make_shared<std::string>(encode_p2p_msg([&](flatbuffers::FlatBufferBuilder &builder) {
+                p2pmsg::create_msg_from_nonunl_proposal(builder, nup);
+            }));
+
+            return [message]() {
+                if (!p2pmsg::verify_peer_message(*message))
+                    return;
+                const p2p::peer_message_info mi = p2pmsg::get_peer_message_info(*message);
+                keep(p2pmsg::create_nonunl_proposal_from_msg(mi));
+            };
+        });
+
+        add_usrmsg_benchmarks("json", util::PROTOCOL::JSON);
+        add_usrmsg_benchmarks("bson", util::PROTOCOL::BSON);
+    }
+
+} // namespace bench
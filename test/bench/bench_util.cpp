@@ -0,0 +1,52 @@
+#include "../../src/pchheader.hpp"
+#include "../../src/crypto.hpp"
+#include "../../src/util/rollover_hashset.hpp"
+#include "../../src/util/buffer_store.hpp"
+#include "bench.hpp"
+
+namespace bench
+{
+    constexpr uint32_t ROLLOVER_HASHSET_SIZE = 10000;
+    constexpr size_t HASH_POOL_SIZE = 65536;
+
+    void add_buffer_store_benchmark(std::string_view name, const size_t size)
+    {
+        add(name, size, [size]() {
+            auto store = std::shared_ptr<util::buffer_store>(new util::buffer_store(), [](util::buffer_store *s) {
+                s->deinit();
+                delete s;
+            });
+            store->init();
+            const auto data = std::make_shared<std::string>(random_data(size));
+
+            return [store, data]() {
+                const util::buffer_view view = store->write_buf(data->data(), data->size());
+                keep(store->view_buf(view));
+                store->purge(view);
+            };
+        });
+    }
+
+    void register_util_benchmarks()
+    {
+        // Mostly unique hashes, as seen by the duplicate message filter.
+        add("rollover_hashset/try_emplace", 0, []() {
+            auto hashes = std::make_shared<std::vector<std::string>>();
+            hashes->reserve(HASH_POOL_SIZE);
+            for (size_t i = 0; i < HASH_POOL_SIZE; i++)
+                hashes->push_back(crypto::get_hash(random_data(32, i + 1)));
+
+            auto set = std::make_shared<util::rollover_hashset>(ROLLOVER_HASHSET_SIZE);
+            auto next = std::make_shared<size_t>(0);
+            return [hashes, set, next]() {
+                keep(set->try_emplace(hashes->at(*next)));
+                *next = (*next + 1) % hashes->size();
+            };
+        });
+
+        add_buffer_store_benchmark("buffer_store/write_purge_1kb", 1024);
+        add_buffer_store_benchmark("buffer_store/write_purge_256kb", 256 * 1024);
+        add_buffer_store_benchmark("buffer_store/write_purge_4mb", 4 * 1024 * 1024);
+    }
+
+} // namespace bench
@@ -20,6 +20,8 @@ async function main() {
         "Single user Input/Output": () => multiUserInputOutput(10, 10, 1),
         "Multi user read requests": () => multiUserReadRequests(10, 10, 10),
         "Multi user Input/Output": () => multiUserInputOutput(10, 10, 10),
+        "Many users connect/auth": () => multiUserConnect(1000),
+        "Many users Input/Output": () => multiUserInputOutput(1, 1, 1000),
     };
 
     activityLogger();
@@ -165,6 +167,23 @@ function multiUserInputOutput(payloadKB, requestCountPerUser, userCount) {
     return Promise.all(tasks);
 }
 
+function multiUserConnect(userCount) {
+
+    console.log("Connecting " + userCount + " users.");
+
+    return new Promise(async (resolve) => {
+        const timer = new Timer();
+        timer.start();
+
+        // Connect and authenticate all users concurrently and keep them connected until the last one is authenticated.
+        const clients = await Promise.all([...Array(userCount)].map(() => createClient()));
+        const runPeriod = timer.stop();
+
+        await Promise.all(clients.map(hpc => hpc.close()));
+        resolve(runPeriod);
+    })
+}
+
 function largePayload(payloadMB) {
     console.log("Submitting " + payloadMB + " MB request.")
     return new Promise(async (resolve) => {